@@ -0,0 +1,83 @@
+#pragma once
+
+#include "ProcessorState.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace CPU
+{
+  // Precomputed results of ADC & SBC. Every table has an entry for each
+  // combination of accumulator, operand & carry (see index()), holding the
+  // result in the low byte and the status flags it produces in the high
+  // byte, so the operations are a single load. The tables are built at
+  // compile time and shared (read-only) by every Executioner instance.
+  //
+  // Binary SBC is ADC of the inverted operand, so it uses the binary ADC
+  // table. The decimal tables follow the digit arithmetic of the NMOS 6502
+  // as emulated here: the overflow flag is left as it was.
+  namespace Alu
+  {
+    // Flags set by the binary & decimal tables
+    inline constexpr uint8_t BINARY_FLAGS = ProcessorBase::N | ProcessorBase::V | ProcessorBase::Z | ProcessorBase::C;
+    inline constexpr uint8_t DECIMAL_FLAGS = ProcessorBase::N | ProcessorBase::Z | ProcessorBase::C;
+
+    constexpr uint32_t index(uint8_t accumulator, uint8_t operand, bool carry)
+    {
+      return (carry << 16) | (accumulator << 8) | operand;
+    }
+
+    constexpr uint16_t entry(uint8_t result, uint8_t flags)
+    {
+      return result | ((flags | ProcessorBase::nzFlags[result]) << 8);
+    }
+
+    // A + M + C
+    constexpr uint16_t addBinary(uint8_t a, uint8_t m, bool c)
+    {
+      uint16_t temp = (uint16_t)a + (uint16_t)m + (uint16_t)c;
+      uint8_t  flags = (temp > 255) ? ProcessorBase::C : 0;
+      if ((~((uint16_t)m ^ (uint16_t)a) & (temp ^ (uint16_t)a)) & 0x80)
+      {
+        flags |= ProcessorBase::V;
+      }
+      return entry((uint8_t)(temp & 0x00FF), flags);
+    }
+
+    // A + M + C, in binary coded decimal
+    constexpr uint16_t addDecimal(uint8_t a, uint8_t m, bool c)
+    {
+      uint8_t d0 = (m & 0x0F) + (a & 0x0F) + (uint8_t)c;
+      uint8_t d1 = (m >> 4) + (a >> 4) + (d0 > 9 ? 1 : 0);
+
+      return entry((uint8_t)(d0 % 10 | (d1 % 10 << 4)), (d1 > 9) ? ProcessorBase::C : 0);
+    }
+
+    // A - M - (1 - C), in binary coded decimal
+    constexpr uint16_t subtractDecimal(uint8_t a, uint8_t m, bool c)
+    {
+      int8_t d0 = (a & 0x0F) - (m & 0x0F) - (c ? 0 : 1);
+      int8_t d1 = (a >> 4) - (m >> 4) - (d0 < 0 ? 1 : 0);
+
+      uint8_t result = (d0 < 0 ? 10 + d0 : d0) | ((d1 < 0 ? 10 + d1 : d1) << 4);
+      return entry(result, (d1 < 0) ? ProcessorBase::C : 0);
+    }
+
+    template <uint16_t (*Operation)(uint8_t, uint8_t, bool)>
+    constexpr std::array<uint16_t, 0x20000> generate()
+    {
+      std::array<uint16_t, 0x20000> table = {};
+      for (uint32_t i = 0; i < table.size(); i++)
+      {
+        table[i] = Operation((uint8_t)(i >> 8), (uint8_t)i, (i >> 16) != 0);
+      }
+      return table;
+    }
+
+    inline constexpr std::array<uint16_t, 0x20000> adc = generate<addBinary>();
+#ifdef DECIMAL_MODE
+    inline constexpr std::array<uint16_t, 0x20000> adcDecimal = generate<addDecimal>();
+    inline constexpr std::array<uint16_t, 0x20000> sbcDecimal = generate<subtractDecimal>();
+#endif
+  }
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <cstdint>
+
+namespace CPU
+{
+  // Cache of predecoded instructions. When the executioner meets an address
+  // that isn't cached, it decodes the run of instructions from there up to
+  // the next change of control flow (a basic block), so the following
+  // instructions are found predecoded as well.
+  //
+  // Instructions are stored per page, and a page is only allocated once code
+  // has been executed from it (the table of pages as well, so a processor
+  // that never enables the cache only holds the page generations). Bus::write() invalidates the page it writes to,
+  // so self modifying code is decoded again. Writes that bypass the bus (e.g.
+  // directly to Bus::ram) must call invalidate() or clear() themselves.
+  class BlockCache
+  {
+  public:
+    // A predecoded instruction
+    struct DECODED
+    {
+      // Page generation the instruction was decoded in, it is stale when
+      // the page has been written to since
+      uint32_t generation = 0;
+      // Branch target for relative addressing
+      uint16_t target = 0x0000;
+      // Opcode, indexes the opcode table
+      uint8_t  opcode = 0x00;
+      // Operand bytes following the opcode
+      uint8_t  operands[2] = { 0x00, 0x00 };
+      // Number of operand bytes
+      uint8_t  length = 0;
+      // Base number of cycles
+      uint8_t  cycles = 0;
+      // True once the slot has been decoded
+      bool     decoded = false;
+    };
+
+    void setEnabled(bool enable) { enabled = enable; }
+    bool isEnabled() { return enabled; }
+
+    // Returns the predecoded instruction at the address, or nullptr
+    DECODED* find(uint16_t addr)
+    {
+      Page* page = (pages == nullptr) ? nullptr : (*pages)[addr >> 8].get();
+      if (page == nullptr)
+      {
+        return nullptr;
+      }
+
+      DECODED& entry = (*page)[addr & 0xFF];
+      return (entry.decoded && entry.generation == generation[addr >> 8]) ? &entry : nullptr;
+    }
+
+    // Returns the slot for the address, allocating its page if needed
+    DECODED& slot(uint16_t addr)
+    {
+      if (pages == nullptr)
+      {
+        pages = std::make_unique<Pages>();
+      }
+
+      std::unique_ptr<Page>& page = (*pages)[addr >> 8];
+      if (page == nullptr)
+      {
+        page = std::make_unique<Page>();
+      }
+
+      DECODED& entry = (*page)[addr & 0xFF];
+      entry.generation = generation[addr >> 8];
+      return entry;
+    }
+
+    // Drops every instruction decoded in the page of the address. The
+    // generation is bumped even when nothing is cached, as translated code
+    // (see Jit & RecompiledModule) uses it to notice writes as well
+    void invalidate(uint16_t addr)
+    {
+      generation[addr >> 8]++;
+    }
+
+    // Current generation of the page of the address, changes whenever
+    // code decoded from the page becomes stale
+    uint32_t getGeneration(uint16_t addr) { return generation[addr >> 8]; }
+    // The generations of the 256 pages, which translated code bumps itself
+    uint32_t* getGenerations() { return generation.data(); }
+
+    // Drops every decoded instruction
+    void clear()
+    {
+      pages.reset();
+      for (auto& g : generation)
+      {
+        g++;
+      }
+    }
+
+  private:
+    typedef std::array<DECODED, 256> Page;
+    typedef std::array<std::unique_ptr<Page>, 256> Pages;
+
+    bool enabled = false;
+    std::unique_ptr<Pages> pages;
+    std::array<uint32_t, 256> generation = {};
+  };
+}
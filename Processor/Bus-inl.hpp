@@ -0,0 +1,670 @@
+#pragma once
+
+#include "Bus.hpp"
+#include "Types.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <stdexcept>
+#ifdef SPDLOG_FMT_EXTERNAL
+#include <fmt/format.h>
+#else
+#include <spdlog/fmt/fmt.h>
+#endif
+#include <signal.h>
+
+namespace CPU
+{
+
+  PROCESSOR_INLINE void handler(int sig)
+  {
+    std::cout << "Segmention Fault Detected. "
+              << "Printing Backtrace:" << std::endl
+              << Backtrace() << std::endl;
+    exit(1);
+  }
+
+
+  PROCESSOR_INLINE Bus::Bus(Executioner::VARIANT variant)
+    : cpu(variant)
+  {
+    // Installed once, by the first bus
+    static const bool installed = (signal(SIGSEGV, handler), true);
+    (void)installed;
+
+    // Connect CPU to communication bus
+    cpu.ConnectBus(this);
+    mapIdentity();
+    
+    // Clear RAM contents, just in case :P
+    reset();
+  }
+
+  PROCESSOR_INLINE Bus::~Bus()
+  {
+  }
+
+  PROCESSOR_INLINE void Bus::reset()
+  {
+    ram.fill(0x00);
+    dirty.fill(0xFFFF);
+    changed.fill(0xFFFF);
+    cpu.executioner.cache.clear();
+  }
+
+  PROCESSOR_INLINE void Bus::restoreDefaults()
+  {
+    // Detaching leaves the slots in place, so this walks every device once
+    for (Device* device : devices)
+    {
+      if (device != nullptr)
+      {
+        detach(*device);
+      }
+    }
+    devices.clear();
+    devicePages.clear();
+    irqLines = 0;
+    nmiLines = 0;
+
+    // Only the pages mapped elsewhere are set back, the others keep the
+    // changed rows & the code decoded from them (see resetTo())
+    for (uint16_t page = 0; page < 256; page++)
+    {
+      uint8_t* memory = &ram[page << 8];
+      if (pages[page].read != memory || pages[page].write != memory || handlers[page] != nullptr)
+      {
+        setPage((uint8_t)page, memory, memory, nullptr);
+      }
+      aliases[page] = (uint8_t)page;
+    }
+    volatilePages.reset();
+
+    cpu.restoreDefaults();
+  }
+
+  PROCESSOR_INLINE void Bus::load(uint16_t address, std::span<const uint8_t> bytes)
+  {
+    if (bytes.size() > ram.size())
+    {
+      throw std::length_error(fmt::format("Unable to load {} bytes into {} bytes of memory", bytes.size(), ram.size()));
+    }
+
+    size_t first = std::min(bytes.size(), ram.size() - address);
+    std::copy_n(bytes.begin(), first, ram.begin() + address);
+    // Wraps around to the start of the memory past its end
+    std::copy(bytes.begin() + first, bytes.end(), ram.begin());
+
+    for (size_t row = 0; row < bytes.size() + (address & 0x0F); row += 0x10)
+    {
+      markDirty((uint16_t)((address & 0xFFF0) + row));
+    }
+    for (size_t page = 0; page < bytes.size() + (address & 0xFF); page += 0x100)
+    {
+      invalidate((uint16_t)((address & 0xFF00) + page));
+    }
+  }
+
+#pragma region MEMORY MAP
+  PROCESSOR_INLINE void Bus::mapIdentity()
+  {
+    // RAM throughout, as mapRam(0x0000, 0xFFFF) without going through the
+    // pages one by one
+    for (uint16_t page = 0; page < 256; page++)
+    {
+      pages[page] = { &ram[page << 8], &ram[page << 8] };
+      aliases[page] = (uint8_t)page;
+    }
+  }
+
+  PROCESSOR_INLINE void Bus::mapRam(uint16_t offsetStart, uint16_t offsetStop)
+  {
+    mapMemory(offsetStart & 0xFF00, offsetStop, &ram[offsetStart & 0xFF00], true);
+  }
+
+  PROCESSOR_INLINE void Bus::mapRom(uint16_t offsetStart, uint16_t offsetStop)
+  {
+    mapMemory(offsetStart & 0xFF00, offsetStop, &ram[offsetStart & 0xFF00], false);
+  }
+
+  PROCESSOR_INLINE void Bus::mapMemory(uint16_t offsetStart, uint16_t offsetStop, uint8_t* memory, bool writable)
+  {
+    for (uint16_t page = offsetStart >> 8; page <= (offsetStop >> 8); page++)
+    {
+      uint8_t* base = memory + ((page - (offsetStart >> 8)) << 8);
+      setPage((uint8_t)page, base, writable ? base : nullptr, nullptr);
+    }
+    updateAliases();
+  }
+
+  PROCESSOR_INLINE void Bus::mapMirror(uint16_t offsetStart, uint16_t offsetStop, uint16_t sourceStart, uint16_t sourceStop)
+  {
+    uint16_t first = sourceStart >> 8;
+    uint16_t count = (sourceStop >> 8) - first + 1;
+    for (uint16_t page = offsetStart >> 8; page <= (offsetStop >> 8); page++)
+    {
+      uint16_t source = first + (page - (offsetStart >> 8)) % count;
+      setPage((uint8_t)page, pages[source].read, pages[source].write, handlers[source]);
+    }
+    updateAliases();
+  }
+
+  PROCESSOR_INLINE void Bus::mapHandler(uint16_t offsetStart, uint16_t offsetStop, PageHandler* handler)
+  {
+    for (uint16_t page = offsetStart >> 8; page <= (offsetStop >> 8); page++)
+    {
+      setPage((uint8_t)page, nullptr, nullptr, handler);
+    }
+    updateAliases();
+  }
+
+  PROCESSOR_INLINE void Bus::unmap(uint16_t offsetStart, uint16_t offsetStop)
+  {
+    mapHandler(offsetStart, offsetStop, nullptr);
+  }
+
+  PROCESSOR_INLINE void Bus::mapBank(uint16_t offsetStart, uint16_t offsetStop, const uint8_t* memory, PageHandler* handler)
+  {
+    for (uint16_t page = offsetStart >> 8; page <= (offsetStop >> 8); page++)
+    {
+      removeAlias((uint8_t)page);
+      setPage((uint8_t)page, memory + ((page - (offsetStart >> 8)) << 8), nullptr, handler);
+    }
+  }
+
+  PROCESSOR_INLINE void Bus::restoreMapping(uint8_t page, const MAPPING& mapping)
+  {
+    setPage(page, mapping.read, mapping.write, mapping.handler);
+    updateAliases();
+  }
+
+  PROCESSOR_INLINE void Bus::setPage(uint8_t index, const uint8_t* read, uint8_t* write, PageHandler* handler)
+  {
+    pages[index] = { read, write };
+    handlers[index] = handler;
+    // The changed rows no longer tell where ram was written
+    restored = 0;
+    // Code decoded from the page is from the memory mapped before
+    cpu.executioner.cache.invalidate(index << 8);
+  }
+
+  PROCESSOR_INLINE void Bus::updateAliases()
+  {
+    // The memory a page reads from, a page with devices still reads the
+    // bytes without a device from the memory it had before
+    std::array<const uint8_t*, 256> memory;
+    for (uint16_t page = 0; page < 256; page++)
+    {
+      memory[page] = pages[page].read;
+      auto device = devicePages.find((uint8_t)page);
+      if (device != devicePages.end() && handlers[page] == device->second.get())
+      {
+        memory[page] = device->second->memory;
+      }
+    }
+
+    // Sorted by memory, the pages sharing it are next to each other
+    std::array<uint8_t, 256> order;
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&memory](uint8_t a, uint8_t b) {
+      return (memory[a] != memory[b]) ? std::less<const uint8_t*>()(memory[a], memory[b]) : a < b;
+    });
+
+    for (uint16_t first = 0; first < 256;)
+    {
+      uint16_t last = first;
+      while (last + 1 < 256 && memory[order[last + 1]] == memory[order[first]])
+      {
+        last++;
+      }
+      for (uint16_t i = first; i <= last; i++)
+      {
+        bool shared = memory[order[i]] != nullptr && last > first;
+        aliases[order[i]] = shared ? order[(i == last) ? first : i + 1] : order[i];
+      }
+      first = last + 1;
+    }
+  }
+
+  PROCESSOR_INLINE void Bus::removeAlias(uint8_t index)
+  {
+    uint8_t previous = index;
+    while (aliases[previous] != index)
+    {
+      previous = aliases[previous];
+    }
+    aliases[previous] = aliases[index];
+    aliases[index] = index;
+  }
+
+  PROCESSOR_INLINE uint8_t Bus::readHandler(uint16_t addr, bool bReadOnly)
+  {
+    PageHandler* handler = handlers[addr >> 8];
+    return (handler != nullptr) ? handler->read(addr, bReadOnly) : 0x00;
+  }
+
+  PROCESSOR_INLINE void Bus::writeHandler(uint16_t addr, uint8_t data)
+  {
+    PageHandler* handler = handlers[addr >> 8];
+    if (handler != nullptr)
+    {
+      handler->write(addr, data);
+      markDirty(addr);
+      invalidate(addr);
+    }
+  }
+#pragma endregion MEMORY MAP
+
+#pragma region DEVICES
+  PROCESSOR_INLINE void Device::setIrq(bool held)
+  {
+    if (bus != nullptr)
+    {
+      bus->setIrq(line, held);
+    }
+  }
+
+  PROCESSOR_INLINE void Device::setNmi(bool held)
+  {
+    if (bus != nullptr)
+    {
+      bus->setNmi(line, held);
+    }
+  }
+
+  PROCESSOR_INLINE uint8_t Bus::DevicePage::read(uint16_t addr, bool bReadOnly)
+  {
+    Device* device = devices[addr & 0xFF];
+    if (device != nullptr)
+    {
+      return bReadOnly ? device->peek(addr) : device->read(addr);
+    }
+    if (memory != nullptr)
+    {
+      return memory[addr & 0xFF];
+    }
+    return (handler != nullptr) ? handler->read(addr, bReadOnly) : 0x00;
+  }
+
+  PROCESSOR_INLINE void Bus::DevicePage::write(uint16_t addr, uint8_t data)
+  {
+    Device* device = devices[addr & 0xFF];
+    if (device != nullptr)
+    {
+      device->write(addr, data);
+    }
+    else if (writable != nullptr)
+    {
+      writable[addr & 0xFF] = data;
+    }
+    else if (handler != nullptr)
+    {
+      handler->write(addr, data);
+    }
+  }
+
+  PROCESSOR_INLINE void Bus::attach(Device& device, uint16_t offsetStart, uint16_t offsetStop)
+  {
+    if (device.bus != this)
+    {
+      if (device.bus != nullptr)
+      {
+        device.bus->detach(device);
+      }
+
+      // The slot of the device is its bit on the interrupt lines
+      auto slot = std::find(devices.begin(), devices.end(), nullptr);
+      if (slot == devices.end())
+      {
+        if (devices.size() == 32)
+        {
+          throw std::length_error("No more than 32 devices can be attached to a bus");
+        }
+        slot = devices.insert(devices.end(), nullptr);
+      }
+      *slot = &device;
+      device.bus = this;
+      device.line = 1u << (slot - devices.begin());
+    }
+
+    for (uint16_t page = offsetStart >> 8; page <= (offsetStop >> 8); page++)
+    {
+      std::unique_ptr<DevicePage>& devicePage = devicePages[(uint8_t)page];
+      if (devicePage == nullptr || handlers[page] != devicePage.get())
+      {
+        // The page was mapped again since, start over from its mapping
+        devicePage = std::make_unique<DevicePage>();
+        devicePage->memory = pages[page].read;
+        devicePage->writable = pages[page].write;
+        devicePage->handler = handlers[page];
+        setPage((uint8_t)page, nullptr, nullptr, devicePage.get());
+      }
+
+      uint16_t first = (page == (offsetStart >> 8)) ? (offsetStart & 0xFF) : 0x00;
+      uint16_t last = (page == (offsetStop >> 8)) ? (offsetStop & 0xFF) : 0xFF;
+      for (uint16_t i = first; i <= last; i++)
+      {
+        devicePage->devices[i] = &device;
+      }
+      cpu.executioner.cache.invalidate(page << 8);
+    }
+    updateAliases();
+  }
+
+  PROCESSOR_INLINE void Bus::detach(Device& device)
+  {
+    if (device.bus != this)
+    {
+      return;
+    }
+
+    for (auto page = devicePages.begin(); page != devicePages.end();)
+    {
+      DevicePage& devicePage = *page->second;
+      std::replace(devicePage.devices.begin(), devicePage.devices.end(), &device, (Device*)nullptr);
+
+      bool mapped = handlers[page->first] == &devicePage;
+      bool empty = std::all_of(devicePage.devices.begin(), devicePage.devices.end(), [](Device* d) { return d == nullptr; });
+      if (mapped && empty)
+      {
+        // Back to the mapping the page had before
+        setPage(page->first, devicePage.memory, devicePage.writable, devicePage.handler);
+      }
+      else if (mapped)
+      {
+        cpu.executioner.cache.invalidate(page->first << 8);
+      }
+
+      page = (!mapped || empty) ? devicePages.erase(page) : std::next(page);
+    }
+    updateAliases();
+
+    setIrq(device.line, false);
+    setNmi(device.line, false);
+    devices[std::countr_zero(device.line)] = nullptr;
+    device.bus = nullptr;
+    device.line = 0;
+  }
+
+  PROCESSOR_INLINE void Bus::setIrq(uint32_t line, bool held)
+  {
+    irqLines = held ? (irqLines | line) : (irqLines & ~line);
+    cpu.setIrqLine(irqLines != 0);
+  }
+
+  PROCESSOR_INLINE void Bus::setNmi(uint32_t line, bool held)
+  {
+    uint32_t previous = nmiLines;
+    nmiLines = held ? (nmiLines | line) : (nmiLines & ~line);
+    // Edge triggered, on the first device raising the line
+    if (previous == 0 && nmiLines != 0)
+    {
+      cpu.TriggerNmi = true;
+    }
+  }
+#pragma endregion DEVICES
+
+  PROCESSOR_INLINE void Bus::peek(uint16_t offsetStart, std::span<uint8_t> buffer)
+  {
+    size_t done = 0;
+    while (done < buffer.size())
+    {
+      uint16_t addr = (uint16_t)(offsetStart + done);
+      size_t   count = std::min<size_t>(0x100 - (addr & 0xFF), buffer.size() - done);
+      std::span<const uint8_t> memory = view((uint8_t)(addr >> 8));
+      if (!memory.empty())
+      {
+        std::copy_n(memory.begin() + (addr & 0xFF), count, buffer.begin() + done);
+      }
+      else
+      {
+        for (size_t i = 0; i < count; i++)
+        {
+          buffer[done + i] = read((uint16_t)(addr + i), true);
+        }
+      }
+      done += count;
+    }
+  }
+
+#pragma region DIRTY TRACKING
+  PROCESSOR_INLINE std::vector<Bus::RANGE> Bus::getDirtyRanges(uint16_t offsetStart, uint16_t offsetStop)
+  {
+    std::vector<RANGE> ranges;
+    for (uint32_t row = offsetStart & 0xFFF0; row <= offsetStop; row += 0x10)
+    {
+      if (!isDirty((uint16_t)row))
+      {
+        continue;
+      }
+      if (!ranges.empty() && (uint32_t)ranges.back().last + 1 == row)
+      {
+        ranges.back().last = (uint16_t)(row | 0x000F);
+      }
+      else
+      {
+        ranges.push_back({ (uint16_t)row, (uint16_t)(row | 0x000F) });
+      }
+    }
+    return ranges;
+  }
+
+  PROCESSOR_INLINE void Bus::clearDirty(uint16_t offsetStart, uint16_t offsetStop)
+  {
+    for (uint32_t row = offsetStart & 0xFFF0; row <= offsetStop; row += 0x10)
+    {
+      changed[row >> 8] |= dirty[row >> 8] & dirtyBit((uint16_t)row);
+      dirty[row >> 8] &= ~dirtyBit((uint16_t)row);
+    }
+  }
+#pragma endregion DIRTY TRACKING
+
+#pragma region SNAPSHOTS
+  PROCESSOR_INLINE Bus::SNAPSHOT Bus::snapshot()
+  {
+    static std::atomic<uint64_t> next = 0;
+
+    cpu.syncFlags();
+    SNAPSHOT snapshot = {
+      .reg = cpu.reg,
+      .total_cycles = cpu.total_cycles,
+      .ram = std::vector<uint8_t>(ram.begin(), ram.end()),
+      .id = ++next
+    };
+
+    // Ram is the snapshot from now on
+    changed.fill(0x0000);
+    restored = snapshot.id;
+    return snapshot;
+  }
+
+  PROCESSOR_INLINE void Bus::resetTo(const SNAPSHOT& snapshot)
+  {
+    // The changed rows are where ram changed when the pages written to are
+    // mapped to the same addresses of ram. Otherwise (mirrors, ROM,
+    // handlers, ...) all of it is copied. The rows still dirty may have been
+    // written since as well
+    for (uint16_t page = 0; page < 256; page++)
+    {
+      changed[page] |= dirty[page];
+    }
+
+    bool partial = restored == snapshot.id;
+    for (uint16_t page = 0; page < 256 && partial; page++)
+    {
+      partial = changed[page] == 0 || pages[page].write == &ram[page << 8];
+    }
+
+    if (partial)
+    {
+      // Only the rows that differ are copied & marked dirty, so the rows
+      // cleared since do not come back every time
+      for (uint16_t page = 0; page < 256; page++)
+      {
+        uint16_t copied = 0;
+        for (uint16_t row = 0; row < 16 && changed[page] != 0; row++)
+        {
+          size_t offset = (page << 8) | (row << 4);
+          if ((changed[page] & (1 << row)) && !std::equal(ram.begin() + offset, ram.begin() + offset + 0x10, snapshot.ram.begin() + offset))
+          {
+            std::copy_n(snapshot.ram.begin() + offset, 0x10, ram.begin() + offset);
+            copied |= (uint16_t)(1 << row);
+          }
+        }
+        if (copied != 0)
+        {
+          dirty[page] |= copied;
+          invalidate(page << 8);
+        }
+      }
+    }
+    else
+    {
+      std::copy(snapshot.ram.begin(), snapshot.ram.end(), ram.begin());
+      dirty.fill(0xFFFF);
+      cpu.executioner.cache.clear();
+    }
+
+    changed.fill(0x0000);
+    restored = snapshot.id;
+    cpu.restore(snapshot.reg, snapshot.total_cycles);
+  }
+
+  PROCESSOR_INLINE void BusPool::RELEASE::operator()(Bus* bus) const noexcept
+  {
+    std::unique_ptr<Bus> recycled(bus);
+    recycled->restoreDefaults();
+    try
+    {
+      pool->available.push_back(std::move(recycled));
+    }
+    catch (const std::bad_alloc&)
+    {
+      // The pool cannot grow, the bus is deleted instead
+    }
+  }
+
+  PROCESSOR_INLINE BusPool::HANDLE BusPool::acquire(const Bus::SNAPSHOT& snapshot)
+  {
+    if (available.empty())
+    {
+      reserve(1);
+    }
+
+    HANDLE bus(available.back().release(), RELEASE{ this });
+    available.pop_back();
+    bus->resetTo(snapshot);
+    return bus;
+  }
+
+  PROCESSOR_INLINE void BusPool::reserve(size_t count)
+  {
+    while (available.size() < count)
+    {
+      available.push_back(std::make_unique<Bus>(variant));
+    }
+  }
+#pragma endregion SNAPSHOTS
+
+  PROCESSOR_INLINE void Bus::setVolatile(uint16_t offsetStart, uint16_t offsetStop, bool isVolatile)
+  {
+    for (uint16_t page = offsetStart >> 8; page <= (offsetStop >> 8); page++)
+    {
+      volatilePages[page] = isVolatile;
+    }
+  }
+
+  PROCESSOR_INLINE void Bus::dump(uint16_t offset)
+  {
+#ifdef LOGMODE
+    Logger::log()->info("Actual ADDR: ${:04X}", offset);
+
+    uint16_t offsetStart = offset & 0xFFF0;
+    uint16_t offsetStop = offset | 0x000F;
+    dump(offsetStart, offsetStop);
+#endif
+  }
+
+  PROCESSOR_INLINE void Bus::dump(uint16_t offsetStart, uint16_t offsetStop)
+  {
+#ifdef LOGMODE
+    Logger::log()->info("MEMORY LOG FOR: ${:04X} - ${:04X}", offsetStart, offsetStop);
+    Logger::log()->info(" ADDR 00 01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F");
+
+    std::array<uint8_t, 16> bytes;
+    for (uint32_t row = offsetStart & 0xFFF0; row <= offsetStop; row += 0x10)
+    {
+      peek((uint16_t)row, bytes);
+      Logger::log()->info("{}", MEMORYMAP::row((uint16_t)row, bytes.data()));
+    }
+#endif
+  }
+
+  /*
+  std::string Bus::dumpRaw(uint16_t offsetStart, uint16_t offsetStop)
+  {
+    std::string log = fmt::format("MEMORY LOG FOR: ${:04X} - ${:04X} \n${:04X}:", offsetStart, offsetStop, offsetStart);
+
+    uint16_t multiplier = 0;
+    for (uint16_t i = offsetStart; i <= offsetStop; i++)
+    {
+      if (i % 16 == 0 && i != offsetStart) {
+        multiplier++;
+        if (i != offsetStop)
+        {
+          log += fmt::format("\n${:04X}:", offsetStart + (multiplier * 0x0010));
+        }
+      }
+
+      log += fmt::format(" {:02X}", read(i, true));
+      if (i == offsetStop)
+      {
+        log += "\n";
+      }
+    }
+
+    return log;
+  }
+  */
+
+  // Update Memory Map
+  PROCESSOR_INLINE void Bus::updateMemoryMap(uint16_t offset, uint8_t rows, bool clear)
+  {
+    if (clear)
+    {
+      memorymap.clear();
+    }
+
+    uint16_t offsetStart = offset & 0xFFF0;
+    uint16_t offsetStop = (rows * (offset + 1)) | 0x000F;
+
+    std::map<uint16_t, Bus::MEMORYMAP> memory = memoryDump(offsetStart, offsetStop);
+
+    uint16_t multiplier = 0;
+    for (auto& i : memory)
+    {
+      uint32_t offsetPos = (16 * (uint32_t)multiplier) + (uint32_t)offset;
+      auto row = i.second;
+      memorymap[row.Offset] = row;
+    }
+  }
+
+  PROCESSOR_INLINE std::map<uint16_t, Bus::MEMORYMAP> Bus::memoryDump(uint16_t offsetStart, uint16_t offsetStop)
+  {
+    std::map<uint16_t, Bus::MEMORYMAP> memory;
+    std::array<uint8_t, 16> bytes;
+    uint16_t multiplier = 0;
+
+    for (uint32_t row = offsetStart & 0xFFF0; row <= offsetStop; row += 0x10)
+    {
+      peek((uint16_t)row, bytes);
+      memory[multiplier++] = MEMORYMAP::row((uint16_t)row, bytes.data());
+    }
+    return memory;
+  }
+}
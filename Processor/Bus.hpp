@@ -1,9 +1,15 @@
 #pragma once
 
+#include "Common.hpp"
 #include "Processor.hpp"
 
 #include <array>
+#include <bitset>
+#include <cstddef>
 #include <map>
+#include <memory>
+#include <span>
+#include <vector>
 #ifdef SPDLOG_FMT_EXTERNAL
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -15,10 +21,75 @@
 namespace CPU
 {
   class Logger;
+
+  // Memory used per instance. A Bus holds its RAM and its Processor, and the
+  // processor holds everything it needs to run:
+  //
+  //   ProcessorState       64 bytes  Registers, cycle counters, interrupt
+  //                                  lines & temporaries, one cache line
+  //   Processor        ~1,400 bytes  Mostly the page generations of the
+  //                                  block cache (1 KB)
+  //   RAM                  64 KB
+  //   Page table         ~7.4 KB  Pointers, handler & dirty rows of every
+  //                               page
+  //
+  // so about 73 KB per Bus, and 3.7 GB for 50,000 of them. The opcode & ALU
+  // tables are shared by every instance. Optional features allocate their
+  // memory the first time they are used, and keep it until the processor is
+  // destroyed: the block cache 3 KB per page of code executed (plus 2 KB
+  // once), the JIT 4 KB per page of code executed (plus 2 KB once) and 1 MB
+  // of code buffer, and the opcode profile 512 KB. Attached devices take 2 KB
+  // per page they are on. The budgets below are checked at compile time.
+  inline constexpr size_t PROCESSOR_BUDGET = 2 * 1024;
+  inline constexpr size_t BUS_BUDGET = 64 * 1024 + PROCESSOR_BUDGET + 8 * 1024;
+
+  // Handles the accesses to the pages mapped to it, see Bus::mapHandler()
+  class PageHandler
+  {
+  public:
+    virtual ~PageHandler() = default;
+
+    // bReadOnly is set by the debugger & the disassembler, the read must
+    // not change the state of the handler then
+    virtual uint8_t read(uint16_t addr, bool bReadOnly) = 0;
+    virtual void    write(uint16_t addr, uint8_t data) = 0;
+  };
+
+  class Bus;
+
+  // A peripheral on the bus, attached to a range of addresses with
+  // Bus::attach(). It is sent the accesses of its range, and drives the
+  // interrupt lines of the processor
+  class Device
+  {
+  public:
+    virtual ~Device() = default;
+
+    virtual uint8_t read(uint16_t addr) = 0;
+    virtual void    write(uint16_t addr, uint8_t data) = 0;
+    // Reads without side effects (e.g. clearing a status register), used by
+    // the debugger, the disassembler & the block cache
+    virtual uint8_t peek(uint16_t addr) = 0;
+
+  protected:
+    // The lines are wired-OR: the processor sees an IRQ while any device
+    // holds it, and an NMI when the first device raises it
+    void setIrq(bool held);
+    void setNmi(bool held);
+    Bus* getBus() { return bus; }
+
+  private:
+    friend class Bus;
+
+    Bus*     bus = nullptr;
+    // The bit of the device on the interrupt lines
+    uint32_t line = 0;
+  };
+
   class Bus
   {
   public:
-    Bus();
+    Bus(Executioner::VARIANT variant = Executioner::DEFAULT_VARIANT);
     ~Bus();
 
   public: // Devices on bus
@@ -47,6 +118,18 @@ namespace CPU
       uint8_t   Pos0E;
       uint8_t   Pos0F;
 
+      // The row of the 16 bytes at offset
+      static MEMORYMAP row(uint16_t offset, const uint8_t* bytes)
+      {
+        return {
+          offset,
+          bytes[0x00], bytes[0x01], bytes[0x02], bytes[0x03],
+          bytes[0x04], bytes[0x05], bytes[0x06], bytes[0x07],
+          bytes[0x08], bytes[0x09], bytes[0x0A], bytes[0x0B],
+          bytes[0x0C], bytes[0x0D], bytes[0x0E], bytes[0x0F]
+        };
+      }
+
       friend std::ostream &operator<<(std::ostream &os, const MEMORYMAP& obj)
       {
         fmt::format_to(
@@ -67,13 +150,300 @@ namespace CPU
 
   public: // Bus Read & Write
     void reset();
-    void write(uint16_t addr, uint8_t data);
-    uint8_t read(uint16_t addr, bool bReadOnly = false);
+    // Puts the configuration back to that of a new bus: the devices are
+    // detached, the pages are ram throughout, none is volatile, and the
+    // processor has its default settings (see Processor::restoreDefaults()).
+    // Ram is left as it is
+    void restoreDefaults();
+    // Copies the bytes (at most 64 KB) into ram from the address on,
+    // wrapping around at the end. It is one copy, not a write per byte
+    // through the page table, and drops the code decoded from the memory
+    void load(uint16_t address, std::span<const uint8_t> bytes);
+    // Pages with a pointer are read & written directly, the others go to
+    // their handler. They are defined here to be inlined into the opcodes
+    void write(uint16_t addr, uint8_t data)
+    {
+      const PAGE& page = pages[addr >> 8];
+      if (page.write != nullptr)
+      {
+        page.write[addr & 0xFF] = data;
+        markDirty(addr);
+        invalidate(addr);
+        return;
+      }
+      writeHandler(addr, data);
+    }
+    uint8_t read(uint16_t addr, bool bReadOnly = false)
+    {
+      //Logger::log()->debug("RAM: ${:04X} = {:02X}", addr, ram[addr]);
+      const PAGE& page = pages[addr >> 8];
+      if (page.read != nullptr)
+      {
+        return page.read[addr & 0xFF];
+      }
+      return readHandler(addr, bReadOnly);
+    }
+
+  public: // Memory map
+    // The address space is a table of 256 pages of 256 bytes. Every page
+    // points to the memory it reads from, and writes to unless it is read
+    // only, so RAM, ROM & mirrors are accessed directly. Pages without
+    // memory go to their handler, or read as 0x00 and ignore writes when
+    // they have none. The ranges below cover every page from the one of
+    // offsetStart to the one of offsetStop. A Bus starts as RAM throughout.
+
+    // Maps the range to the same addresses of ram
+    void mapRam(uint16_t offsetStart, uint16_t offsetStop);
+    // As mapRam(), but writes are ignored. Load it through ram (e.g. with
+    // LoadProgram())
+    void mapRom(uint16_t offsetStart, uint16_t offsetStop);
+    // Maps the range to memory outside of the bus, one page after the other.
+    // The memory must hold every page and outlive the mapping
+    void mapMemory(uint16_t offsetStart, uint16_t offsetStop, uint8_t* memory, bool writable = true);
+    // Repeats the current mapping of the source range over the range, e.g.
+    // mapMirror(0x0800, 0x1FFF, 0x0000, 0x07FF) for the 2 KB of RAM of the NES
+    void mapMirror(uint16_t offsetStart, uint16_t offsetStop, uint16_t sourceStart, uint16_t sourceStop);
+    // Sends every access of the range to the handler, which must outlive
+    // the mapping. The pages are volatile (see setVolatile())
+    void mapHandler(uint16_t offsetStart, uint16_t offsetStop, PageHandler* handler);
+    // Nothing is mapped, reads return 0x00 and writes are ignored
+    void unmap(uint16_t offsetStart, uint16_t offsetStop);
+    // Reads the range from memory outside of the bus, as mapMemory(), and
+    // sends the writes to the handler (when given). For the banks of a
+    // Mapper: the memory must only be reachable through this range, so the
+    // pages are not compared with the others and switching a bank costs one
+    // entry per page
+    void mapBank(uint16_t offsetStart, uint16_t offsetStop, const uint8_t* memory, PageHandler* handler = nullptr);
+
+    // The mapping of a page, to be put back with restoreMapping()
+    struct MAPPING
+    {
+      const uint8_t* read = nullptr;
+      uint8_t*       write = nullptr;
+      PageHandler*   handler = nullptr;
+    };
+    MAPPING getMapping(uint8_t page) { return { pages[page].read, pages[page].write, handlers[page] }; }
+    void    restoreMapping(uint8_t page, const MAPPING& mapping);
+
+  public: // Devices
+    // Sends the accesses of offsetStart to offsetStop (inclusive, to the
+    // byte) to the device, which must outlive the attachment. The rest of
+    // the pages keeps its mapping, the pages become volatile. At most 32
+    // devices are attached at a time
+    void attach(Device& device, uint16_t offsetStart, uint16_t offsetStop);
+    // Removes the device from every address it is attached to, and releases
+    // the interrupt lines it holds
+    void detach(Device& device);
+
+  private:
+    friend class Device;
+
+    // A page with devices on it. Every byte is dispatched through a table,
+    // the bytes without a device go to the mapping the page had before
+    class DevicePage : public PageHandler
+    {
+    public:
+      uint8_t read(uint16_t addr, bool bReadOnly) override;
+      void    write(uint16_t addr, uint8_t data) override;
+
+      std::array<Device*, 256> devices = {};
+      // The mapping of the page before the first device was attached
+      const uint8_t* memory = nullptr;
+      uint8_t*       writable = nullptr;
+      PageHandler*   handler = nullptr;
+    };
+
+    std::vector<Device*> devices;
+    // Created with the first device on a page
+    std::map<uint8_t, std::unique_ptr<DevicePage>> devicePages;
+    // One bit per device holding the line
+    uint32_t irqLines = 0;
+    uint32_t nmiLines = 0;
+
+    void setIrq(uint32_t line, bool held);
+    void setNmi(uint32_t line, bool held);
+
+  private:
+    struct PAGE
+    {
+      // Memory of the page, nullptr when the accesses go to the handler
+      const uint8_t* read = nullptr;
+      uint8_t*       write = nullptr;
+    };
+
+    std::array<PAGE, 256>         pages;
+    // Slow path, only used by the pages without memory
+    std::array<PageHandler*, 256> handlers = {};
+    // The pages sharing their memory form a ring, so a write through one
+    // of them invalidates the code decoded from the others too. A page that
+    // shares nothing is its own next page
+    std::array<uint8_t, 256>      aliases;
+
+    // Every page mapped to the same addresses of ram, sharing nothing
+    void    mapIdentity();
+    void    setPage(uint8_t index, const uint8_t* read, uint8_t* write, PageHandler* handler);
+    void    updateAliases();
+    void    removeAlias(uint8_t index);
+    uint8_t readHandler(uint16_t addr, bool bReadOnly);
+    void    writeHandler(uint16_t addr, uint8_t data);
+
+    // Drops the code decoded from the page of the address, and from the
+    // pages sharing its memory
+    void invalidate(uint16_t addr)
+    {
+      cpu.executioner.cache.invalidate(addr);
+      for (uint8_t page = aliases[addr >> 8]; page != (addr >> 8); page = aliases[page])
+      {
+        cpu.executioner.cache.invalidate(page << 8);
+      }
+    }
+
+  public: // JIT
+    // The page table & the tables a write updates, which translated code
+    // (see Executioner::translate()) reads & writes itself
+    Jit::MEMORY getJitMemory()
+    {
+      static_assert(sizeof(PAGE) == 16 && offsetof(PAGE, write) == 8, "the generated code indexes the page table by page * 16");
+      return { pages.data(), dirty.data(), aliases.data(), cpu.executioner.cache.getGenerations() };
+    }
+
+  public: // Dirty tracking
+    // A write through the bus marks the row of 16 bytes it falls in as
+    // dirty, until it is cleared, so a UI or a snapshot only has to look at
+    // what changed. Rows are marked by the address written to (not by the
+    // mirrors of it). reset() marks everything and load() what it copies,
+    // other writes to ram that bypass the bus are not seen
+    struct RANGE
+    {
+      uint16_t first;
+      uint16_t last;
+    };
+
+    bool isDirty(uint16_t addr) { return (dirty[addr >> 8] & dirtyBit(addr)) != 0; }
+    bool isPageDirty(uint8_t page) { return dirty[page] != 0; }
+    // The dirty rows of the page, bit n is the row at offset n * 16
+    uint16_t getDirtyRows(uint8_t page) { return dirty[page]; }
+    // The dirty rows of the range, consecutive rows joined into one range
+    std::vector<RANGE> getDirtyRanges(uint16_t offsetStart = 0x0000, uint16_t offsetStop = 0xFFFF);
+    // Clears the rows covering the range
+    void clearDirty(uint16_t offsetStart = 0x0000, uint16_t offsetStop = 0xFFFF);
+    // For the writes to ram that bypass the bus
+    void markDirty(uint16_t addr)
+    {
+      dirty[addr >> 8] |= dirtyBit(addr);
+    }
+
+  private:
+    std::array<uint16_t, 256> dirty = {};
+    // The rows written since the snapshot ram is a copy of (see restored),
+    // besides the dirty ones. Writes only mark dirty, clearDirty() & resetTo()
+    // move the dirty rows in here first so clearing them loses none
+    std::array<uint16_t, 256> changed = {};
+
+    static uint16_t dirtyBit(uint16_t addr) { return (uint16_t)(1 << ((addr >> 4) & 0x0F)); }
+
+  public: // Snapshots
+    // The memory & the registers at one point, to go back to with resetTo().
+    // The memory outside of ram, the devices & the configuration of the bus
+    // (memory map, dispatch engine, ...) are not part of it
+    struct SNAPSHOT
+    {
+      Processor::REGISTER  reg;
+      uint64_t             total_cycles = 0;
+      std::vector<uint8_t> ram;
+      // Tells the snapshots apart, see resetTo()
+      uint64_t             id = 0;
+    };
+
+    // Ram is the snapshot from then on. The dirty rows are left as they are
+    SNAPSHOT snapshot();
+    // Puts ram & the processor back into the state of the snapshot. When the
+    // snapshot was the last one taken or reset to, only the rows written
+    // since, along with the rows still dirty from before it (they may have
+    // been written since as well), are compared & the ones that differ
+    // copied back, and marked dirty. All of ram is copied (and marked dirty)
+    // when it was another one, when the memory map was changed in between,
+    // or when ram was written at other addresses (e.g. through mirrors).
+    // Writes to ram that bypass the bus, other than load(), must be followed
+    // by markDirty()
+    void resetTo(const SNAPSHOT& snapshot);
+
+  private:
+    // The snapshot ram is a copy of, besides the changed rows. 0 if none
+    uint64_t restored = 0;
+
+  public: // Idle loop detection
+    // Marks the pages of the addresses as volatile, where a read can return
+    // something else without the processor writing to it (e.g. device
+    // registers). Loops reading volatile memory are never skipped as idle
+    void setVolatile(uint16_t offsetStart, uint16_t offsetStop, bool isVolatile = true);
+    bool isVolatile(uint16_t addr) { return volatilePages[addr >> 8] || (pages[addr >> 8].read == nullptr && handlers[addr >> 8] != nullptr); }
+
+  private:
+    std::bitset<256> volatilePages;
+
+  public: // Inspection
+    // The memory the page reads from, without copying it: RAM, ROM, mirrors
+    // & banks. It is empty for the pages without memory (handlers, devices
+    // & unmapped pages), peek() those
+    std::span<const uint8_t> view(uint8_t page)
+    {
+      const uint8_t* memory = pages[page].read;
+      return (memory != nullptr) ? std::span<const uint8_t>(memory, 256) : std::span<const uint8_t>();
+    }
+    // Reads without side effects, as the debugger & the disassembler do
+    uint8_t peek(uint16_t addr) { return read(addr, true); }
+    // Peeks the bytes from offsetStart on into the buffer, copying the pages
+    // with memory at once
+    void peek(uint16_t offsetStart, std::span<uint8_t> buffer);
 
   public: // DEBUG
+    // A node per row, prefer view() & peek()
     std::map<uint16_t, MEMORYMAP> memoryDump(uint16_t offsetStart, uint16_t offsetStop);
     void updateMemoryMap(uint16_t offset = 0x0000, uint8_t rows = 0xFF, bool clear = true);
     void dump(uint16_t offsetStart);
     void dump(uint16_t offsetStart, uint16_t offsetStop);
   };
+
+  static_assert(sizeof(Processor) <= PROCESSOR_BUDGET, "Processor exceeds its memory budget");
+  static_assert(sizeof(Bus) <= BUS_BUDGET, "Bus exceeds its memory budget");
+
+  // Recycles buses, so an emulation that only runs for a moment does not
+  // pay for constructing one. acquire() hands out a bus reset to the
+  // snapshot, which goes back to the pool when its handle is destroyed.
+  // What was configured on the bus (memory map, devices, dispatch engine,
+  // ...) is undone then, see Bus::restoreDefaults(). The pool must outlive
+  // the handles
+  class BusPool
+  {
+  public:
+    struct RELEASE
+    {
+      BusPool* pool = nullptr;
+      void operator()(Bus* bus) const noexcept;
+    };
+    typedef std::unique_ptr<Bus, RELEASE> HANDLE;
+
+    BusPool(Executioner::VARIANT variant = Executioner::DEFAULT_VARIANT) : variant(variant) {}
+
+    HANDLE acquire(const Bus::SNAPSHOT& snapshot);
+    // Constructs buses until count of them are available
+    void   reserve(size_t count);
+    size_t getAvailable() { return available.size(); }
+
+  private:
+    Executioner::VARIANT variant;
+    std::vector<std::unique_ptr<Bus>> available;
+  };
+
+#ifndef HEADER_ONLY
+  // Built once, in Processor.cpp & Executioner.cpp
+  extern template class BasicProcessor<Bus>;
+  extern template class BasicExecutioner<Bus>;
+#endif
 };
+
+#ifdef HEADER_ONLY
+// Logger.hpp includes the implementation, once every class is declared
+#include "Logger.hpp"
+#endif
@@ -0,0 +1,11 @@
+#pragma once
+
+// The library is built from the .cpp files, which compile the implementation
+// kept in the -inl.hpp files. With HEADER_ONLY (see the Processor-header-only
+// target) the headers include the -inl.hpp files instead, and the functions
+// in them are declared inline.
+#ifdef HEADER_ONLY
+#define PROCESSOR_INLINE inline
+#else
+#define PROCESSOR_INLINE
+#endif
@@ -0,0 +1,4199 @@
+#pragma once
+
+#include "Executioner.hpp"
+#include "Instructions.hpp"
+#include "Alu.hpp"
+#include "Processor.hpp"
+#include "Logger.hpp"
+#include "Types.hpp"
+
+#include <vector>
+#include <string>
+#include <filesystem>
+#include <spdlog/spdlog.h>
+#ifdef SPDLOG_FMT_EXTERNAL
+#include <fmt/format.h>
+#else
+#include <spdlog/fmt/fmt.h>
+#endif
+#include <map>
+#include <stdexcept>
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+
+namespace CPU
+{
+  // The fused opcode (see Op()) for every slot in the opcode table of the variant
+  template <typename BusT, ExecutionerBase::VARIANT V, size_t... OP>
+  constexpr std::array<typename BasicExecutioner<BusT>::ExecutionType, 256> fuseOperations(std::index_sequence<OP...>)
+  {
+    return { &BasicExecutioner<BusT>::template Op<instructionSet<BusT, V>[OP].addrmode.op, instructionSet<BusT, V>[OP].operate.op>... };
+  }
+
+  template <typename BusT, ExecutionerBase::VARIANT V>
+  inline constexpr std::array<typename BasicExecutioner<BusT>::ExecutionType, 256> fused = fuseOperations<BusT, V>(std::make_index_sequence<256>{});
+
+  template <typename BusT>
+  BasicExecutioner<BusT>::BasicExecutioner(VARIANT variant)
+    : variant(variant)
+  {
+    switch (variant)
+    {
+      case WDC65C02:
+        operations = &instructionSet<BusT, WDC65C02>;
+        fusedOperations = &fused<BusT, WDC65C02>;
+        break;
+      case RICOH2A03:
+        operations = &instructionSet<BusT, RICOH2A03>;
+        fusedOperations = &fused<BusT, RICOH2A03>;
+        break;
+      case MOS6502:
+      default:
+        operations = &instructionSet<BusT, MOS6502>;
+        fusedOperations = &fused<BusT, MOS6502>;
+        break;
+    }
+  }
+
+  template <typename BusT>
+  BasicExecutioner<BusT>::~BasicExecutioner()
+  {
+    // Destructor - has nothing to do
+  }
+
+  template <typename BusT>
+  void BasicExecutioner<BusT>::reset()
+  {
+    // Get address to set program counter to
+    cpu->addr_abs = 0xFFFC;
+
+    uint16_t newPc = (cpu->readMemory(cpu->addr_abs + 1) << 8) | cpu->readMemory(cpu->addr_abs + 0);
+
+//#ifdef DEBUG
+//    Logger::log()->debug("RESET - NEW PC: {:04X} {: >69}", newPc, cpu->reg);
+//#endif
+
+    // Set it
+    cpu->setProgramCounter(newPc);
+
+    // Clear internal helper variables
+    cpu->addr_rel = 0x0000;
+    cpu->addr_abs = 0x0000;
+    cpu->fetched = 0x00;
+
+    cache.clear();
+    decoded = nullptr;
+  }
+
+  template <typename BusT>
+  void BasicExecutioner<BusT>::setBlockCache(bool enable)
+  {
+    cache.setEnabled(enable);
+    cache.clear();
+    decoded = nullptr;
+  }
+
+  template <typename BusT>
+  void BasicExecutioner<BusT>::restoreDefaults()
+  {
+    dispatch = DEFAULT_DISPATCH;
+    setBlockCache(false);
+    profile.setEnabled(false);
+    profile.clear();
+  }
+
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::fetchOpcode(uint16_t addr)
+  {
+    decoded = cache.find(addr);
+    if (decoded == nullptr)
+    {
+      decodeBlock(addr);
+      decoded = cache.find(addr);
+    }
+
+    if (decoded == nullptr)
+    {
+      return cpu->readMemory(addr);
+    }
+
+    // The opcode read still takes its cycle
+    cpu->incrementCycleCount();
+    decodedAddress = addr;
+    return decoded->opcode;
+  }
+
+  // Decodes instructions from the address until the block ends with a
+  // change of control flow, at the end of the page, or where the following
+  // instructions are already decoded.
+  template <typename BusT>
+  void BasicExecutioner<BusT>::decodeBlock(uint16_t addr)
+  {
+    uint16_t pc = addr;
+    while (true)
+    {
+      const OperationType& operation = (*operations)[cpu->readMemoryWithoutCycle(pc)];
+
+      // Instructions reaching into the next page are not cached, as a write
+      // to that page would not invalidate them
+      if ((pc & 0xFF) + operation.length > 0xFF)
+      {
+        return;
+      }
+
+      BlockCache::DECODED& entry = cache.slot(pc);
+      entry.opcode = cpu->readMemoryWithoutCycle(pc);
+      entry.length = operation.length;
+      entry.cycles = operation.cycles;
+      for (uint8_t i = 0; i < operation.length; i++)
+      {
+        entry.operands[i] = cpu->readMemoryWithoutCycle(pc + 1 + i);
+      }
+
+      if (operation.mode == AddressMode::REL)
+      {
+        // Same as REL() followed by branchOperation()
+        uint16_t rel = (entry.operands[0] + 1) & 0xFFFF;
+        if (entry.operands[0] & 0x80)
+        {
+          rel |= 0xFF00;
+        }
+        entry.target = (pc + 1 + rel) & 0xFFFF;
+      }
+      entry.decoded = true;
+
+      if (endsBlock(entry.opcode))
+      {
+        return;
+      }
+
+      uint16_t next = pc + 1 + operation.length;
+      if ((next & 0xFF00) != (pc & 0xFF00) || cache.find(next) != nullptr)
+      {
+        return;
+      }
+      pc = next;
+    }
+  }
+
+  template <typename BusT>
+  bool BasicExecutioner<BusT>::endsBlock(uint8_t opcode)
+  {
+    switch ((*operations)[opcode].mnemonic)
+    {
+      case Mnemonic::JMP:
+      case Mnemonic::JSR:
+      case Mnemonic::RTS:
+      case Mnemonic::RTI:
+      case Mnemonic::BRK:
+      case Mnemonic::JAM:
+        return true;
+      default:
+        return ((*operations)[opcode].policy & BRANCH) != 0;
+    }
+  }
+
+  template <typename BusT>
+  inline uint8_t BasicExecutioner<BusT>::readOperand()
+  {
+    if (decoded != nullptr)
+    {
+      cpu->incrementCycleCount();
+      return decoded->operands[(cpu->getProgramCounter() - decodedAddress - 1) & 0x01];
+    }
+    return cpu->readMemory(cpu->getProgramCounter());
+  }
+
+  template <typename BusT>
+  uint32_t BasicExecutioner<BusT>::run(uint32_t instructions)
+  {
+    cpu->loadFlags();
+    uint32_t executed = runEngine(instructions);
+    cpu->syncFlags();
+    return executed;
+  }
+
+  template <typename BusT>
+  uint32_t BasicExecutioner<BusT>::runEngine(uint32_t instructions)
+  {
+    if (profile.isEnabled())
+    {
+      return runTable(instructions);
+    }
+
+    // The variant is only looked at once per run, the engines are
+    // instantiated for it
+    switch (variant)
+    {
+      case WDC65C02:
+        return runVariant<WDC65C02>(instructions);
+      case RICOH2A03:
+        return runVariant<RICOH2A03>(instructions);
+      case MOS6502:
+      default:
+        return runVariant<MOS6502>(instructions);
+    }
+  }
+
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  uint32_t BasicExecutioner<BusT>::runVariant(uint32_t instructions)
+  {
+    switch (dispatch)
+    {
+      case SWITCH:
+        return runSwitch<V>(instructions);
+      case THREADED:
+#ifdef THREADED_DISPATCH
+        return runThreaded<V, false>(instructions);
+#else
+        return runSwitch<V>(instructions);
+#endif
+      case SUPERINSTRUCTION:
+#ifdef THREADED_DISPATCH
+        return runThreaded<V, true>(instructions);
+#else
+        return runSwitch<V>(instructions);
+#endif
+      case TAILCALL:
+        return runTailCall<V>(instructions);
+      case JIT:
+#ifdef JIT_DISPATCH
+        // The generated code knows the page table of the Bus only
+        if constexpr (std::is_same_v<BusT, Bus>)
+        {
+          return runJit<V>(instructions);
+        }
+#endif
+        return runSwitch<V>(instructions);
+      case TABLE:
+      default:
+        return runTable(instructions);
+    }
+  }
+
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::execute()
+  {
+    return execute(cpu->opcode);
+  }
+
+  // An opcode with its addressing mode and operation fused into one function,
+  // so the compiler sees the whole instruction instead of two calls that talk
+  // through member variables. The handlers remain the implementation.
+  template <typename BusT>
+  template <typename BasicExecutioner<BusT>::ExecutionType Mode, typename BasicExecutioner<BusT>::ExecutionType Operation>
+  uint8_t BasicExecutioner<BusT>::Op()
+  {
+#ifdef LOGMODE
+    Logger::log()->info("ADDR MODE START    - OP {} {: >53}", getOperation(), cpu->reg);
+#endif
+
+    uint8_t addressModeCycles = (this->*Mode)();
+
+#ifdef LOGMODE
+    Logger::log()->info("ADDR MODE FINISHED - OP {} {: >53}", getOperation(), cpu->reg);
+    Logger::log()->info("OPERATION START    - OP {} {: >53}", getOperation(), cpu->reg);
+#endif
+
+    uint8_t operationCycles = (this->*Operation)();
+
+#ifdef LOGMODE
+    Logger::log()->info("OPERATION FINISHED - OP {} {: >53}", getOperation(), cpu->reg);
+#endif
+
+    // Both the addressing mode and the operation has to allow the page
+    // boundary penalty for it to apply
+    return (addressModeCycles & operationCycles);
+  }
+
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::execute(uint8_t op)
+  {
+    if (profile.isEnabled())
+    {
+      profile.record(op);
+    }
+    return ((*operations)[op].cycles + (this->*(*fusedOperations)[op])());
+  }
+
+  template <typename BusT>
+  std::string BasicExecutioner<BusT>::getAddressModeName()
+  {
+    return getAddressModeName(cpu->opcode);
+  }
+
+  template <typename BusT>
+  std::string BasicExecutioner<BusT>::getAddressModeName(uint8_t op)
+  {
+    return std::string((*operations)[op].addrmode.name);
+  }
+
+  template <typename BusT>
+  std::string BasicExecutioner<BusT>::getInstructionName()
+  {
+    return getInstructionName(cpu->opcode);
+  }
+
+  template <typename BusT>
+  std::string BasicExecutioner<BusT>::getInstructionName(uint8_t op)
+  {
+    return std::string((*operations)[op].operate.name);
+  }
+
+  template <typename BusT>
+  std::string BasicExecutioner<BusT>::getOperation()
+  {
+    return getOperation(cpu->opcode);
+  }
+
+  template <typename BusT>
+  std::string BasicExecutioner<BusT>::getOperation(uint8_t op)
+  {
+    return fmt::format("{}:{} [{:02X}]", (*operations)[op].operate.name, (*operations)[op].addrmode.name, op);
+  }
+
+  template <typename BusT>
+  ExecutionerBase::Mnemonic BasicExecutioner<BusT>::getMnemonic()
+  {
+    return getMnemonic(cpu->opcode);
+  }
+
+  template <typename BusT>
+  ExecutionerBase::Mnemonic BasicExecutioner<BusT>::getMnemonic(uint8_t op)
+  {
+    return (*operations)[op].mnemonic;
+  }
+
+  template <typename BusT>
+  ExecutionerBase::AddressMode BasicExecutioner<BusT>::getAddressMode()
+  {
+    return getAddressMode(cpu->opcode);
+  }
+
+  template <typename BusT>
+  ExecutionerBase::AddressMode BasicExecutioner<BusT>::getAddressMode(uint8_t op)
+  {
+    return (*operations)[op].mode;
+  }
+
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::getOperandLength(uint8_t op)
+  {
+    return (*operations)[op].length;
+  }
+
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::getCyclePolicy(uint8_t op)
+  {
+    return (*operations)[op].policy;
+  }
+
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::getInstructionCycles(uint8_t op, uint8_t extra)
+  {
+    // The indexed write cycle is part of the base cycles already
+    return (*operations)[op].cycles + extra - (((*operations)[op].policy & INDEXED_WRITE) ? 1 : 0);
+  }
+
+
+  // This function sources the data used by the instruction into 
+  // a convenient numeric variable. Some instructions dont have to 
+  // fetch data as the source is implied by the instruction. For example
+  // "INX" increments the X register. There is no additional data
+  // required. For all other addressing modes, the data resides at 
+  // the location held within addr_abs, so it is read from there. 
+  // Immediate adress mode exploits this slightly, as that has
+  // set addr_abs = pc + 1, so it fetches the data from the
+  // next byte for example "LDA $FF" just loads the accumulator with
+  // 256, i.e. no far reaching memory fetch is required. "fetched"
+  // is a variable global to the CPU, and is set by calling this 
+  // function. It also returns it for convenience.
+  // Adds the extra cycle of indexed addressing, as given by the cycle policy
+  // of the current opcode. Returns true if a cycle was added
+  template <typename BusT>
+  bool BasicExecutioner<BusT>::addPolicyCycles(bool pageCrossed)
+  {
+    uint8_t policy = (*operations)[cpu->opcode].policy;
+    uint8_t penalty = (pageCrossed & policy & PAGE_CROSS) | ((policy & INDEXED_WRITE) >> 1);
+    if (penalty)
+    {
+      cpu->addExtraCycle();
+    }
+    return penalty;
+  }
+
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::fetch()
+  {
+    AddressMode mode = getAddressMode();
+    if (mode == AddressMode::IMM && decoded != nullptr)
+    {
+      // The immediate operand is predecoded
+      cpu->incrementCycleCount();
+      cpu->fetched = decoded->operands[0];
+    }
+    else if (mode != AddressMode::ACC && mode != AddressMode::IMP)
+    {
+      cpu->fetched = cpu->readMemory(cpu->addr_abs);
+#ifdef DEBUG
+      Logger::log()->debug(
+        "{}: FETCHED 0x{:04X} FROM ${:04X} ",
+        getInstructionName(), cpu->fetched, cpu->addr_abs
+      );
+#endif
+    }
+    return cpu->fetched;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region ADDRESSING MODES
+// ADDRESSING MODES
+
+// The 6502 can address between 0x0000 - 0xFFFF. The high byte is often referred
+// to as the "page", and the low byte is the offset into that page. This implies
+// there are 256 pages, each containing 256 bytes.
+//
+// Several addressing modes have the potential to require an additional clock
+// cycle if they cross a page boundary. This is combined with several instructions
+// that enable this additional clock cycle. So each addressing function returns
+// a flag saying it has potential, as does each instruction. If both instruction
+// and address function return 1, then an additional clock cycle is required.
+
+// Address Mode: Accumulator
+// Operand is always AC
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ACC()
+  {
+    //cpu->readMemory(pc);
+    //cpu->incrementCycleCount();
+    cpu->fetched = cpu->getRegister(cpu->AC);
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} {: >75}",
+      getOperation(), cpu->reg
+    );
+#endif
+    return 0;
+  }
+
+  // Address Mode: Implied
+  // There is no additional data required for this instruction. The instruction
+  // does something very simple like like sets a status bit. However, we will
+  // target the accumulator, for instructions like PHA
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::IMP()
+  {
+    //fetched = a;
+    //cpu->incrementCycleCount();
+    cpu->fetched = 0x0;
+//#ifdef DEBUG
+//    Logger::log()->debug(
+//      "OP {} {: >75}",
+//      getOperation(), fetched, cpu->reg
+//    );
+//#endif
+    return 0;
+  }
+
+  // Address Mode: Immediate
+  // The instruction expects the next byte to be used as a value, so we'll prep
+  // the read address to point to the next byte
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::IMM()
+  {
+    cpu->addr_abs = cpu->getProgramCounter();
+    cpu->incrementProgramCounter();
+    //cpu->incrementCycleCount();
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} {: >57}",
+      getOperation(), cpu->addr_abs, cpu->reg
+    );
+#endif
+    return 0;
+  }
+
+  // Address Mode: Zero Page
+  // To save program bytes, zero page addressing allows you to absolutely address
+  // a location in first 0xFF bytes of address range. Clearly this only requires
+  // one byte instead of the usual two.
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ZP0()
+  {
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} {: >58}",
+      getOperation(), cpu->addr_abs, cpu->reg
+    );
+#endif
+
+    cpu->addr_abs = readOperand();
+
+    cpu->incrementProgramCounter();
+    cpu->addr_abs &= 0x00FF;
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} {: >58}",
+      getOperation(), cpu->addr_abs, cpu->reg
+    );
+#endif
+    return 0;
+  }
+
+  // Address Mode: Zero Page with X Offset
+  // Fundamentally the same as Zero Page addressing, but the contents of the X Register
+  // is added to the supplied single byte address. This is useful for iterating through
+  // ranges within the first page.
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ZPX()
+  {
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} {: >57}",
+      getOperation(), cpu->addr_abs, cpu->reg
+    );
+#endif
+
+    cpu->addr_abs = readOperand();
+    //cpu->readMemory(addr_abs);
+    cpu->incrementCycleCount();
+
+    cpu->addr_abs += cpu->getRegister(cpu->X);
+
+    cpu->incrementProgramCounter();
+    cpu->addr_abs &= 0x00FF;
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} {: >57}",
+      getOperation(), cpu->addr_abs, cpu->reg
+    );
+#endif
+    return 0;
+  }
+
+  // Address Mode: Zero Page with Y Offset
+  // Same as above but uses Y Register for offset
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ZPY()
+  {
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} {: >57}",
+      getOperation(), cpu->addr_abs, cpu->reg
+    );
+#endif
+    cpu->addr_abs = readOperand();
+    //cpu->readMemory(addr_abs);
+    cpu->incrementCycleCount();
+
+    cpu->addr_abs += cpu->getRegister(cpu->Y);
+
+    cpu->incrementProgramCounter();
+    cpu->addr_abs &= 0x00FF;
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} {: >57}",
+      getOperation(), cpu->addr_abs, cpu->reg
+    );
+#endif
+    return 0;
+  }
+
+  // Address Mode: Relative
+  // This address mode is exclusive to branch instructions. The address
+  // must reside within -128 to +127 of the branch instruction, i.e.
+  // you cant directly branch to any address in the addressable range.
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::REL()
+  {
+    cpu->addr_rel = readOperand();
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_rel: {:04X} {: >57}",
+      getOperation(), cpu->addr_rel, cpu->reg
+    );
+#endif
+
+    uint16_t a2 = (cpu->addr_rel + 1) & 0xFFFF;
+#ifdef LOGMODE
+    cpu->dumpRam(cpu->getProgramCounter());
+#endif
+    //cpu->incrementProgramCounter();
+    if (cpu->addr_rel & 0x80)
+    {
+#ifdef DEBUG
+      Logger::log()->debug(
+        "OP {} - addr_rel [PB]: {:04X} -> {:04X} {: >40}",
+        getOperation(), cpu->addr_rel, cpu->addr_rel | 0xFF00, cpu->reg
+      );
+#endif
+      //addr_rel = a2 - ((addr_rel ^ 0xFF) + 1);
+      //addr_rel |= 0xFF00;
+      cpu->addr_rel = (a2 | 0xFF00);
+      //cpu->incrementCycleCount();
+    }
+    else
+    {
+      cpu->addr_rel = a2;
+    }
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_rel: {:04X} {: >57}",
+      getOperation(), cpu->addr_rel, cpu->reg
+    );
+#endif
+    return 0;
+  }
+
+  // Address Mode: Absolute 
+  // A full 16-bit address is loaded and used
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ABS()
+  {
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} {: >57}",
+      getOperation().c_str(), cpu->addr_abs, cpu->reg
+    );
+#endif
+
+    uint16_t lo = readOperand();
+    cpu->incrementProgramCounter();
+
+    uint16_t hi = readOperand();
+    cpu->incrementProgramCounter();
+
+    cpu->addr_abs = (hi << 8) | lo;
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} HI:{:02X} LO:{:02X} {: >45}",
+      getOperation(), cpu->addr_abs, hi, lo, cpu->reg
+    );
+#endif
+    return 0;
+  }
+
+  // Address Mode: Absolute with X Offset
+  // Fundamentally the same as absolute addressing, but the contents of the X Register
+  // is added to the supplied two byte address. If the resulting address changes
+  // the page, an additional clock cycle is required
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ABX()
+  {
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} {: >57}",
+      getOperation(), cpu->addr_abs, cpu->reg
+    );
+#endif
+    uint16_t lo = readOperand();
+    cpu->incrementProgramCounter();
+
+    uint16_t hi = readOperand();
+    cpu->incrementProgramCounter();
+
+
+    cpu->addr_abs = (hi << 8) | lo;
+    cpu->addr_abs += cpu->getRegister(cpu->X);
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} HI:{:02X} LO:{:02X} {: >45}",
+      getOperation(), cpu->addr_abs, hi, lo, cpu->reg
+    );
+#endif
+
+    // Page boundary penalty or indexed write cycle, see CYCLEPOLICY
+    if (addPolicyCycles((cpu->addr_abs & 0xFF00) != (hi << 8)))
+    {
+#ifdef DEBUG
+      Logger::log()->debug(
+        "OP {} - addr_abs (Page Boundary): {:04X} HI:{:02X} LO:{:02X} {: >40}",
+        getOperation(), cpu->addr_abs, hi, lo, cpu->reg
+      );
+#endif
+    }
+    return 0;
+  }
+
+  // Address Mode: Absolute with Y Offset
+  // Fundamentally the same as absolute addressing, but the contents of the Y Register
+  // is added to the supplied two byte address. If the resulting address changes
+  // the page, an additional clock cycle is required
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ABY()
+  {
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} {: >57}",
+      getOperation(), cpu->addr_abs, cpu->reg
+    );
+#endif
+
+    uint16_t lo = readOperand();
+    cpu->incrementProgramCounter();
+
+    uint16_t hi = readOperand();
+    cpu->incrementProgramCounter();
+
+    cpu->addr_abs = (hi << 8) | lo;
+    cpu->addr_abs += cpu->getRegister(cpu->Y);
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} HI:{:02X} LO:{:02X} {: >45}",
+      getOperation(), cpu->addr_abs, hi, lo, cpu->reg
+    );
+#endif
+
+    // Page boundary penalty or indexed write cycle, see CYCLEPOLICY
+    if (addPolicyCycles((cpu->addr_abs & 0xFF00) != (hi << 8)))
+    {
+#ifdef DEBUG
+      Logger::log()->debug(
+        "OP {} - addr_abs (Page Boundary): {:04X} HI:{:02X} LO:{:02X} {: >40}",
+        getOperation(), cpu->addr_abs, hi, lo, cpu->reg
+      );
+#endif
+    }
+    return 0;
+  }
+
+  // Note: The next 3 address modes use indirection (aka Pointers!)
+
+  // Address Mode: Indirect
+  // The supplied 16-bit address is read to get the actual 16-bit address. This is
+  // instruction is unusual in that it has a bug in the hardware! To emulate its
+  // function accurately, we also need to emulate this bug. If the low byte of the
+  // supplied address is 0xFF, then to read the high byte of the actual address
+  // we need to cross a page boundary. This doesnt actually work on the chip as 
+  // designed, instead it wraps back around in the same page, yielding an 
+  // invalid actual address. The 65C02 fixes the bug, spending a cycle on it.
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  uint8_t BasicExecutioner<BusT>::IND()
+  {
+#ifdef DEBUG
+    Logger::log()->debug("OP {} {: >74}", getOperation(), cpu->reg);
+#endif
+
+    uint16_t ptr_lo = readOperand();
+    cpu->incrementProgramCounter();
+    uint16_t ptr_hi = readOperand();
+    cpu->incrementProgramCounter();
+
+    uint16_t ptr = (ptr_hi << 8) | ptr_lo;
+
+    if constexpr (V == WDC65C02)
+    {
+      cpu->incrementCycleCount();
+    }
+
+    // Simulate page boundary hardware bug in 6502 (fixed in 65C02)
+    // The indirect jump instruction does not increment the
+    // page address when the indirect pointer crosses a
+    // page boundary. JMP ($xxFF) will fetch the address
+    // from $xxFF and $xx00.
+    if (V != WDC65C02 && ptr_lo == 0x00FF)
+    {
+      cpu->addr_abs = (cpu->readMemory(ptr & 0xFF00) << 8) | cpu->readMemory(ptr + 0);
+#ifdef DEBUG
+      Logger::log()->debug(
+        "OP {} HW BUG - addr_abs: {:04X} PTR:{:04X} HI:{:02X} LO:{:02X} {: >40}",
+        getOperation(), cpu->addr_abs, ptr, 0x00, ptr_lo, cpu->reg
+      );
+#endif
+    }
+    else // Behave normally
+    {
+      cpu->addr_abs = (cpu->readMemory(ptr + 1) << 8) | cpu->readMemory(ptr + 0);
+#ifdef DEBUG
+      Logger::log()->debug(
+        "OP {} addr_abs: {:04X} PTR:{:04X} HI:{:02X} LO:{:02X} {: >40}",
+        getOperation(), cpu->addr_abs, ptr, ptr_hi, ptr_lo, cpu->reg
+      );
+#endif
+    }
+    return 0;
+  }
+
+  // Address Mode: Indirect X
+  // The supplied 8-bit address is offset by X Register to index
+  // a location in page 0x00. The actual 16-bit address is read 
+  // from this location
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::IZX()
+  {
+    uint16_t t = readOperand();
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - t: 0x{:02X} {: >64}",
+      getOperation(), t, cpu->reg
+    );
+#endif
+
+    cpu->incrementProgramCounter();
+    //cpu->readMemory(t);
+    cpu->incrementCycleCount();
+
+    uint8_t x = cpu->getRegister(cpu->X);
+    uint16_t lo = cpu->readMemory((uint16_t)(t + (uint16_t)(size_t)x) & 0x00FF);
+    uint16_t hi = cpu->readMemory((uint16_t)(t + (uint16_t)(size_t)x + 1) & 0x00FF);
+
+    cpu->addr_abs = (hi << 8) | lo;
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} HI:{:02X} LO:{:02X} {: >45}",
+      getOperation(), cpu->addr_abs, hi, lo, cpu->reg
+    );
+#endif
+    return 0;
+  }
+
+  // Address Mode: Indirect Y
+  // The supplied 8-bit address indexes a location in page 0x00. From 
+  // here the actual 16-bit address is read, and the contents of
+  // Y Register is added to it to offset it. If the offset causes a
+  // change in page then an additional clock cycle is required.
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::IZY()
+  {
+    uint16_t t = readOperand();
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - t: 0x{:02X} {: >64}",
+      getOperation(), t, cpu->reg
+    );
+#endif
+
+    cpu->incrementProgramCounter();
+    //cpu->incrementCycleCount();
+
+    uint16_t lo = cpu->readMemory(t & 0x00FF);
+    uint16_t hi = cpu->readMemory((t + 1) & 0x00FF);
+
+    cpu->addr_abs = (hi << 8) | lo;
+    cpu->addr_abs += cpu->getRegister(cpu->Y);
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} HI:{:02X} LO:{:02X} {: >45}",
+      getOperation(), cpu->addr_abs, hi, lo, cpu->reg
+    );
+#endif
+
+    // Page boundary penalty or indexed write cycle, see CYCLEPOLICY
+    if (addPolicyCycles((cpu->addr_abs & 0xFF00) != (hi << 8)))
+    {
+#ifdef DEBUG
+      Logger::log()->debug(
+        "OP {} - addr_abs (Page Boundary): {:04X} HI:{:02X} LO:{:02X} {: >40}",
+        getOperation(), cpu->addr_abs, hi, lo, cpu->reg
+      );
+#endif
+    }
+    return 0;
+  }
+
+  // Address Mode: Zero Page Indirect (65C02)
+  // As Indirect Y, without adding the Y Register. The actual 16-bit address
+  // is read from the location in page 0x00
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::IZP()
+  {
+    uint16_t t = readOperand();
+    cpu->incrementProgramCounter();
+
+    uint16_t lo = cpu->readMemory(t & 0x00FF);
+    uint16_t hi = cpu->readMemory((t + 1) & 0x00FF);
+
+    cpu->addr_abs = (hi << 8) | lo;
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} HI:{:02X} LO:{:02X} {: >45}",
+      getOperation(), cpu->addr_abs, hi, lo, cpu->reg
+    );
+#endif
+    return 0;
+  }
+
+  // Address Mode: Absolute Indexed Indirect (65C02)
+  // The X Register is added to the supplied 16-bit address, and the actual
+  // 16-bit address is read from there. Only used by JMP
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::IAX()
+  {
+    uint16_t lo = readOperand();
+    cpu->incrementProgramCounter();
+
+    uint16_t hi = readOperand();
+    cpu->incrementProgramCounter();
+
+    uint16_t ptr = ((hi << 8) | lo) + cpu->getRegister(cpu->X);
+    //cpu->readMemory(pc);
+    cpu->incrementCycleCount();
+
+    cpu->addr_abs = (cpu->readMemory(ptr + 1) << 8) | cpu->readMemory(ptr + 0);
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} addr_abs: {:04X} PTR:{:04X} HI:{:02X} LO:{:02X} {: >40}",
+      getOperation(), cpu->addr_abs, ptr, hi, lo, cpu->reg
+    );
+#endif
+    return 0;
+  }
+#pragma endregion ADDRESSING MODES
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region COMMON OPERATION
+
+// Performs the different branch operations.
+// Based on performBranch is true or not
+  template <typename BusT>
+  void BasicExecutioner<BusT>::branchOperation(bool performBranch)
+  {
+    if (performBranch == false)
+    {
+#ifdef DEBUG
+      Logger::log()->debug(
+        "OP {} - {:02X} - Not Branching",
+        getOperation(), cpu->opcode
+      );
+#endif
+      //cpu->incrementCycleCount();
+      cpu->incrementProgramCounter();
+      return;
+    }
+
+    uint16_t pc = cpu->getProgramCounter();
+
+    cpu->addr_abs = (decoded != nullptr) ? decoded->target : (pc + cpu->addr_rel) & 0xFFFF;
+
+#ifdef DEBUG
+    Logger::log()->debug(
+      "OP {} - addr_abs: {:04X} - addr_rel: {:04X} - PC: {:04X} - REL + PC: {:06X}",
+      getOperation(), cpu->addr_abs, cpu->addr_rel, pc, (pc + cpu->addr_rel)
+    );
+#endif
+
+    // A taken branch costs one cycle, and one more if it crosses a page
+    bool pageCrossed = (cpu->addr_abs & 0xFF00) != (pc & 0xFF00);
+    uint8_t penalty = (((*operations)[cpu->opcode].policy & BRANCH) >> 2) << pageCrossed;
+#ifdef DEBUG
+    if (pageCrossed)
+    {
+      Logger::log()->debug(
+        "OP {} [PB] - addr_abs: {:04X} - addr_rel: {:04X} - PC: {:04X}",
+        getOperation(), cpu->addr_abs, cpu->addr_rel, pc
+      );
+    }
+#endif
+
+    //pc = addr_abs & 0xFFFF;
+    cpu->setProgramCounter(cpu->addr_abs);
+    //cpu->readMemory(addr_abs);
+    for (uint8_t i = 0; i < penalty; i++)
+    {
+      cpu->addExtraCycle();
+    }
+
+    if (cpu->getIdleDetection() && cpu->addr_abs <= pc)
+    {
+      cpu->loopBack(cpu->addr_abs, pc + 1);
+    }
+  }
+
+
+  // The BRK routine. Called when a BRK occurs.
+  // Also called from NMI/IRQ operations
+  template <typename BusT>
+  void BasicExecutioner<BusT>::breakOperation(bool isBreak, uint16_t vector)
+  {
+    cpu->incrementProgramCounter();
+    cpu->incrementCycleCount();
+
+    uint16_t pc = cpu->getProgramCounter();
+#ifdef LOGMODE
+    cpu->dumpRam(cpu->getProgramCounter()-1);
+#endif
+
+    cpu->PokeStack((pc >> 8) & 0x00FF);
+    cpu->decrementStackPointer();
+    cpu->incrementCycleCount();
+
+    cpu->PokeStack(pc & 0x00FF);
+    cpu->decrementStackPointer();
+    cpu->incrementCycleCount();
+
+    if (isBreak)
+    {
+      cpu->SetFlag(cpu->B, true);
+    }
+    else
+    {
+      cpu->SetFlag(cpu->B, false);
+    }
+
+    cpu->PokeStack(cpu->getRegister(cpu->SR));
+    cpu->decrementStackPointer();
+    cpu->incrementCycleCount();
+
+    cpu->SetFlag(cpu->I, true);
+    // The 65C02 leaves decimal mode on interrupts
+    if (variant == WDC65C02)
+    {
+      cpu->SetFlag(cpu->D, false);
+    }
+
+    uint16_t newPc = (cpu->readMemory(vector + 1) << 8) | cpu->readMemory(vector);
+
+//#ifdef DEBUG
+//    Logger::log()->debug("OP {} - NEW PC: {:04X} {: >59}", getOperation(), newPc, cpu->reg);
+//#endif
+
+#ifdef LOGMODE
+    cpu->DumpStackAtPointer();
+#endif
+
+    cpu->setProgramCounter(newPc);
+
+    cpu->_previousInterrupt = false;
+  }
+#pragma endregion COMMON OPERATION
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region INSTRUCTION IMPLEMENTATIONS
+// INSTRUCTION IMPLEMENTATIONS
+
+// Note: Ive started with the two most complicated instructions to emulate, which
+// ironically is addition and subtraction! Ive tried to include a detailed 
+// explanation as to why they are so complex, yet so fundamental. Im also NOT
+// going to do this through the explanation of 1 and 2's complement.
+
+// Instruction: Add with Carry In
+// Function:    A = A + M + C
+// Flags Out:   C, V, N, Z
+//
+// Explanation:
+// The purpose of this function is to add a value to the accumulator and a carry bit. If
+// the result is > 255 there is an overflow setting the carry bit. Ths allows you to
+// chain together ADC instructions to add numbers larger than 8-bits. This in itself is
+// simple, however the 6502 supports the concepts of Negativity/Positivity and Signed Overflow.
+//
+// 10000100 = 128 + 4 = 132 in normal circumstances, we know this as unsigned and it allows
+// us to represent numbers between 0 and 255 (given 8 bits). The 6502 can also interpret 
+// this word as something else if we assume those 8 bits represent the range -128 to +127,
+// i.e. it has become signed.
+//
+// Since 132 > 127, it effectively wraps around, through -128, to -124. This wraparound is
+// called overflow, and this is a useful to know as it indicates that the calculation has
+// gone outside the permissable range, and therefore no longer makes numeric sense.
+//
+// Note the implementation of ADD is the same in binary, this is just about how the numbers
+// are represented, so the word 10000100 can be both -124 and 132 depending upon the 
+// context the programming is using it in. We can prove this!
+//
+//  10000100 =  132  or  -124
+// +00010001 = + 17      + 17
+//  ========    ===       ===     See, both are valid additions, but our interpretation of
+//  10010101 =  149  or  -107     the context changes the value, not the hardware!
+//
+// In principle under the -128 to 127 range:
+// 10000000 = -128, 11111111 = -1, 00000000 = 0, 00000000 = +1, 01111111 = +127
+// therefore negative numbers have the most significant set, positive numbers do not
+//
+// To assist us, the 6502 can set the overflow flag, if the result of the addition has
+// wrapped around. V <- ~(A^M) & A^(A+M+C) :D lol, let's work out why!
+//
+// Let's suppose we have A = 30, M = 10 and C = 0
+//          A = 30 = 00011110
+//          M = 10 = 00001010+
+//     RESULT = 40 = 00101000
+//
+// Here we have not gone out of range. The resulting significant bit has not changed.
+// So let's make a truth table to understand when overflow has occurred. Here I take
+// the MSB of each component, where R is RESULT.
+//
+// A  M  R | V | A^R | A^M |~(A^M) | 
+// 0  0  0 | 0 |  0  |  0  |   1   |
+// 0  0  1 | 1 |  1  |  0  |   1   |
+// 0  1  0 | 0 |  0  |  1  |   0   |
+// 0  1  1 | 0 |  1  |  1  |   0   |  so V = ~(A^M) & (A^R)
+// 1  0  0 | 0 |  1  |  1  |   0   |
+// 1  0  1 | 0 |  0  |  1  |   0   |
+// 1  1  0 | 1 |  1  |  0  |   1   |
+// 1  1  1 | 0 |  0  |  0  |   1   |
+//
+// We can see how the above equation calculates V, based on A, M and R. V was chosen
+// based on the following hypothesis:
+//       Positive Number + Positive Number = Negative Result -> Overflow
+//       Negative Number + Negative Number = Positive Result -> Overflow
+//       Positive Number + Negative Number = Either Result -> Cannot Overflow
+//       Positive Number + Positive Number = Positive Result -> OK! No Overflow
+//       Negative Number + Negative Number = Negative Result -> OK! NO Overflow
+//
+// The 2A03 has no decimal mode, and the 65C02 takes a cycle more in it.
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  uint8_t BasicExecutioner<BusT>::ADC()
+  {
+    // Grab the data that we are adding to the accumulator
+    fetch();
+
+    // The sum and the flags it sets are looked up, see Alu.hpp for how
+    // they are computed
+    uint32_t index = Alu::index(cpu->getRegister(cpu->AC), cpu->fetched, cpu->GetFlag(cpu->C));
+    uint16_t result = Alu::adc[index];
+    uint8_t  flags = Alu::BINARY_FLAGS;
+#ifdef DECIMAL_MODE
+    if (V != RICOH2A03 && cpu->GetFlag(cpu->D))
+    {
+      result = Alu::adcDecimal[index];
+      flags = Alu::DECIMAL_FLAGS;
+      if constexpr (V == WDC65C02)
+      {
+        cpu->addExtraCycle();
+      }
+    }
+#endif
+    cpu->SetFlags(flags, result >> 8);
+
+    // Load the result into the accumulator (it's 8-bit dont forget!)
+    cpu->setRegister(cpu->AC, (uint8_t)(result & 0x00FF));
+
+    // This instruction has the potential to require an additional clock cycle
+    return 1;
+  }
+
+
+  // Instruction: Subtraction with Borrow In
+  // Function:    A = A - M - (1 - C)
+  // Flags Out:   C, V, N, Z
+  //
+  // Explanation:
+  // Given the explanation for ADC above, we can reorganise our data
+  // to use the same computation for addition, for subtraction by multiplying
+  // the data by -1, i.e. make it negative
+  //
+  // A = A - M - (1 - C)  ->  A = A + -1 * (M - (1 - C))  ->  A = A + (-M + 1 + C)
+  //
+  // To make a signed positive number negative, we can invert the bits and add 1
+  // (OK, I lied, a little bit of 1 and 2s complement :P)
+  //
+  //  5 = 00000101
+  // -5 = 11111010 + 00000001 = 11111011 (or 251 in our 0 to 255 range)
+  //
+  // The range is actually unimportant, because if I take the value 15, and add 251
+  // to it, given we wrap around at 256, the result is 10, so it has effectively 
+  // subtracted 5, which was the original intention. (15 + 251) % 256 = 10
+  //
+  // Note that the equation above used (1-C), but this got converted to + 1 + C.
+  // This means we already have the +1, so all we need to do is invert the bits
+  // of M, the data(!) therfore we can simply add, exactly the same way we did 
+  // before.
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  uint8_t BasicExecutioner<BusT>::SBC()
+  {
+    fetch();
+
+#ifdef LOGMODE
+    Logger::log()->info("OP {} - REGISTERS: {: >61}", getOperation(), cpu->reg);
+#endif
+
+    // Notice this is exactly the same as addition of the inverted data!
+    uint8_t  current = cpu->getRegister(cpu->AC);
+    uint16_t result = Alu::adc[Alu::index(current, cpu->fetched ^ 0xFF, cpu->GetFlag(cpu->C))];
+    uint8_t  flags = Alu::BINARY_FLAGS;
+#ifdef DECIMAL_MODE
+    if (V != RICOH2A03 && cpu->GetFlag(cpu->D))
+    {
+      result = Alu::sbcDecimal[Alu::index(current, cpu->fetched, cpu->GetFlag(cpu->C))];
+      flags = Alu::DECIMAL_FLAGS;
+      if constexpr (V == WDC65C02)
+      {
+        cpu->addExtraCycle();
+      }
+    }
+#endif
+    cpu->SetFlags(flags, result >> 8);
+    cpu->setRegister(cpu->AC, (uint8_t)(result & 0x00FF));
+
+    return 1;
+  }
+
+
+  // OK! Complicated operations are done! the following are much simpler
+  // and conventional. The typical order of events is:
+  // 1) Fetch the data you are working with
+  // 2) Perform calculation
+  // 3) Store the result in desired place
+  // 4) Set Flags of the status register
+  // 5) Return if instruction has potential to require additional 
+  //    clock cycle
+
+  // Instruction: Bitwise Logic AND
+  // Function:    A = A & M
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::AND()
+  {
+    fetch();
+    uint8_t value = (cpu->getRegister(cpu->AC) & cpu->fetched);
+    cpu->setRegister(cpu->AC, value);
+    cpu->SetNZ(value);
+    return 1;
+  }
+
+
+  // Instruction: Arithmetic Shift Left
+  // Function:    A = C <- (A << 1) <- 0
+  // Flags Out:   N, Z, C
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ASL()
+  {
+    fetch();
+
+    if (getAddressMode() == AddressMode::ACC)
+    {
+      cpu->incrementCycleCount();
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, cpu->fetched & 0x00FF);
+    }
+
+    uint16_t value = (uint16_t)cpu->fetched << 1;
+    cpu->SetFlag(cpu->C, (value & 0xFF00) > 0);
+    cpu->SetNZ(value & 0xFF);
+
+    if (getAddressMode() == AddressMode::ACC)
+    {
+      //a = (uint8_t) (value & 0x00FF);
+      cpu->setRegister(cpu->AC, (uint8_t)(value & 0x00FF));
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, (uint8_t)(value & 0x00FF));
+    }
+
+    return 0;
+  }
+
+
+  // Instruction: Branch if Carry Clear
+  // Function:    if(C == 0) pc = address 
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BCC()
+  {
+    branchOperation(cpu->GetFlag(cpu->C) == 0);
+    return 0;
+  }
+
+
+  // Instruction: Branch if Carry Set
+  // Function:    if(C == 1) pc = address
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BCS()
+  {
+    branchOperation(cpu->GetFlag(cpu->C) == 1);
+    return 0;
+  }
+
+
+  // Instruction: Branch if Equal
+  // Function:    if(Z == 1) pc = address
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BEQ()
+  {
+    branchOperation(cpu->GetFlag(cpu->Z) == 1);
+    return 0;
+  }
+
+
+  // Instruction: Test Bits in Memory with Accumulator
+  // Function:    A & M, M7 -> N, M6 -> V
+  // Flags Out:   N, Z, V
+  // Note:        The immediate BIT of the 65C02 only sets Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BIT()
+  {
+    fetch();
+    //uint8_t value = a & fetched;
+    uint8_t value = (cpu->getRegister(cpu->AC) & cpu->fetched);
+
+    if (getAddressMode() == AddressMode::IMM)
+    {
+      cpu->SetFlag(cpu->Z, value == 0x00);
+      return 0;
+    }
+
+    cpu->SetNZ(cpu->fetched, value);
+    cpu->SetFlag(cpu->V, cpu->fetched & (1 << 6));
+    return 0;
+  }
+
+
+  // Instruction: Branch if Negative
+  // Function:    if(N == 1) pc = address
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BMI()
+  {
+    branchOperation(cpu->GetFlag(cpu->N) == 1);
+    return 0;
+  }
+
+
+  // Instruction: Branch if Not Equal
+  // Function:    if(Z == 0) pc = address
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BNE()
+  {
+    branchOperation(cpu->GetFlag(cpu->Z) == 0);
+    return 0;
+  }
+
+
+  // Instruction: Branch if Positive
+  // Function:    if(N == 0) pc = address
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BPL()
+  {
+    branchOperation(cpu->GetFlag(cpu->N) == 0);
+    return 0;
+  }
+
+
+  // Instruction: Break
+  // Function:    Program Sourced Interrupt
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BRK()
+  {
+    breakOperation(true, 0xFFFE);
+    return 0;
+  }
+
+
+  // Instruction: Branch if Overflow Clear
+  // Function:    if(V == 0) pc = address
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BVC()
+  {
+    branchOperation(cpu->GetFlag(cpu->V) == 0);
+    return 0;
+  }
+
+
+  // Instruction: Branch if Overflow Set
+  // Function:    if(V == 1) pc = address
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BVS()
+  {
+    branchOperation(cpu->GetFlag(cpu->V) == 1);
+    return 0;
+  }
+
+
+  // Instruction: Clear Carry Flag
+  // Function:    C = 0
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::CLC()
+  {
+    cpu->SetFlag(cpu->C, false);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Clear Decimal Flag
+  // Function:    D = 0
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::CLD()
+  {
+    cpu->SetFlag(cpu->D, false);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Disable Interrupts / Clear Interrupt Flag
+  // Function:    I = 0
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::CLI()
+  {
+    cpu->SetFlag(cpu->I, false);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Clear Overflow Flag
+  // Function:    V = 0
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::CLV()
+  {
+    cpu->SetFlag(cpu->V, false);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+  // Instruction: Compare Accumulator
+  // Function:    C <- A >= M      Z <- (A - M) == 0
+  // Flags Out:   N, C, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::CMP()
+  {
+    fetch();
+    //uint8_t value = (uint16_t)a - (uint16_t)fetched;
+    uint8_t value = (cpu->getRegister(cpu->AC) - cpu->fetched);
+    cpu->SetFlag(cpu->C, cpu->getRegister(cpu->AC) >= cpu->fetched);
+    cpu->SetNZ(value & 0xFF);
+    return 1;
+  }
+
+
+  // Instruction: Compare X Register
+  // Function:    C <- X >= M      Z <- (X - M) == 0
+  // Flags Out:   N, C, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::CPX()
+  {
+    fetch();
+    //uint8_t value = (uint16_t)x - (uint16_t)fetched;
+    uint8_t value = (cpu->getRegister(cpu->X) - cpu->fetched);
+    cpu->SetFlag(cpu->C, cpu->getRegister(cpu->X) >= cpu->fetched);
+    cpu->SetNZ(value & 0xFF);
+    return 0;
+  }
+
+
+  // Instruction: Compare Y Register
+  // Function:    C <- Y >= M      Z <- (Y - M) == 0
+  // Flags Out:   N, C, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::CPY()
+  {
+    fetch();
+    //uint16_t value = (uint16_t)y - (uint16_t)fetched;
+    uint8_t value = (cpu->getRegister(cpu->Y) - cpu->fetched);
+    cpu->SetFlag(cpu->C, cpu->getRegister(cpu->Y) >= cpu->fetched);
+    cpu->SetNZ(value & 0xFF);
+    return 0;
+  }
+
+
+  // Instruction: Decrement Value at Memory Location
+  // Function:    M = M - 1
+  // Flags Out:   N, Z
+  // Note:        The 65C02 can decrement the accumulator
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::DEC()
+  {
+    fetch();
+
+    if (getAddressMode() == AddressMode::ACC)
+    {
+      cpu->incrementCycleCount();
+      uint8_t value = cpu->fetched - 1;
+      cpu->setRegister(cpu->AC, value);
+      cpu->SetNZ(value);
+      return 0;
+    }
+
+    cpu->writeMemory(cpu->addr_abs, cpu->fetched & 0x00FF);
+    cpu->temp = cpu->fetched - 1;
+    cpu->SetNZ(cpu->temp & 0xFF);
+
+    cpu->writeMemory(cpu->addr_abs, cpu->temp & 0x00FF);
+
+
+    return 0;
+  }
+
+
+  // Instruction: Decrement X Register
+  // Function:    X = X - 1
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::DEX()
+  {
+    //temp = x - 1;
+    //x = temp & 0x00FF;
+    //cpu->SetFlag(cpu->Z, (temp & 0x00FF) == 0x0000);
+    //cpu->SetFlag(cpu->N, temp & 0x0080);
+
+    uint8_t value = cpu->getRegister(cpu->X);
+    --value;
+    cpu->setRegister(cpu->X, value);
+    cpu->SetNZ(value & 0xFF);
+
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Decrement Y Register
+  // Function:    Y = Y - 1
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::DEY()
+  {
+    //temp = y - 1;
+    //y = temp & 0x00FF;
+    //cpu->SetFlag(cpu->Z, (temp & 0x00FF) == 0x0000);
+    //cpu->SetFlag(cpu->N, temp & 0x0080);
+
+    uint8_t value = cpu->getRegister(cpu->Y);
+    --value;
+    cpu->setRegister(cpu->Y, value);
+    cpu->SetNZ(value & 0xFF);
+
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Bitwise Logic XOR
+  // Function:    A = A xor M
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::EOR()
+  {
+    fetch();
+    //a = a ^ fetched;
+    //cpu->SetFlag(cpu->Z, a == 0x00);
+    //cpu->SetFlag(cpu->N, a & 0x80);
+
+    uint8_t value = cpu->getRegister(cpu->AC) ^ cpu->fetched;
+    cpu->setRegister(cpu->AC, value);
+    cpu->SetNZ(value & 0xFF);
+
+    return 1;
+  }
+
+
+  // Instruction: Increment Value at Memory Location
+  // Function:    M = M + 1
+  // Flags Out:   N, Z
+  // Note:        The 65C02 can increment the accumulator
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::INC()
+  {
+    fetch();
+
+    if (getAddressMode() == AddressMode::ACC)
+    {
+      cpu->incrementCycleCount();
+      uint8_t value = cpu->fetched + 1;
+      cpu->setRegister(cpu->AC, value);
+      cpu->SetNZ(value);
+      return 0;
+    }
+
+    cpu->writeMemory(cpu->addr_abs, cpu->fetched & 0x00FF);
+    cpu->temp = cpu->fetched + 1;
+
+    cpu->SetNZ(cpu->temp & 0xFF);
+
+    cpu->writeMemory(cpu->addr_abs, cpu->temp & 0x00FF);
+
+
+    return 0;
+  }
+
+
+  // Instruction: Increment X Register
+  // Function:    X = X + 1
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::INX()
+  {
+    //temp = x + 1;
+    //x = temp & 0x00FF;
+    //cpu->SetFlag(cpu->Z, (temp & 0x00FF) == 0x0000);
+    //cpu->SetFlag(cpu->N, temp & 0x0080);
+
+    uint8_t value = cpu->getRegister(cpu->X);
+    ++value;
+    cpu->setRegister(cpu->X, value);
+    cpu->SetNZ(value & 0xFF);
+
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Increment Y Register
+  // Function:    Y = Y + 1
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::INY()
+  {
+    //temp = y + 1;
+    //y = temp & 0x00FF;
+    //cpu->SetFlag(cpu->Z, (temp & 0x00FF) == 0x0000);
+    //cpu->SetFlag(cpu->N, temp & 0x0080);
+
+    uint8_t value = cpu->getRegister(cpu->Y);
+    ++value;
+    cpu->setRegister(cpu->Y, value);
+    cpu->SetNZ(value & 0xFF);
+
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Jump To Location
+  // Function:    pc = address
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::JMP()
+  {
+    uint16_t pc = cpu->getProgramCounter();
+
+    //pc = addr_abs;
+    cpu->setProgramCounter(cpu->addr_abs);
+
+    if (cpu->getIdleDetection() && cpu->addr_abs < pc && (*operations)[cpu->opcode].mode == AddressMode::ABS)
+    {
+      cpu->loopBack(cpu->addr_abs, pc);
+    }
+    return 0;
+  }
+
+
+  // Instruction: Jump To Sub-Routine
+  // Function:    Push current pc to stack, pc = address
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::JSR()
+  {
+    cpu->incrementCycleCount();
+    cpu->decrementProgramCounter();
+
+    uint16_t pc = cpu->getProgramCounter();
+
+    cpu->PokeStack((pc >> 8) & 0x00FF);
+    cpu->incrementCycleCount();
+    cpu->decrementStackPointer();
+
+    cpu->PushStack(pc & 0x00FF);
+
+    cpu->setProgramCounter(cpu->addr_abs);
+    return 0;
+  }
+
+
+  // Instruction: Load The Accumulator
+  // Function:    A = M
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::LDA()
+  {
+    fetch();
+
+    //a = fetched;
+    //cpu->SetFlag(cpu->Z, a == 0x00);
+    //cpu->SetFlag(cpu->N, a & 0x80);
+
+    cpu->setRegister(cpu->AC, cpu->fetched);
+    cpu->SetNZ(cpu->fetched);
+    return 1;
+  }
+
+
+  // Instruction: Load The X Register
+  // Function:    X = M
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::LDX()
+  {
+    fetch();
+    //x = fetched;
+    //cpu->SetFlag(cpu->Z, x == 0x00);
+    //cpu->SetFlag(cpu->N, x & 0x80);
+
+    cpu->setRegister(cpu->X, cpu->fetched);
+    cpu->SetNZ(cpu->fetched);
+    return 1;
+  }
+
+
+  // Instruction: Load The Y Register
+  // Function:    Y = M
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::LDY()
+  {
+    fetch();
+
+    //y = fetched;
+    //cpu->SetFlag(cpu->Z, y == 0x00);
+    //cpu->SetFlag(cpu->N, y & 0x80);
+
+    cpu->setRegister(cpu->Y, cpu->fetched);
+    cpu->SetNZ(cpu->fetched);
+    return 1;
+  }
+
+
+  // Instruction: Logical Shift Right
+  // Function:    A = C <- (A << 1) <- 0
+  // Flags Out:   N=0, Z, C
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::LSR()
+  {
+    fetch();
+
+    if (getAddressMode() == AddressMode::ACC)
+    {
+      cpu->incrementCycleCount();
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, cpu->fetched & 0x00FF);
+    }
+
+    cpu->SetFlag(cpu->C, cpu->fetched & 0x0001);
+    cpu->temp = cpu->fetched >> 1;
+    cpu->SetNZ(cpu->temp & 0xFF);
+
+
+    uint8_t value = cpu->temp & 0x00FF;
+
+    if (getAddressMode() == AddressMode::ACC)
+    {
+      cpu->setRegister(cpu->AC, value);
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, value);
+    }
+
+    return 0;
+  }
+
+
+  // Instruction: No Operation
+  // Function:    -
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::NOP()
+  {
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Bitwise Logic OR
+  // Function:    A = A | M
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ORA()
+  {
+    fetch();
+    //a = a | fetched;
+    //cpu->SetFlag(cpu->Z, a == 0x00);
+    //cpu->SetFlag(cpu->N, a & 0x80);
+
+    uint8_t value = cpu->getRegister(cpu->AC) | cpu->fetched;
+    cpu->setRegister(cpu->AC, value);
+    cpu->SetNZ(value);
+    return 1;
+  }
+
+
+  // Instruction: Push Accumulator to Stack
+  // Function:    A -> stack
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::PHA()
+  {
+    //cpu->PushStack(a);
+    uint8_t ac = cpu->getRegister(cpu->AC);
+    cpu->PushStack(ac);
+    cpu->incrementCycleCount();
+    Logger::log()->debug("OP {} - newSR: {} {: >56}", getOperation(), cpu->DecodeFlag(ac), cpu->reg);
+    return 0;
+  }
+
+
+  // Instruction: Push Status Register to Stack
+  // Function:    status -> stack
+  // Note:        Break flag is set to 1 before push
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::PHP()
+  {
+    uint8_t status = cpu->getRegister(cpu->SR) | cpu->B | cpu->U;
+
+#ifdef DEBUG
+    Logger::log()->debug("OP {} - GOT SR: {} {: >64}", getOperation(), cpu->DecodeFlag(status), cpu->getRegister(cpu->SR));
+#endif
+    cpu->PushStack(status);
+    cpu->incrementCycleCount();
+#ifdef DEBUG
+    cpu->DumpStackAtPointer();
+#endif
+    return 0;
+  }
+
+
+  // Instruction: Pop Accumulator off Stack
+  // Function:    A <- stack
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::PLA()
+  {
+    //stkp++;
+    //cpu->incrementCycleCount();
+    //a = cpu->PopStack();
+    uint8_t value = cpu->PopStack();
+    cpu->incrementCycleCount();
+    cpu->setRegister(cpu->AC, value);
+    cpu->SetNZ(value);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Pop Status Register off Stack
+  // Function:    Status <- stack
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::PLP()
+  {
+    //stkp++;
+    //cpu->incrementStackPointer();
+    //cpu->incrementCycleCount();
+    //status = cpu->PeekStack();
+
+    //cpu->setRegister(cpu->SR, cpu->PeekStack());
+    cpu->setRegister(cpu->SR, cpu->PopStack());
+    cpu->incrementCycleCount();
+
+    //cpu->incrementCycleCount();
+    cpu->SetFlag(cpu->U, 1);
+    cpu->incrementCycleCount();
+
+    return 0;
+  }
+
+
+  // Instruction: Rotate Left
+  // Function:    (C << 1)
+  // Flags Out:    N, Z, C
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ROL()
+  {
+    fetch();
+
+    if (getAddressMode() == AddressMode::ACC)
+    {
+      cpu->incrementCycleCount();
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, cpu->fetched & 0x00FF);
+    }
+
+    cpu->temp = (uint16_t)(cpu->fetched << 1) | cpu->GetFlag(cpu->C);
+    cpu->SetFlag(cpu->C, cpu->temp & 0xFF00);
+    cpu->SetNZ(cpu->temp & 0xFF);
+
+    if (getAddressMode() == AddressMode::ACC)
+    {
+      cpu->setRegister(cpu->AC, (uint8_t)(cpu->temp & 0x00FF));
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, cpu->temp & 0x00FF);
+    }
+
+
+    return 0;
+  }
+
+
+  // Instruction: Rotate Right
+  // Function:    (C >> 1)
+  // Flags Out:    N, Z, C
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ROR()
+  {
+    fetch();
+
+    if (getAddressMode() == AddressMode::ACC)
+    {
+      cpu->incrementCycleCount();
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, cpu->fetched & 0x00FF);
+    }
+
+    cpu->temp = (uint16_t)(cpu->GetFlag(cpu->C) << 7) | (cpu->fetched >> 1);
+    cpu->SetFlag(cpu->C, cpu->fetched & 0x01);
+    cpu->SetNZ(cpu->temp & 0xFF);
+
+    if (getAddressMode() == AddressMode::ACC)
+    {
+      cpu->setRegister(cpu->AC, (uint8_t)(cpu->temp & 0x00FF));
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, cpu->temp & 0x00FF);
+    }
+
+
+    return 0;
+  }
+
+
+  // Instruction: Return from Interrupt
+  // Function:    Pull SR, Pull PC
+  // Flags Out:    From Stack
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::RTI()
+  {
+#ifdef DEBUG
+    cpu->DumpStack();
+    Logger::log()->debug("OP {} - {: >50}", getOperation(), cpu->reg);
+#endif
+
+    cpu->incrementCycleCount();
+
+    cpu->incrementStackPointer();
+    cpu->incrementCycleCount();
+
+#ifdef DEBUG
+    cpu->DumpStackAtPointer();
+    Logger::log()->debug("OP {} - {: >50}", getOperation(), cpu->reg);
+#endif
+
+    uint8_t newSR = cpu->PeekStack();
+#ifdef DEBUG
+    cpu->DumpStackAtPointer();
+    Logger::log()->debug("OP {} - newSR: 0x{:02X} {} {: >50}", getOperation(), newSR, cpu->DecodeFlag(newSR), cpu->reg);
+#endif
+    //cpu->incrementStackPointer();
+    cpu->incrementCycleCount();
+
+    cpu->setRegister(cpu->SR, newSR & ~cpu->B & ~cpu->U);
+
+#ifdef DEBUG
+    cpu->DumpStackAtPointer();
+    Logger::log()->debug("OP {} - SR SET {: >74}", getOperation(), cpu->getRegister(cpu->SR));
+#endif
+
+    uint16_t pcLo = cpu->PopStack();
+
+    cpu->incrementStackPointer();
+    uint16_t pcHi = cpu->PeekStack() << 8;
+    
+    uint16_t newPc = (pcHi | pcLo);
+    cpu->incrementCycleCount();
+
+#ifdef DEBUG
+    Logger::log()->info("RTI - Old PC {:04X} - New PC {:04X}", cpu->getProgramCounter(), newPc);
+#endif
+
+    cpu->setProgramCounter(newPc);
+
+#ifdef DEBUG
+    cpu->DumpStackAtPointer();
+    Logger::log()->debug("OP {} - SR SET {: >74}", getOperation(), cpu->getRegister(cpu->SR));
+#endif
+
+    return 0;
+  }
+
+
+  // Instruction: Return from Subroutine
+  // Function:    Pull PC, PC+1 -> PC
+  // Flags Out:    -
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::RTS()
+  {
+    cpu->incrementCycleCount();
+    uint16_t newPc = cpu->PopStack() | (cpu->PopStack() << 8);
+
+    cpu->incrementCycleCount();
+    cpu->setProgramCounter(newPc);
+
+
+    cpu->incrementProgramCounter();
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Set Carry Flag
+  // Function:    C = 1
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::SEC()
+  {
+    cpu->SetFlag(cpu->C, true);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Set Decimal Flag
+  // Function:    D = 1
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::SED()
+  {
+    cpu->SetFlag(cpu->D, true);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Set Interrupt Flag / Enable Interrupts
+  // Function:    I = 1
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::SEI()
+  {
+    cpu->SetFlag(cpu->I, true);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Store Accumulator at Address
+  // Function:    M = A
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::STA()
+  {
+    cpu->writeMemory(cpu->addr_abs, cpu->getRegister(cpu->AC));
+
+    return 0;
+  }
+
+
+  // Instruction: Store X Register at Address
+  // Function:    M = X
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::STX()
+  {
+    cpu->writeMemory(cpu->addr_abs, cpu->getRegister(cpu->X));
+    return 0;
+  }
+
+
+  // Instruction: Store Y Register at Address
+  // Function:    M = Y
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::STY()
+  {
+    cpu->writeMemory(cpu->addr_abs, cpu->getRegister(cpu->Y));
+    return 0;
+  }
+
+
+  // Instruction: Transfer Accumulator to X Register
+  // Function:    X = A
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::TAX()
+  {
+    cpu->incrementCycleCount();
+
+    uint8_t value = cpu->getRegister(cpu->AC);
+    cpu->setRegister(cpu->X, value);
+
+    cpu->SetNZ(value);
+    return 0;
+  }
+
+
+  // Instruction: Transfer Accumulator to Y Register
+  // Function:    Y = A
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::TAY()
+  {
+    cpu->incrementCycleCount();
+
+    uint8_t value = cpu->getRegister(cpu->AC);
+    cpu->setRegister(cpu->Y, value);
+
+    cpu->SetNZ(value);
+    return 0;
+  }
+
+
+  // Instruction: Transfer Stack Pointer to X Register
+  // Function:    X = stack pointer
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::TSX()
+  {
+    uint8_t value = cpu->getRegister(cpu->SP);
+    cpu->setRegister(cpu->X, value);
+
+    cpu->SetNZ(value);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Transfer X Register to Accumulator
+  // Function:    A = X
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::TXA()
+  {
+    cpu->incrementCycleCount();
+    uint8_t value = cpu->getRegister(cpu->X);
+    cpu->setRegister(cpu->AC, value);
+
+    cpu->SetNZ(value);
+    return 0;
+  }
+
+
+  // Instruction: Transfer X Register to Stack Pointer
+  // Function:    stack pointer = X
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::TXS()
+  {
+
+    uint8_t value = cpu->getRegister(cpu->X);
+    cpu->setRegister(cpu->SP, value);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Transfer Y Register to Accumulator
+  // Function:    A = Y
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::TYA()
+  {
+    cpu->incrementCycleCount();
+
+    uint8_t value = cpu->getRegister(cpu->Y);
+    cpu->setRegister(cpu->AC, value);
+    cpu->SetNZ(value);
+    return 0;
+  }
+
+#ifdef ILLEGAL
+  // Illegal opcodes
+
+  // Instruction: AND oper + LSR
+  // Function:    A AND oper, 0 -> [76543210] -> C
+  // Flags Out:   N, Z, C
+  // Note:        AKA ASR
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ALR()
+  {
+    fetch();
+
+    cpu->temp = cpu->getRegister(cpu->AC) & cpu->fetched;
+    cpu->setRegister(cpu->AC, (uint8_t)(cpu->temp >> 1));
+
+    cpu->SetNZ((uint8_t)cpu->temp);
+    cpu->SetFlag(cpu->C, cpu->temp & 0x0001);
+    return 0;
+  }
+
+
+  // Instruction: AND oper + set C as ASL
+  // Function:    A AND oper, bit(7) -> C
+  // Flags Out:   N, Z, C
+  // OpCode:      0x0B
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ANC()
+  {
+    fetch();
+
+    uint8_t value = cpu->getRegister(cpu->AC) & cpu->fetched;
+    cpu->setRegister(cpu->AC, value);
+
+    cpu->SetNZ(value);
+    cpu->SetFlag(cpu->C, (value & 0xFF00) > 0);
+    return 0;
+  }
+
+  // Instruction: AND oper + set C as ROL
+  // Function:    A AND oper, bit(7) -> C
+  // Flags Out:   N, Z, C
+  // OpCode:      0x2B
+  // @see OPCode::ANC
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ANC2()
+  {
+    fetch();
+
+    uint8_t value = cpu->getRegister(cpu->AC) & cpu->fetched;
+    cpu->setRegister(cpu->AC, value);
+
+    cpu->SetNZ(value);
+    cpu->SetFlag(cpu->C, value & 0xFF00);
+    return 0;
+  }
+
+
+  // Instruction: * AND X + AND oper
+  // Function:    (A OR CONST) AND X AND oper -> A
+  // Flags Out:   N, Z
+  // Note:        Highly unstable, involves a "magic" constant
+  //              A base value in A is determined based on the
+  //              contets of A and a constant, which may be
+  //              typically $00, $ff, $ee, etc. The value of
+  //              this constant depends on temerature, the chip
+  //              series, and maybe other factors, as well.
+  //              In order to eliminate these uncertaincies from
+  //              the equation, use either 0 as the operand or a
+  //              value of $FF in the accumulator.
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ANE()
+  {
+    fetch();
+
+    uint8_t ac_value = cpu->getRegister(cpu->AC);
+    uint8_t x_value = cpu->getRegister(cpu->X);
+
+
+    ac_value = (ac_value ^ magic) & x_value & cpu->fetched;
+
+    cpu->setRegister(cpu->AC, ac_value);
+
+    cpu->SetNZ(ac_value & 0xFF);
+
+    return 0;
+  }
+
+
+  // Instruction: AND oper + ROR
+  // Function:    A AND oper, C -> [76543210] -> C
+  // Flags Out:   N, Z, C, V
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::ARR()
+  {
+    fetch();
+
+    uint8_t value = cpu->getRegister(cpu->AC);
+    cpu->temp = (cpu->GetFlag(cpu->C) << 7) | ((value & cpu->fetched) >> 1);
+    cpu->SetFlag(cpu->C, cpu->fetched & 0x01);
+    cpu->SetNZ(cpu->temp & 0xFF);
+    cpu->SetFlag(cpu->V, (cpu->temp & 0x40) ^ ((cpu->temp & 0x20) << 1));
+
+    if (getAddressMode() == AddressMode::IMP)
+    {
+      cpu->setRegister(cpu->AC, (uint8_t)(cpu->temp & 0x00FF));
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, cpu->temp & 0x00FF);
+    }
+    return 0;
+  }
+
+
+  // Instruction: DEC oper + CMP oper
+  // Function:    M - 1 -> M, A - M
+  // Flags Out:   N, Z, C
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::DCP()
+  {
+    fetch();
+    uint8_t value = cpu->getRegister(cpu->AC);
+    cpu->temp = cpu->fetched - 1;
+    //cpu->writeMemory(addr_abs, temp);
+    cpu->writeMemory(cpu->addr_abs, cpu->temp & 0x00FF);
+    cpu->SetFlag(cpu->C, value >= cpu->fetched);
+    cpu->SetNZ(cpu->temp & 0xFF);
+    return 0;
+  }
+
+
+  // Instruction: INC oper + SBC oper
+  // Function:    M + 1 -> M, A - M - (C - 1) -> A
+  // Flags Out:   N, Z, C, V
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  uint8_t BasicExecutioner<BusT>::ISC()
+  {
+    fetch();
+    cpu->temp = cpu->fetched + 1;
+    //cpu->writeMemory(addr_abs, temp);
+    cpu->writeMemory(cpu->addr_abs, cpu->temp & 0x00FF);
+    SBC<V>();
+    return 0;
+  }
+
+
+  // Instruction: LDA/TSX oper
+  // Function:    M AND SP -> A, X, SP
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::LAS()
+  {
+    fetch();
+    uint8_t value = cpu->getRegister(cpu->SP);
+    uint8_t result = value & cpu->fetched;
+    cpu->setRegister(cpu->SP, result);
+    cpu->setRegister(cpu->AC, result);
+    cpu->setRegister(cpu->X, result);
+
+    cpu->SetNZ(result & 0xFF);
+
+    return 1;
+  }
+
+
+  // Instruction: LDA oper + LDX oper
+  // Function:    M -> A -> X
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::LAX()
+  {
+    fetch();
+
+    cpu->setRegister(cpu->AC, cpu->fetched);
+    cpu->setRegister(cpu->X, cpu->fetched);
+
+    cpu->SetNZ(cpu->fetched & 0xFF);
+
+    return 1;
+  }
+
+
+  // Instruction: Store * AND oper in A and X
+  // Function:    (A OR CONST) AND oper -> A -> X
+  // Flags Out:   N, Z
+  // Note:        Highly unstable, involves a "magic" constant
+  // See:         Processor::ANE
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::LXA()
+  {
+    fetch();
+
+    uint8_t value = (cpu->getRegister(cpu->AC) ^ magic) & cpu->fetched;
+
+    cpu->setRegister(cpu->AC, value);
+    cpu->setRegister(cpu->X, value);
+
+    cpu->SetNZ(value & 0xFF);
+
+    return 0;
+  }
+
+
+  // Instruction: ROL oper + AND oper
+  // Function:    M = C <- [76543210] <- C, A AND M -> A
+  // Flags Out:   N, Z, C
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::RLA()
+  {
+    fetch();
+    cpu->temp = (uint16_t)((cpu->fetched << 1) & 0xFF) | cpu->GetFlag(cpu->C);
+    cpu->writeMemory(cpu->addr_abs, cpu->temp & 0x00FF);
+    cpu->SetFlag(cpu->C, (cpu->fetched & 0xFF00) > 0);
+  Processor:AND();
+    return 0;
+  }
+
+
+  // Instruction: ROL oper + ADC oper
+  // Function:    M = C -> [76543210] -> C, A + M + C -> A, C
+  // Flags Out:   N, Z, C, V
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  uint8_t BasicExecutioner<BusT>::RRA()
+  {
+    fetch();
+    cpu->temp = (uint16_t)(cpu->fetched << 1) | cpu->GetFlag(cpu->C);
+    cpu->writeMemory(cpu->addr_abs, cpu->temp & 0x00FF);
+    cpu->SetFlag(cpu->C, (cpu->fetched & 0xFF00) > 0);
+    ADC<V>();
+    return 0;
+  }
+
+
+  // Instruction: A and X are put on the bus at the same
+  //              time (resulting effectively in an AND
+  //              operation) and stored in M
+  // Function:    A AND X -> M
+  // Flags Out:   -
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::SAX()
+  {
+    fetch();
+
+    uint8_t value = cpu->getRegister(cpu->AC) & cpu->getRegister(cpu->X);
+    cpu->writeMemory(cpu->addr_abs, value & 0x00FF);
+    cpu->SetNZ(value);
+    return 0;
+  }
+
+
+  // Instruction: CMP and DEX at once, sets flags like CMP
+  // Function:    (A AND X) - oper -> X
+  // Flags Out:   N, Z, C
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::SBX()
+  {
+    fetch();
+
+    uint8_t value = (cpu->getRegister(cpu->AC) & cpu->getRegister(cpu->X)) - cpu->fetched;
+    cpu->setRegister(cpu->X, value);
+    //x = ((uint16_t)a & (uint16_t)x) - (uint16_t)fetched;
+    cpu->SetFlag(cpu->C, value & 0xFF00);
+    cpu->SetNZ(value & 0xFF);
+
+    return 0;
+  }
+
+
+  // Instruction: Stores A AND X AND (high-byte of addr. + 1) at addr.
+  // Function:    A AND X AND (H+1) -> M
+  // Flags Out:   -
+  // Note:        Unstable: Sometimes 'AND (H+1)' is dropped, page boundary
+  //              crossings may not work (with the high-byte of the value used
+  //              as the high-byte of the address).
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::SHA()
+  {
+    fetch();
+    //temp = ((uint16_t)a & (uint16_t)x) & (uint16_t)((addr_abs >> 8) + 1);
+    //cpu->writeMemory(addr_abs, temp & 0x00FF);
+
+    uint16_t value = ((uint16_t)cpu->getRegister(cpu->AC) & (uint16_t)cpu->getRegister(cpu->X));
+    value &= (uint16_t)((cpu->addr_abs >> 8) + 1);
+    cpu->writeMemory(cpu->addr_abs, (uint8_t)(cpu->temp & 0x00FF));
+
+    return 0;
+  }
+
+
+  // Instruction: Stores X AND (high-byte of addr. + 1) at addr.
+  // Function:    X AND (H+1) -> M
+  // Flags Out:   -
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::SHX()
+  {
+    fetch();
+    //temp = ((uint16_t)x) & (uint16_t)((addr_abs >> 8) + 1);
+    //cpu->writeMemory(addr_abs, temp & 0x00FF);
+
+    uint16_t value = ((uint16_t)cpu->getRegister(cpu->X) & (uint16_t)((cpu->addr_abs >> 8) + 1));
+    cpu->writeMemory(cpu->addr_abs, (uint8_t)(cpu->temp & 0x00FF));
+
+    return 0;
+  }
+
+
+  // Instruction: Stores Y AND (high-byte of addr. + 1) at addr.
+  // Function:    Y AND (H+1) -> M
+  // Flags Out:   -
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::SHY()
+  {
+    fetch();
+    //temp = ((uint16_t)y) & (uint16_t)((addr_abs >> 8) + 1);
+    //cpu->writeMemory(addr_abs, temp & 0x00FF);
+
+    uint16_t value = ((uint16_t)cpu->getRegister(cpu->Y) & (uint16_t)((cpu->addr_abs >> 8) + 1));
+    cpu->writeMemory(cpu->addr_abs, (uint8_t)(cpu->temp & 0x00FF));
+    return 0;
+  }
+
+
+  // Instruction: ASL oper + ORA oper
+  // Function:    M = C <- [76543210] <- 0, A OR M -> A
+  // Flags Out:   N, Z, C
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::SLO()
+  {
+    fetch();
+    cpu->temp = (uint16_t)cpu->fetched << 1;
+    cpu->SetFlag(cpu->C, (cpu->temp & 0xFF00) > 0);
+    cpu->writeMemory(cpu->addr_abs, cpu->temp & 0x00FF);
+
+    //a = a | fetched;
+    uint8_t value = cpu->getRegister(cpu->AC) | cpu->fetched;
+    cpu->SetNZ(value & 0xFF);
+    return 0;
+  }
+
+
+  // Instruction: LSR oper + EOR oper
+  // Function:    M = 0 -> [76543210] -> 0, A EOR M -> A
+  // Flags Out:   -
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::SRE()
+  {
+    fetch();
+
+    cpu->SetFlag(cpu->C, cpu->fetched & 0x0001);
+    cpu->temp = cpu->fetched >> 1;
+    cpu->SetNZ(cpu->temp & 0xFF);
+
+    uint8_t value = (uint8_t)(cpu->temp & 0xFF);
+
+    if (getAddressMode() == AddressMode::IMP)
+    {
+      cpu->setRegister(cpu->AC, value);
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, value);
+    }
+
+    cpu->setRegister(cpu->AC, value ^ cpu->fetched);
+
+    return 0;
+  }
+
+
+  // Instruction: Puts A AND X in SP and stores A AND X AND (high-byte of addr. + 1) at addr.
+  // Function:    A AND X -> SP, A AND X AND (H + 1) -> M
+  // Flags Out:   -
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::TAS()
+  {
+    fetch();
+    uint8_t value = cpu->getRegister(cpu->AC) & cpu->getRegister(cpu->X);
+    cpu->setRegister(cpu->SP, value);
+
+    uint8_t h = (cpu->addr_abs >> 8);
+    uint8_t h1 = cpu->readMemoryWithoutCycle(cpu->getProgramCounter() - 1);
+    uint8_t r = (value & h1);
+
+    if (cpu->extra_cycles > 0)
+    {
+      // We assume no DMA
+      r &= h;
+      uint16_t tasAddr = (r << 8) | (cpu->addr_abs & 0xFF);
+      cpu->writeMemory(tasAddr, r);
+    }
+    else
+    {
+      cpu->writeMemory(cpu->addr_abs, (r & (h + 1)));
+    }
+
+    return 0;
+  }
+
+
+  // Alias for SBC
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  uint8_t BasicExecutioner<BusT>::USBC()
+  {
+    return SBC<V>();
+  }
+
+
+  // Instruction: No Operation (Skip Byte)
+  // Function:    -
+  // Flags Out:   -
+  // Note:        -
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::DOP()
+  {
+    // Sadly not all NOPs are equal, Ive added a few here
+    // based on https://wiki.nesdev.com/w/index.php/CPU_unofficial_opcodes
+    // and will add more based on game compatibility, and ultimately
+    // I'd like to cover all illegal opcodes too
+    //cpu->incrementCycleCount();
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: No Operation (Ignore)
+  // Function:    -
+  // Flags Out:   -
+  // Note:        -
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::TOP()
+  {
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // This instruction freezes the CPU.
+  // The processor will be trapped infinitely in
+  // T1 phase with $FF on the data bus.
+  // — Reset required.
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::JAM()
+  {
+    cpu->setJammed();
+    breakOperation(false, cpu->getProgramCounter());
+    //throw std::exception();
+    return 0;
+  }
+#else
+  // This function captures illegal opcodes
+  // Only needed when ILLEGAL macro is not set
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::XXX()
+  {
+#ifdef LOGMODE
+    Logger::log()->error("Invalid operation ({:02X})", cpu->opcode);
+#endif
+    cpu->setFault(ProcessorBase::INVALID_OPCODE);
+    return 0;
+  }
+#endif
+
+  // 65C02 opcodes
+
+  // Instruction: Branch Always
+  // Function:    pc = address
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::BRA()
+  {
+    branchOperation(true);
+    return 0;
+  }
+
+
+  // Instruction: Push X Register to Stack
+  // Function:    X -> stack
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::PHX()
+  {
+    cpu->PushStack(cpu->getRegister(cpu->X));
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Push Y Register to Stack
+  // Function:    Y -> stack
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::PHY()
+  {
+    cpu->PushStack(cpu->getRegister(cpu->Y));
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Pop X Register off Stack
+  // Function:    X <- stack
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::PLX()
+  {
+    uint8_t value = cpu->PopStack();
+    cpu->incrementCycleCount();
+    cpu->setRegister(cpu->X, value);
+    cpu->SetNZ(value);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Pop Y Register off Stack
+  // Function:    Y <- stack
+  // Flags Out:   N, Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::PLY()
+  {
+    uint8_t value = cpu->PopStack();
+    cpu->incrementCycleCount();
+    cpu->setRegister(cpu->Y, value);
+    cpu->SetNZ(value);
+    cpu->incrementCycleCount();
+    return 0;
+  }
+
+
+  // Instruction: Stop the Processor
+  // Function:    -
+  // Note:        Only a reset starts the processor again
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::STP()
+  {
+    cpu->incrementCycleCount();
+    cpu->incrementCycleCount();
+    cpu->setFault(ProcessorBase::STOPPED);
+    return 0;
+  }
+
+
+  // Instruction: Store Zero at Address
+  // Function:    M = 0
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::STZ()
+  {
+    cpu->writeMemory(cpu->addr_abs, 0x00);
+    return 0;
+  }
+
+
+  // Instruction: Test and Reset Bits
+  // Function:    M = M & ~A
+  // Flags Out:   Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::TRB()
+  {
+    fetch();
+    uint8_t ac = cpu->getRegister(cpu->AC);
+    cpu->SetFlag(cpu->Z, (ac & cpu->fetched) == 0x00);
+    cpu->incrementCycleCount();
+    cpu->writeMemory(cpu->addr_abs, cpu->fetched & ~ac);
+    return 0;
+  }
+
+
+  // Instruction: Test and Set Bits
+  // Function:    M = M | A
+  // Flags Out:   Z
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::TSB()
+  {
+    fetch();
+    uint8_t ac = cpu->getRegister(cpu->AC);
+    cpu->SetFlag(cpu->Z, (ac & cpu->fetched) == 0x00);
+    cpu->incrementCycleCount();
+    cpu->writeMemory(cpu->addr_abs, cpu->fetched | ac);
+    return 0;
+  }
+
+
+  // Instruction: Wait for Interrupt
+  // Function:    -
+  // Note:        Runs again until an interrupt is signalled. With the
+  //              interrupt disable flag set, an IRQ only ends the wait
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::WAI()
+  {
+    cpu->incrementCycleCount();
+    cpu->incrementCycleCount();
+    if (!cpu->TriggerNmi && !cpu->TriggerIRQ)
+    {
+      cpu->decrementProgramCounter();
+    }
+    return 0;
+  }
+
+
+  // Instruction: No Operation, the undefined opcodes of the 65C02
+  // Function:    -
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::NOP1()
+  {
+    // The opcode fetch is the only cycle
+    return 0;
+  }
+
+
+  template <typename BusT>
+  uint8_t BasicExecutioner<BusT>::NOP8()
+  {
+    for (uint8_t i = 0; i < 5; i++)
+    {
+      cpu->incrementCycleCount();
+    }
+    return 0;
+  }
+
+#pragma endregion INSTRUCTION IMPLEMENTATIONS
+#pragma region DISPATCH ENGINES
+  // Every engine runs the same per-instruction steps: Processor::startInstruction()
+  // fetches the opcode, the fused opcode (see Op()) is executed, and Processor::finishInstruction() services interrupts. Only
+  // the way control gets from one opcode to the next differs.
+
+  // The opcode is known at compile time, so the fused opcode is called
+  // directly and can be inlined into the engine.
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V, uint8_t OP>
+  inline void BasicExecutioner<BusT>::operation()
+  {
+    constexpr OperationType entry = instructionSet<BusT, V>[OP];
+    Op<entry.addrmode.op, entry.operate.op>();
+  }
+
+  // Looks up the handlers at runtime through the member function pointers
+  template <typename BusT>
+  uint32_t BasicExecutioner<BusT>::runTable(uint32_t instructions)
+  {
+    uint32_t executed = 0;
+    while (executed < instructions && cpu->startInstruction())
+    {
+      // Perform operation incl. fetch of intermmediate
+      // data using the required addressing mode
+      execute(cpu->opcode);
+      cpu->finishInstruction();
+      executed++;
+    }
+    return executed;
+  }
+
+  // Leaves it to the compiler to build a jump table over all opcodes
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  uint32_t BasicExecutioner<BusT>::runSwitch(uint32_t instructions)
+  {
+    uint32_t executed = 0;
+    while (executed < instructions && cpu->startInstruction())
+    {
+      switch (cpu->opcode)
+      {
+      case 0x00: operation<V, 0x00>(); break;
+      case 0x01: operation<V, 0x01>(); break;
+      case 0x02: operation<V, 0x02>(); break;
+      case 0x03: operation<V, 0x03>(); break;
+      case 0x04: operation<V, 0x04>(); break;
+      case 0x05: operation<V, 0x05>(); break;
+      case 0x06: operation<V, 0x06>(); break;
+      case 0x07: operation<V, 0x07>(); break;
+      case 0x08: operation<V, 0x08>(); break;
+      case 0x09: operation<V, 0x09>(); break;
+      case 0x0A: operation<V, 0x0A>(); break;
+      case 0x0B: operation<V, 0x0B>(); break;
+      case 0x0C: operation<V, 0x0C>(); break;
+      case 0x0D: operation<V, 0x0D>(); break;
+      case 0x0E: operation<V, 0x0E>(); break;
+      case 0x0F: operation<V, 0x0F>(); break;
+      case 0x10: operation<V, 0x10>(); break;
+      case 0x11: operation<V, 0x11>(); break;
+      case 0x12: operation<V, 0x12>(); break;
+      case 0x13: operation<V, 0x13>(); break;
+      case 0x14: operation<V, 0x14>(); break;
+      case 0x15: operation<V, 0x15>(); break;
+      case 0x16: operation<V, 0x16>(); break;
+      case 0x17: operation<V, 0x17>(); break;
+      case 0x18: operation<V, 0x18>(); break;
+      case 0x19: operation<V, 0x19>(); break;
+      case 0x1A: operation<V, 0x1A>(); break;
+      case 0x1B: operation<V, 0x1B>(); break;
+      case 0x1C: operation<V, 0x1C>(); break;
+      case 0x1D: operation<V, 0x1D>(); break;
+      case 0x1E: operation<V, 0x1E>(); break;
+      case 0x1F: operation<V, 0x1F>(); break;
+      case 0x20: operation<V, 0x20>(); break;
+      case 0x21: operation<V, 0x21>(); break;
+      case 0x22: operation<V, 0x22>(); break;
+      case 0x23: operation<V, 0x23>(); break;
+      case 0x24: operation<V, 0x24>(); break;
+      case 0x25: operation<V, 0x25>(); break;
+      case 0x26: operation<V, 0x26>(); break;
+      case 0x27: operation<V, 0x27>(); break;
+      case 0x28: operation<V, 0x28>(); break;
+      case 0x29: operation<V, 0x29>(); break;
+      case 0x2A: operation<V, 0x2A>(); break;
+      case 0x2B: operation<V, 0x2B>(); break;
+      case 0x2C: operation<V, 0x2C>(); break;
+      case 0x2D: operation<V, 0x2D>(); break;
+      case 0x2E: operation<V, 0x2E>(); break;
+      case 0x2F: operation<V, 0x2F>(); break;
+      case 0x30: operation<V, 0x30>(); break;
+      case 0x31: operation<V, 0x31>(); break;
+      case 0x32: operation<V, 0x32>(); break;
+      case 0x33: operation<V, 0x33>(); break;
+      case 0x34: operation<V, 0x34>(); break;
+      case 0x35: operation<V, 0x35>(); break;
+      case 0x36: operation<V, 0x36>(); break;
+      case 0x37: operation<V, 0x37>(); break;
+      case 0x38: operation<V, 0x38>(); break;
+      case 0x39: operation<V, 0x39>(); break;
+      case 0x3A: operation<V, 0x3A>(); break;
+      case 0x3B: operation<V, 0x3B>(); break;
+      case 0x3C: operation<V, 0x3C>(); break;
+      case 0x3D: operation<V, 0x3D>(); break;
+      case 0x3E: operation<V, 0x3E>(); break;
+      case 0x3F: operation<V, 0x3F>(); break;
+      case 0x40: operation<V, 0x40>(); break;
+      case 0x41: operation<V, 0x41>(); break;
+      case 0x42: operation<V, 0x42>(); break;
+      case 0x43: operation<V, 0x43>(); break;
+      case 0x44: operation<V, 0x44>(); break;
+      case 0x45: operation<V, 0x45>(); break;
+      case 0x46: operation<V, 0x46>(); break;
+      case 0x47: operation<V, 0x47>(); break;
+      case 0x48: operation<V, 0x48>(); break;
+      case 0x49: operation<V, 0x49>(); break;
+      case 0x4A: operation<V, 0x4A>(); break;
+      case 0x4B: operation<V, 0x4B>(); break;
+      case 0x4C: operation<V, 0x4C>(); break;
+      case 0x4D: operation<V, 0x4D>(); break;
+      case 0x4E: operation<V, 0x4E>(); break;
+      case 0x4F: operation<V, 0x4F>(); break;
+      case 0x50: operation<V, 0x50>(); break;
+      case 0x51: operation<V, 0x51>(); break;
+      case 0x52: operation<V, 0x52>(); break;
+      case 0x53: operation<V, 0x53>(); break;
+      case 0x54: operation<V, 0x54>(); break;
+      case 0x55: operation<V, 0x55>(); break;
+      case 0x56: operation<V, 0x56>(); break;
+      case 0x57: operation<V, 0x57>(); break;
+      case 0x58: operation<V, 0x58>(); break;
+      case 0x59: operation<V, 0x59>(); break;
+      case 0x5A: operation<V, 0x5A>(); break;
+      case 0x5B: operation<V, 0x5B>(); break;
+      case 0x5C: operation<V, 0x5C>(); break;
+      case 0x5D: operation<V, 0x5D>(); break;
+      case 0x5E: operation<V, 0x5E>(); break;
+      case 0x5F: operation<V, 0x5F>(); break;
+      case 0x60: operation<V, 0x60>(); break;
+      case 0x61: operation<V, 0x61>(); break;
+      case 0x62: operation<V, 0x62>(); break;
+      case 0x63: operation<V, 0x63>(); break;
+      case 0x64: operation<V, 0x64>(); break;
+      case 0x65: operation<V, 0x65>(); break;
+      case 0x66: operation<V, 0x66>(); break;
+      case 0x67: operation<V, 0x67>(); break;
+      case 0x68: operation<V, 0x68>(); break;
+      case 0x69: operation<V, 0x69>(); break;
+      case 0x6A: operation<V, 0x6A>(); break;
+      case 0x6B: operation<V, 0x6B>(); break;
+      case 0x6C: operation<V, 0x6C>(); break;
+      case 0x6D: operation<V, 0x6D>(); break;
+      case 0x6E: operation<V, 0x6E>(); break;
+      case 0x6F: operation<V, 0x6F>(); break;
+      case 0x70: operation<V, 0x70>(); break;
+      case 0x71: operation<V, 0x71>(); break;
+      case 0x72: operation<V, 0x72>(); break;
+      case 0x73: operation<V, 0x73>(); break;
+      case 0x74: operation<V, 0x74>(); break;
+      case 0x75: operation<V, 0x75>(); break;
+      case 0x76: operation<V, 0x76>(); break;
+      case 0x77: operation<V, 0x77>(); break;
+      case 0x78: operation<V, 0x78>(); break;
+      case 0x79: operation<V, 0x79>(); break;
+      case 0x7A: operation<V, 0x7A>(); break;
+      case 0x7B: operation<V, 0x7B>(); break;
+      case 0x7C: operation<V, 0x7C>(); break;
+      case 0x7D: operation<V, 0x7D>(); break;
+      case 0x7E: operation<V, 0x7E>(); break;
+      case 0x7F: operation<V, 0x7F>(); break;
+      case 0x80: operation<V, 0x80>(); break;
+      case 0x81: operation<V, 0x81>(); break;
+      case 0x82: operation<V, 0x82>(); break;
+      case 0x83: operation<V, 0x83>(); break;
+      case 0x84: operation<V, 0x84>(); break;
+      case 0x85: operation<V, 0x85>(); break;
+      case 0x86: operation<V, 0x86>(); break;
+      case 0x87: operation<V, 0x87>(); break;
+      case 0x88: operation<V, 0x88>(); break;
+      case 0x89: operation<V, 0x89>(); break;
+      case 0x8A: operation<V, 0x8A>(); break;
+      case 0x8B: operation<V, 0x8B>(); break;
+      case 0x8C: operation<V, 0x8C>(); break;
+      case 0x8D: operation<V, 0x8D>(); break;
+      case 0x8E: operation<V, 0x8E>(); break;
+      case 0x8F: operation<V, 0x8F>(); break;
+      case 0x90: operation<V, 0x90>(); break;
+      case 0x91: operation<V, 0x91>(); break;
+      case 0x92: operation<V, 0x92>(); break;
+      case 0x93: operation<V, 0x93>(); break;
+      case 0x94: operation<V, 0x94>(); break;
+      case 0x95: operation<V, 0x95>(); break;
+      case 0x96: operation<V, 0x96>(); break;
+      case 0x97: operation<V, 0x97>(); break;
+      case 0x98: operation<V, 0x98>(); break;
+      case 0x99: operation<V, 0x99>(); break;
+      case 0x9A: operation<V, 0x9A>(); break;
+      case 0x9B: operation<V, 0x9B>(); break;
+      case 0x9C: operation<V, 0x9C>(); break;
+      case 0x9D: operation<V, 0x9D>(); break;
+      case 0x9E: operation<V, 0x9E>(); break;
+      case 0x9F: operation<V, 0x9F>(); break;
+      case 0xA0: operation<V, 0xA0>(); break;
+      case 0xA1: operation<V, 0xA1>(); break;
+      case 0xA2: operation<V, 0xA2>(); break;
+      case 0xA3: operation<V, 0xA3>(); break;
+      case 0xA4: operation<V, 0xA4>(); break;
+      case 0xA5: operation<V, 0xA5>(); break;
+      case 0xA6: operation<V, 0xA6>(); break;
+      case 0xA7: operation<V, 0xA7>(); break;
+      case 0xA8: operation<V, 0xA8>(); break;
+      case 0xA9: operation<V, 0xA9>(); break;
+      case 0xAA: operation<V, 0xAA>(); break;
+      case 0xAB: operation<V, 0xAB>(); break;
+      case 0xAC: operation<V, 0xAC>(); break;
+      case 0xAD: operation<V, 0xAD>(); break;
+      case 0xAE: operation<V, 0xAE>(); break;
+      case 0xAF: operation<V, 0xAF>(); break;
+      case 0xB0: operation<V, 0xB0>(); break;
+      case 0xB1: operation<V, 0xB1>(); break;
+      case 0xB2: operation<V, 0xB2>(); break;
+      case 0xB3: operation<V, 0xB3>(); break;
+      case 0xB4: operation<V, 0xB4>(); break;
+      case 0xB5: operation<V, 0xB5>(); break;
+      case 0xB6: operation<V, 0xB6>(); break;
+      case 0xB7: operation<V, 0xB7>(); break;
+      case 0xB8: operation<V, 0xB8>(); break;
+      case 0xB9: operation<V, 0xB9>(); break;
+      case 0xBA: operation<V, 0xBA>(); break;
+      case 0xBB: operation<V, 0xBB>(); break;
+      case 0xBC: operation<V, 0xBC>(); break;
+      case 0xBD: operation<V, 0xBD>(); break;
+      case 0xBE: operation<V, 0xBE>(); break;
+      case 0xBF: operation<V, 0xBF>(); break;
+      case 0xC0: operation<V, 0xC0>(); break;
+      case 0xC1: operation<V, 0xC1>(); break;
+      case 0xC2: operation<V, 0xC2>(); break;
+      case 0xC3: operation<V, 0xC3>(); break;
+      case 0xC4: operation<V, 0xC4>(); break;
+      case 0xC5: operation<V, 0xC5>(); break;
+      case 0xC6: operation<V, 0xC6>(); break;
+      case 0xC7: operation<V, 0xC7>(); break;
+      case 0xC8: operation<V, 0xC8>(); break;
+      case 0xC9: operation<V, 0xC9>(); break;
+      case 0xCA: operation<V, 0xCA>(); break;
+      case 0xCB: operation<V, 0xCB>(); break;
+      case 0xCC: operation<V, 0xCC>(); break;
+      case 0xCD: operation<V, 0xCD>(); break;
+      case 0xCE: operation<V, 0xCE>(); break;
+      case 0xCF: operation<V, 0xCF>(); break;
+      case 0xD0: operation<V, 0xD0>(); break;
+      case 0xD1: operation<V, 0xD1>(); break;
+      case 0xD2: operation<V, 0xD2>(); break;
+      case 0xD3: operation<V, 0xD3>(); break;
+      case 0xD4: operation<V, 0xD4>(); break;
+      case 0xD5: operation<V, 0xD5>(); break;
+      case 0xD6: operation<V, 0xD6>(); break;
+      case 0xD7: operation<V, 0xD7>(); break;
+      case 0xD8: operation<V, 0xD8>(); break;
+      case 0xD9: operation<V, 0xD9>(); break;
+      case 0xDA: operation<V, 0xDA>(); break;
+      case 0xDB: operation<V, 0xDB>(); break;
+      case 0xDC: operation<V, 0xDC>(); break;
+      case 0xDD: operation<V, 0xDD>(); break;
+      case 0xDE: operation<V, 0xDE>(); break;
+      case 0xDF: operation<V, 0xDF>(); break;
+      case 0xE0: operation<V, 0xE0>(); break;
+      case 0xE1: operation<V, 0xE1>(); break;
+      case 0xE2: operation<V, 0xE2>(); break;
+      case 0xE3: operation<V, 0xE3>(); break;
+      case 0xE4: operation<V, 0xE4>(); break;
+      case 0xE5: operation<V, 0xE5>(); break;
+      case 0xE6: operation<V, 0xE6>(); break;
+      case 0xE7: operation<V, 0xE7>(); break;
+      case 0xE8: operation<V, 0xE8>(); break;
+      case 0xE9: operation<V, 0xE9>(); break;
+      case 0xEA: operation<V, 0xEA>(); break;
+      case 0xEB: operation<V, 0xEB>(); break;
+      case 0xEC: operation<V, 0xEC>(); break;
+      case 0xED: operation<V, 0xED>(); break;
+      case 0xEE: operation<V, 0xEE>(); break;
+      case 0xEF: operation<V, 0xEF>(); break;
+      case 0xF0: operation<V, 0xF0>(); break;
+      case 0xF1: operation<V, 0xF1>(); break;
+      case 0xF2: operation<V, 0xF2>(); break;
+      case 0xF3: operation<V, 0xF3>(); break;
+      case 0xF4: operation<V, 0xF4>(); break;
+      case 0xF5: operation<V, 0xF5>(); break;
+      case 0xF6: operation<V, 0xF6>(); break;
+      case 0xF7: operation<V, 0xF7>(); break;
+      case 0xF8: operation<V, 0xF8>(); break;
+      case 0xF9: operation<V, 0xF9>(); break;
+      case 0xFA: operation<V, 0xFA>(); break;
+      case 0xFB: operation<V, 0xFB>(); break;
+      case 0xFC: operation<V, 0xFC>(); break;
+      case 0xFD: operation<V, 0xFD>(); break;
+      case 0xFE: operation<V, 0xFE>(); break;
+      case 0xFF: operation<V, 0xFF>(); break;
+      }
+      cpu->finishInstruction();
+      executed++;
+    }
+    return executed;
+  }
+
+#ifdef THREADED_DISPATCH
+  // Each opcode ends with its own indirect jump to the next opcode, which gives
+  // the branch predictor one prediction site per opcode instead of a shared one.
+  // With SUPER the opcodes run as superinstructions, see superinstruction().
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V, bool SUPER>
+  uint32_t BasicExecutioner<BusT>::runThreaded(uint32_t instructions)
+  {
+    static void* const labels[256] = {
+      &&OP_00, &&OP_01, &&OP_02, &&OP_03, &&OP_04, &&OP_05, &&OP_06, &&OP_07,
+      &&OP_08, &&OP_09, &&OP_0A, &&OP_0B, &&OP_0C, &&OP_0D, &&OP_0E, &&OP_0F,
+      &&OP_10, &&OP_11, &&OP_12, &&OP_13, &&OP_14, &&OP_15, &&OP_16, &&OP_17,
+      &&OP_18, &&OP_19, &&OP_1A, &&OP_1B, &&OP_1C, &&OP_1D, &&OP_1E, &&OP_1F,
+      &&OP_20, &&OP_21, &&OP_22, &&OP_23, &&OP_24, &&OP_25, &&OP_26, &&OP_27,
+      &&OP_28, &&OP_29, &&OP_2A, &&OP_2B, &&OP_2C, &&OP_2D, &&OP_2E, &&OP_2F,
+      &&OP_30, &&OP_31, &&OP_32, &&OP_33, &&OP_34, &&OP_35, &&OP_36, &&OP_37,
+      &&OP_38, &&OP_39, &&OP_3A, &&OP_3B, &&OP_3C, &&OP_3D, &&OP_3E, &&OP_3F,
+      &&OP_40, &&OP_41, &&OP_42, &&OP_43, &&OP_44, &&OP_45, &&OP_46, &&OP_47,
+      &&OP_48, &&OP_49, &&OP_4A, &&OP_4B, &&OP_4C, &&OP_4D, &&OP_4E, &&OP_4F,
+      &&OP_50, &&OP_51, &&OP_52, &&OP_53, &&OP_54, &&OP_55, &&OP_56, &&OP_57,
+      &&OP_58, &&OP_59, &&OP_5A, &&OP_5B, &&OP_5C, &&OP_5D, &&OP_5E, &&OP_5F,
+      &&OP_60, &&OP_61, &&OP_62, &&OP_63, &&OP_64, &&OP_65, &&OP_66, &&OP_67,
+      &&OP_68, &&OP_69, &&OP_6A, &&OP_6B, &&OP_6C, &&OP_6D, &&OP_6E, &&OP_6F,
+      &&OP_70, &&OP_71, &&OP_72, &&OP_73, &&OP_74, &&OP_75, &&OP_76, &&OP_77,
+      &&OP_78, &&OP_79, &&OP_7A, &&OP_7B, &&OP_7C, &&OP_7D, &&OP_7E, &&OP_7F,
+      &&OP_80, &&OP_81, &&OP_82, &&OP_83, &&OP_84, &&OP_85, &&OP_86, &&OP_87,
+      &&OP_88, &&OP_89, &&OP_8A, &&OP_8B, &&OP_8C, &&OP_8D, &&OP_8E, &&OP_8F,
+      &&OP_90, &&OP_91, &&OP_92, &&OP_93, &&OP_94, &&OP_95, &&OP_96, &&OP_97,
+      &&OP_98, &&OP_99, &&OP_9A, &&OP_9B, &&OP_9C, &&OP_9D, &&OP_9E, &&OP_9F,
+      &&OP_A0, &&OP_A1, &&OP_A2, &&OP_A3, &&OP_A4, &&OP_A5, &&OP_A6, &&OP_A7,
+      &&OP_A8, &&OP_A9, &&OP_AA, &&OP_AB, &&OP_AC, &&OP_AD, &&OP_AE, &&OP_AF,
+      &&OP_B0, &&OP_B1, &&OP_B2, &&OP_B3, &&OP_B4, &&OP_B5, &&OP_B6, &&OP_B7,
+      &&OP_B8, &&OP_B9, &&OP_BA, &&OP_BB, &&OP_BC, &&OP_BD, &&OP_BE, &&OP_BF,
+      &&OP_C0, &&OP_C1, &&OP_C2, &&OP_C3, &&OP_C4, &&OP_C5, &&OP_C6, &&OP_C7,
+      &&OP_C8, &&OP_C9, &&OP_CA, &&OP_CB, &&OP_CC, &&OP_CD, &&OP_CE, &&OP_CF,
+      &&OP_D0, &&OP_D1, &&OP_D2, &&OP_D3, &&OP_D4, &&OP_D5, &&OP_D6, &&OP_D7,
+      &&OP_D8, &&OP_D9, &&OP_DA, &&OP_DB, &&OP_DC, &&OP_DD, &&OP_DE, &&OP_DF,
+      &&OP_E0, &&OP_E1, &&OP_E2, &&OP_E3, &&OP_E4, &&OP_E5, &&OP_E6, &&OP_E7,
+      &&OP_E8, &&OP_E9, &&OP_EA, &&OP_EB, &&OP_EC, &&OP_ED, &&OP_EE, &&OP_EF,
+      &&OP_F0, &&OP_F1, &&OP_F2, &&OP_F3, &&OP_F4, &&OP_F5, &&OP_F6, &&OP_F7,
+      &&OP_F8, &&OP_F9, &&OP_FA, &&OP_FB, &&OP_FC, &&OP_FD, &&OP_FE, &&OP_FF
+    };
+
+    uint32_t executed = 0;
+    if (instructions == 0 || !cpu->startInstruction())
+    {
+      return executed;
+    }
+    goto *labels[cpu->opcode];
+
+#define THREADED_OPERATION(OP) \
+  OP_##OP: \
+    if constexpr (SUPER) \
+    { \
+      switch (superinstruction<V, 0x##OP>(executed, instructions)) \
+      { \
+        case STOP:          return executed; \
+        case DISPATCH_NEXT: goto *labels[cpu->opcode]; \
+        default:            break; \
+      } \
+    } \
+    else \
+    { \
+      operation<V, 0x##OP>(); \
+    } \
+    cpu->finishInstruction(); \
+    if (++executed == instructions || !cpu->startInstruction()) \
+    { \
+      return executed; \
+    } \
+    goto *labels[cpu->opcode];
+
+    THREADED_OPERATION(00) THREADED_OPERATION(01) THREADED_OPERATION(02) THREADED_OPERATION(03)
+    THREADED_OPERATION(04) THREADED_OPERATION(05) THREADED_OPERATION(06) THREADED_OPERATION(07)
+    THREADED_OPERATION(08) THREADED_OPERATION(09) THREADED_OPERATION(0A) THREADED_OPERATION(0B)
+    THREADED_OPERATION(0C) THREADED_OPERATION(0D) THREADED_OPERATION(0E) THREADED_OPERATION(0F)
+    THREADED_OPERATION(10) THREADED_OPERATION(11) THREADED_OPERATION(12) THREADED_OPERATION(13)
+    THREADED_OPERATION(14) THREADED_OPERATION(15) THREADED_OPERATION(16) THREADED_OPERATION(17)
+    THREADED_OPERATION(18) THREADED_OPERATION(19) THREADED_OPERATION(1A) THREADED_OPERATION(1B)
+    THREADED_OPERATION(1C) THREADED_OPERATION(1D) THREADED_OPERATION(1E) THREADED_OPERATION(1F)
+    THREADED_OPERATION(20) THREADED_OPERATION(21) THREADED_OPERATION(22) THREADED_OPERATION(23)
+    THREADED_OPERATION(24) THREADED_OPERATION(25) THREADED_OPERATION(26) THREADED_OPERATION(27)
+    THREADED_OPERATION(28) THREADED_OPERATION(29) THREADED_OPERATION(2A) THREADED_OPERATION(2B)
+    THREADED_OPERATION(2C) THREADED_OPERATION(2D) THREADED_OPERATION(2E) THREADED_OPERATION(2F)
+    THREADED_OPERATION(30) THREADED_OPERATION(31) THREADED_OPERATION(32) THREADED_OPERATION(33)
+    THREADED_OPERATION(34) THREADED_OPERATION(35) THREADED_OPERATION(36) THREADED_OPERATION(37)
+    THREADED_OPERATION(38) THREADED_OPERATION(39) THREADED_OPERATION(3A) THREADED_OPERATION(3B)
+    THREADED_OPERATION(3C) THREADED_OPERATION(3D) THREADED_OPERATION(3E) THREADED_OPERATION(3F)
+    THREADED_OPERATION(40) THREADED_OPERATION(41) THREADED_OPERATION(42) THREADED_OPERATION(43)
+    THREADED_OPERATION(44) THREADED_OPERATION(45) THREADED_OPERATION(46) THREADED_OPERATION(47)
+    THREADED_OPERATION(48) THREADED_OPERATION(49) THREADED_OPERATION(4A) THREADED_OPERATION(4B)
+    THREADED_OPERATION(4C) THREADED_OPERATION(4D) THREADED_OPERATION(4E) THREADED_OPERATION(4F)
+    THREADED_OPERATION(50) THREADED_OPERATION(51) THREADED_OPERATION(52) THREADED_OPERATION(53)
+    THREADED_OPERATION(54) THREADED_OPERATION(55) THREADED_OPERATION(56) THREADED_OPERATION(57)
+    THREADED_OPERATION(58) THREADED_OPERATION(59) THREADED_OPERATION(5A) THREADED_OPERATION(5B)
+    THREADED_OPERATION(5C) THREADED_OPERATION(5D) THREADED_OPERATION(5E) THREADED_OPERATION(5F)
+    THREADED_OPERATION(60) THREADED_OPERATION(61) THREADED_OPERATION(62) THREADED_OPERATION(63)
+    THREADED_OPERATION(64) THREADED_OPERATION(65) THREADED_OPERATION(66) THREADED_OPERATION(67)
+    THREADED_OPERATION(68) THREADED_OPERATION(69) THREADED_OPERATION(6A) THREADED_OPERATION(6B)
+    THREADED_OPERATION(6C) THREADED_OPERATION(6D) THREADED_OPERATION(6E) THREADED_OPERATION(6F)
+    THREADED_OPERATION(70) THREADED_OPERATION(71) THREADED_OPERATION(72) THREADED_OPERATION(73)
+    THREADED_OPERATION(74) THREADED_OPERATION(75) THREADED_OPERATION(76) THREADED_OPERATION(77)
+    THREADED_OPERATION(78) THREADED_OPERATION(79) THREADED_OPERATION(7A) THREADED_OPERATION(7B)
+    THREADED_OPERATION(7C) THREADED_OPERATION(7D) THREADED_OPERATION(7E) THREADED_OPERATION(7F)
+    THREADED_OPERATION(80) THREADED_OPERATION(81) THREADED_OPERATION(82) THREADED_OPERATION(83)
+    THREADED_OPERATION(84) THREADED_OPERATION(85) THREADED_OPERATION(86) THREADED_OPERATION(87)
+    THREADED_OPERATION(88) THREADED_OPERATION(89) THREADED_OPERATION(8A) THREADED_OPERATION(8B)
+    THREADED_OPERATION(8C) THREADED_OPERATION(8D) THREADED_OPERATION(8E) THREADED_OPERATION(8F)
+    THREADED_OPERATION(90) THREADED_OPERATION(91) THREADED_OPERATION(92) THREADED_OPERATION(93)
+    THREADED_OPERATION(94) THREADED_OPERATION(95) THREADED_OPERATION(96) THREADED_OPERATION(97)
+    THREADED_OPERATION(98) THREADED_OPERATION(99) THREADED_OPERATION(9A) THREADED_OPERATION(9B)
+    THREADED_OPERATION(9C) THREADED_OPERATION(9D) THREADED_OPERATION(9E) THREADED_OPERATION(9F)
+    THREADED_OPERATION(A0) THREADED_OPERATION(A1) THREADED_OPERATION(A2) THREADED_OPERATION(A3)
+    THREADED_OPERATION(A4) THREADED_OPERATION(A5) THREADED_OPERATION(A6) THREADED_OPERATION(A7)
+    THREADED_OPERATION(A8) THREADED_OPERATION(A9) THREADED_OPERATION(AA) THREADED_OPERATION(AB)
+    THREADED_OPERATION(AC) THREADED_OPERATION(AD) THREADED_OPERATION(AE) THREADED_OPERATION(AF)
+    THREADED_OPERATION(B0) THREADED_OPERATION(B1) THREADED_OPERATION(B2) THREADED_OPERATION(B3)
+    THREADED_OPERATION(B4) THREADED_OPERATION(B5) THREADED_OPERATION(B6) THREADED_OPERATION(B7)
+    THREADED_OPERATION(B8) THREADED_OPERATION(B9) THREADED_OPERATION(BA) THREADED_OPERATION(BB)
+    THREADED_OPERATION(BC) THREADED_OPERATION(BD) THREADED_OPERATION(BE) THREADED_OPERATION(BF)
+    THREADED_OPERATION(C0) THREADED_OPERATION(C1) THREADED_OPERATION(C2) THREADED_OPERATION(C3)
+    THREADED_OPERATION(C4) THREADED_OPERATION(C5) THREADED_OPERATION(C6) THREADED_OPERATION(C7)
+    THREADED_OPERATION(C8) THREADED_OPERATION(C9) THREADED_OPERATION(CA) THREADED_OPERATION(CB)
+    THREADED_OPERATION(CC) THREADED_OPERATION(CD) THREADED_OPERATION(CE) THREADED_OPERATION(CF)
+    THREADED_OPERATION(D0) THREADED_OPERATION(D1) THREADED_OPERATION(D2) THREADED_OPERATION(D3)
+    THREADED_OPERATION(D4) THREADED_OPERATION(D5) THREADED_OPERATION(D6) THREADED_OPERATION(D7)
+    THREADED_OPERATION(D8) THREADED_OPERATION(D9) THREADED_OPERATION(DA) THREADED_OPERATION(DB)
+    THREADED_OPERATION(DC) THREADED_OPERATION(DD) THREADED_OPERATION(DE) THREADED_OPERATION(DF)
+    THREADED_OPERATION(E0) THREADED_OPERATION(E1) THREADED_OPERATION(E2) THREADED_OPERATION(E3)
+    THREADED_OPERATION(E4) THREADED_OPERATION(E5) THREADED_OPERATION(E6) THREADED_OPERATION(E7)
+    THREADED_OPERATION(E8) THREADED_OPERATION(E9) THREADED_OPERATION(EA) THREADED_OPERATION(EB)
+    THREADED_OPERATION(EC) THREADED_OPERATION(ED) THREADED_OPERATION(EE) THREADED_OPERATION(EF)
+    THREADED_OPERATION(F0) THREADED_OPERATION(F1) THREADED_OPERATION(F2) THREADED_OPERATION(F3)
+    THREADED_OPERATION(F4) THREADED_OPERATION(F5) THREADED_OPERATION(F6) THREADED_OPERATION(F7)
+    THREADED_OPERATION(F8) THREADED_OPERATION(F9) THREADED_OPERATION(FA) THREADED_OPERATION(FB)
+    THREADED_OPERATION(FC) THREADED_OPERATION(FD) THREADED_OPERATION(FE) THREADED_OPERATION(FF)
+
+#undef THREADED_OPERATION
+  }
+#endif
+
+  // The opcodes fused to the first one run as part of the same instruction
+  // handler, so the step from one to the next is a compare with a constant
+  // instead of an indirect jump, and the compiler sees the opcodes together.
+  // Every opcode still fetches, finishes and services interrupts exactly as
+  // when run on its own, so cycles & flags are the same.
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V, uint8_t OP>
+  inline typename BasicExecutioner<BusT>::CONTINUATION BasicExecutioner<BusT>::superinstruction(uint32_t& executed, uint32_t instructions)
+  {
+    operation<V, OP>();
+    if constexpr (successors[OP] != -1)
+    {
+      constexpr uint8_t NEXT = (uint8_t)successors[OP];
+
+      cpu->finishInstruction();
+      if (++executed == instructions || !cpu->startInstruction())
+      {
+        return STOP;
+      }
+      if (cpu->opcode != NEXT)
+      {
+        return DISPATCH_NEXT;
+      }
+      return superinstruction<V, NEXT>(executed, instructions);
+    }
+    return FINISH;
+  }
+
+  // Each opcode is a function that tail calls the function of the next opcode.
+  // Returns the number of instructions left of the chain when it is stopped.
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V, uint8_t OP>
+  uint32_t BasicExecutioner<BusT>::tailcall(BasicExecutioner* executioner, uint32_t remaining)
+  {
+    executioner->operation<V, OP>();
+    executioner->cpu->finishInstruction();
+    if (--remaining == 0 || !executioner->cpu->startInstruction())
+    {
+      return remaining;
+    }
+    MUSTTAIL return tailcalls<V>[executioner->cpu->opcode](executioner, remaining);
+  }
+
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V, size_t... OP>
+  constexpr std::array<typename BasicExecutioner<BusT>::TailCallType, 256> BasicExecutioner<BusT>::makeTailCalls(std::index_sequence<OP...>)
+  {
+    return { &BasicExecutioner::tailcall<V, OP>... };
+  }
+
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  const std::array<typename BasicExecutioner<BusT>::TailCallType, 256> BasicExecutioner<BusT>::tailcalls = makeTailCalls<V>(std::make_index_sequence<256>{});
+
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  uint32_t BasicExecutioner<BusT>::runTailCall(uint32_t instructions)
+  {
+    uint32_t remaining = instructions;
+    while (remaining > 0 && cpu->startInstruction())
+    {
+      uint32_t chain = std::min(remaining, TAILCALL_CHAIN);
+      uint32_t left = tailcalls<V>[cpu->opcode](this, chain);
+      remaining -= chain - left;
+      if (left > 0)
+      {
+        // The chain stopped early: a fault, or the cycle, address or
+        // predicate stop of the run was reached
+        break;
+      }
+    }
+    return instructions - remaining;
+  }
+
+  // Translates the block starting at the address into x86-64 code, which
+  // runJit() runs in place of the interpreter. The block is the run of
+  // predecoded instructions from the address, going on past the conditional
+  // branches not taken, up to the end of the page, the first other change of
+  // the flow of control, or an opcode that isn't translated (BRK, RTI,
+  // indirect JMP, the illegal & most of the 65C02 opcodes), which is left to
+  // the interpreter.
+  //
+  // Registers of the generated code:
+  //
+  //   rdi  Jit::CONTEXT           rbx  Page table of the bus (Bus::PAGE)
+  //   r12  AC   r13  X   r14  Y   r15  SR    rbp  SP
+  //   r10  ProcessorBase::nzFlags r11  Alu::adc
+  //
+  // and scratch registers: eax the operand, esi the effective address, edx
+  // its page, r8 the write pointer of the page, r9d whether an indexed read
+  // crossed a page. An instruction makes every check that can leave the
+  // block (before it) first, and writes to memory last. The cycles are those
+  // of the opcode table, which CYCLE_ACCURATE timing adds up to as well
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  void BasicExecutioner<BusT>::translate(uint16_t addr)
+  {
+    typedef Jit::ADDRESS  ADDRESS;
+    typedef Jit::REGISTER REGISTER;
+    using enum Jit::REGISTER;
+
+    auto translatable = [](const OperationType& operation)
+    {
+      switch (operation.mnemonic)
+      {
+        case Mnemonic::BRK:
+        case Mnemonic::RTI:
+          return false;
+        case Mnemonic::JMP:
+          return operation.mode == AddressMode::ABS;
+        case Mnemonic::NOP:
+          return operation.mode == AddressMode::IMP;
+        case Mnemonic::BRA:
+        case Mnemonic::PHX:
+        case Mnemonic::PHY:
+        case Mnemonic::PLX:
+        case Mnemonic::PLY:
+        case Mnemonic::STZ:
+          return true;
+        default:
+          // The documented opcodes come first
+          return operation.mnemonic <= Mnemonic::TYA;
+      }
+    };
+
+    // Gathers the instructions, within what a BLOCK can count
+    std::vector<std::pair<uint16_t, BlockCache::DECODED>> instructions;
+    uint32_t blockCycles = 0;
+    for (uint16_t pc = addr; instructions.size() < UINT8_MAX;)
+    {
+      BlockCache::DECODED* entry = cache.find(pc);
+      if (entry == nullptr)
+      {
+        decodeBlock(pc);
+        entry = cache.find(pc);
+      }
+      if (entry == nullptr)
+      {
+        break;
+      }
+
+      const OperationType& operation = (*operations)[entry->opcode];
+      uint32_t most = operation.cycles + ((operation.policy & BRANCH) ? 2 : (operation.policy & PAGE_CROSS) ? 1 : 0);
+      if (!translatable(operation) || blockCycles + most > UINT8_MAX)
+      {
+        break;
+      }
+      blockCycles += most;
+      instructions.push_back({ pc, *entry });
+
+      uint16_t next = pc + 1 + entry->length;
+      bool conditional = (operation.policy & BRANCH) && operation.mnemonic != Mnemonic::BRA;
+      if ((endsBlock(entry->opcode) && !conditional) || (next & 0xFF00) != (pc & 0xFF00))
+      {
+        break;
+      }
+      pc = next;
+    }
+    if (instructions.empty())
+    {
+      return;
+    }
+
+    // The tables are addressed from the page table, they must be within
+    // reach of a 32-bit displacement
+    // The bus is only visible through the state the executioner is a friend of
+    typename BasicProcessor<BusT>::State& state = *cpu;
+    Jit::MEMORY memory = state.bus->getJitMemory();
+    auto displacement = [&memory](const void* table)
+    {
+      return static_cast<const uint8_t*>(table) - static_cast<const uint8_t*>(memory.pages);
+    };
+    const int64_t dirty = displacement(memory.dirty);
+    const int64_t aliases = displacement(memory.aliases);
+    const int64_t generations = displacement(memory.generations);
+    for (int64_t table : { dirty, aliases, generations })
+    {
+      if (table < INT32_MIN || table > INT32_MAX - 1024)
+      {
+        return;
+      }
+    }
+
+    Jit::Assembler a;
+    auto context = [](size_t offset) { return ADDRESS{ RDI, static_cast<int32_t>(offset) }; };
+    auto page = [](int32_t index, int32_t offset) { return ADDRESS{ RBX, index * 16 + offset }; };
+    auto table = [](int64_t table, int32_t index, REGISTER reg = NOREG, uint8_t scale = 1) { return ADDRESS{ RBX, static_cast<int32_t>(table) + index * scale, reg, scale }; };
+    const uint8_t blockPage = addr >> 8;
+
+    // Where the block is left, the registers are stored by the epilogue
+    struct EXIT
+    {
+      Jit::Assembler::LABEL label;
+      // Address of the next instruction, -1 when it is in esi
+      int32_t  pc;
+      uint32_t instructions;
+      uint32_t cycles;
+      uint8_t  opcode;
+      // Extra cycles of the last instruction, -1 when stored by it
+      int32_t  extra;
+    };
+    std::vector<EXIT> exits;
+    auto leave = [&](int32_t pc, uint32_t count, uint32_t cycles, uint8_t opcode, int32_t extra)
+    {
+      exits.push_back({ a.label(), pc, count, cycles, opcode, extra });
+      return exits.back().label;
+    };
+
+    for (REGISTER reg : { RBX, RBP, R12, R13, R14, R15 })
+    {
+      a.push(reg);
+    }
+    a.mov64(RBX, reinterpret_cast<uint64_t>(memory.pages));
+    a.mov64(R10, reinterpret_cast<uint64_t>(ProcessorBase::nzFlags.data()));
+    a.mov64(R11, reinterpret_cast<uint64_t>(Alu::adc.data()));
+    a.load8(R12, context(offsetof(Jit::CONTEXT, AC)));
+    a.load8(R13, context(offsetof(Jit::CONTEXT, X)));
+    a.load8(R14, context(offsetof(Jit::CONTEXT, Y)));
+    a.load8(R15, context(offsetof(Jit::CONTEXT, SR)));
+    a.load8(RBP, context(offsetof(Jit::CONTEXT, SP)));
+    // Set by startInstruction()
+    a.op(Jit::OR, R15, ProcessorBase::U);
+
+    // Sum of the cycles, opcode & extra cycles of the instructions so far
+    uint32_t cycles = 0;
+    uint8_t  lastOpcode = 0x00;
+    int32_t  lastExtra = 0;
+    size_t   count = 0;
+    bool     ended = false;
+    for (; count < instructions.size() && !ended; count++)
+    {
+      const uint16_t address = instructions[count].first;
+      const BlockCache::DECODED& decoded = instructions[count].second;
+      const OperationType& operation = (*operations)[decoded.opcode];
+      const uint8_t  lo = decoded.operands[0];
+      const uint16_t operand = lo | (decoded.operands[1] << 8);
+      const uint16_t next = address + 1 + decoded.length;
+      const int32_t  extra = (operation.policy & INDEXED_WRITE) ? 1 : (operation.policy & PAGE_CROSS) ? -1 : 0;
+      const uint32_t done = cycles + operation.cycles;
+
+      // Leaves the block with the instruction left to the interpreter
+      std::optional<Jit::Assembler::LABEL> beforeLabel;
+      auto before = [&]()
+      {
+        if (!beforeLabel)
+        {
+          beforeLabel = leave(address, (uint32_t)count, cycles, lastOpcode, lastExtra);
+        }
+        return *beforeLabel;
+      };
+      auto check = [&](REGISTER pointer)
+      {
+        a.test64(pointer, pointer);
+        a.jump(Jit::E, before());
+      };
+      bool wroteBlockPage = false;
+
+      // Flags of a value in a register
+      auto setNZ = [&](REGISTER value)
+      {
+        a.op(Jit::AND, R15, (uint8_t)~(ProcessorBase::N | ProcessorBase::Z));
+        a.op8(Jit::OR, R15, ADDRESS{ R10, 0, value });
+      };
+      auto setCNZ = [&](REGISTER carry, REGISTER value)
+      {
+        a.op(Jit::AND, R15, (uint8_t)~(ProcessorBase::N | ProcessorBase::Z | ProcessorBase::C));
+        a.op(Jit::OR, R15, carry);
+        a.op8(Jit::OR, R15, ADDRESS{ R10, 0, value });
+      };
+
+      // The operand in memory: the page if known, -1 if in edx, and the
+      // address if known, -1 if in esi
+      struct TARGET
+      {
+        int32_t page;
+        int32_t address;
+      };
+      auto locate = [&]() -> TARGET
+      {
+        switch (operation.mode)
+        {
+          case AddressMode::ZP0:
+            return { 0, lo };
+          case AddressMode::ZPX:
+          case AddressMode::ZPY:
+            a.lea(RSI, ADDRESS{ (operation.mode == AddressMode::ZPX) ? R13 : R14, lo });
+            a.movzx8(RSI, RSI);
+            return { 0, -1 };
+          case AddressMode::ABS:
+            return { operand >> 8, operand };
+          case AddressMode::ABX:
+          case AddressMode::ABY:
+          {
+            REGISTER index = (operation.mode == AddressMode::ABX) ? R13 : R14;
+            if (operation.policy & PAGE_CROSS)
+            {
+              a.lea(R9, ADDRESS{ index, lo });
+              a.shift(Jit::SHR, R9, 8);
+            }
+            a.lea(RSI, ADDRESS{ index, operand });
+            a.op(Jit::AND, RSI, 0xFFFF);
+            return { -1, -1 };
+          }
+          case AddressMode::IZX:
+            a.load64(RAX, page(0, 0));
+            check(RAX);
+            a.lea(RCX, ADDRESS{ R13, lo });
+            a.movzx8(RCX, RCX);
+            a.load8(RSI, ADDRESS{ RAX, 0, RCX });
+            a.op(Jit::ADD, RCX, 1);
+            a.movzx8(RCX, RCX);
+            a.load8(RDX, ADDRESS{ RAX, 0, RCX });
+            a.shift(Jit::SHL, RDX, 8);
+            a.op(Jit::OR, RSI, RDX);
+            return { -1, -1 };
+          case AddressMode::IZY:
+          case AddressMode::IZP:
+            a.load64(RAX, page(0, 0));
+            check(RAX);
+            a.load8(RSI, ADDRESS{ RAX, lo });
+            a.load8(RDX, ADDRESS{ RAX, (uint8_t)(lo + 1) });
+            a.shift(Jit::SHL, RDX, 8);
+            a.op(Jit::OR, RSI, RDX);
+            if (operation.mode == AddressMode::IZY)
+            {
+              if (operation.policy & PAGE_CROSS)
+              {
+                a.movzx8(R9, RSI);
+                a.op(Jit::ADD, R9, R14);
+                a.shift(Jit::SHR, R9, 8);
+              }
+              a.op(Jit::ADD, RSI, R14);
+              a.op(Jit::AND, RSI, 0xFFFF);
+            }
+            return { -1, -1 };
+          default:
+            return { -1, -1 };
+        }
+      };
+
+      // Reads the operand into eax
+      auto read = [&](const TARGET& target)
+      {
+        if (target.page >= 0)
+        {
+          a.load64(RAX, page(target.page, 0));
+        }
+        else
+        {
+          a.mov(RDX, RSI);
+          a.shift(Jit::SHR, RDX, 8);
+          a.mov(RCX, RDX);
+          a.shift(Jit::SHL, RCX, 4);
+          a.load64(RAX, ADDRESS{ RBX, 0, RCX });
+        }
+        check(RAX);
+        if (target.address >= 0)
+        {
+          a.load8(RAX, ADDRESS{ RAX, target.address & 0xFF });
+        }
+        else
+        {
+          a.movzx8(RCX, RSI);
+          a.load8(RAX, ADDRESS{ RAX, 0, RCX });
+        }
+      };
+      // The extra cycle of an indexed access crossing a page, once the
+      // instruction can't leave the block any more
+      auto addCrossing = [&]()
+      {
+        if (operation.policy & PAGE_CROSS)
+        {
+          a.op(Jit::ADD, context(offsetof(Jit::CONTEXT, cycles)), R9);
+          a.store8(context(offsetof(Jit::CONTEXT, extra)), R9);
+        }
+      };
+      // The operand of a read
+      auto fetchOperand = [&]()
+      {
+        if (operation.mode == AddressMode::IMM)
+        {
+          a.mov(RAX, (uint32_t)lo);
+          return;
+        }
+        read(locate());
+        addCrossing();
+      };
+
+      // Loads the write pointer of the page into r8, the page must be
+      // ram (or rom that ignores writes) that no other page shares
+      auto prepareWrite = [&](const TARGET& target)
+      {
+        if (target.page >= 0)
+        {
+          a.load64(R8, page(target.page, 8));
+          check(R8);
+          a.op8(Jit::CMP, table(aliases, target.page), (uint8_t)target.page);
+        }
+        else
+        {
+          a.mov(RDX, RSI);
+          a.shift(Jit::SHR, RDX, 8);
+          a.mov(RCX, RDX);
+          a.shift(Jit::SHL, RCX, 4);
+          a.load64(R8, ADDRESS{ RBX, 8, RCX });
+          check(R8);
+          a.op8(Jit::CMP, table(aliases, 0, RDX), RDX);
+        }
+        a.jump(Jit::NE, before());
+      };
+      // Writes the byte as Bus::write() does, marking the row dirty and
+      // bumping the generation of the page. Nothing can leave the block
+      // before the instruction any more
+      auto write = [&](const TARGET& target, auto value)
+      {
+        ADDRESS destination = ADDRESS{ R8, target.address & 0xFF };
+        if (target.address < 0)
+        {
+          a.movzx8(RCX, RSI);
+          destination = ADDRESS{ R8, 0, RCX };
+        }
+        a.store8(destination, value);
+
+        if (target.address >= 0)
+        {
+          uint16_t row = (uint16_t)(1 << ((target.address >> 4) & 0x0F));
+          a.op16(Jit::OR, table(dirty, target.page, NOREG, 2), row);
+        }
+        else
+        {
+          a.mov(RCX, RSI);
+          a.shift(Jit::SHR, RCX, 4);
+          a.op(Jit::AND, RCX, 0x0F);
+          a.mov(RAX, 1u);
+          a.shift(Jit::SHL, RAX);
+          if (target.page >= 0)
+          {
+            a.op16(Jit::OR, table(dirty, target.page, NOREG, 2), RAX);
+          }
+          else
+          {
+            a.op16(Jit::OR, table(dirty, 0, RDX, 2), RAX);
+          }
+        }
+
+        if (target.page >= 0)
+        {
+          a.inc(table(generations, target.page, NOREG, 4));
+          wroteBlockPage |= (target.page == blockPage);
+        }
+        else
+        {
+          a.inc(table(generations, 0, RDX, 4));
+          // The block is stale if it wrote to its own page
+          a.op(Jit::CMP, RDX, (uint32_t)blockPage);
+          a.jump(Jit::E, leave(next, (uint32_t)count + 1, done, decoded.opcode, extra));
+        }
+      };
+      // The stack, at 0x100 + SP
+      const TARGET stack = { 1, -1 };
+      auto push = [&](auto value)
+      {
+        a.lea(RSI, ADDRESS{ RBP, 0x100 });
+        write(stack, value);
+        a.op(Jit::SUB, RBP, 1u);
+        a.movzx8(RBP, RBP);
+      };
+
+      // Read-modify-write operations, on eax
+      auto modify = [&]()
+      {
+        switch (operation.mnemonic)
+        {
+          case Mnemonic::ASL:
+            a.mov(RCX, RAX);
+            a.shift(Jit::SHR, RCX, 7);
+            a.op(Jit::ADD, RAX, RAX);
+            a.movzx8(RAX, RAX);
+            setCNZ(RCX, RAX);
+            break;
+          case Mnemonic::LSR:
+            a.mov(RCX, RAX);
+            a.op(Jit::AND, RCX, 1u);
+            a.shift(Jit::SHR, RAX, 1);
+            setCNZ(RCX, RAX);
+            break;
+          case Mnemonic::ROL:
+            a.mov(RCX, R15);
+            a.op(Jit::AND, RCX, 1u);
+            a.lea(RAX, ADDRESS{ RCX, 0, RAX, 2 });
+            a.mov(RCX, RAX);
+            a.shift(Jit::SHR, RCX, 8);
+            a.movzx8(RAX, RAX);
+            setCNZ(RCX, RAX);
+            break;
+          case Mnemonic::ROR:
+            a.mov(RCX, R15);
+            a.op(Jit::AND, RCX, 1u);
+            a.shift(Jit::SHL, RCX, 8);
+            a.op(Jit::OR, RAX, RCX);
+            a.mov(RCX, RAX);
+            a.op(Jit::AND, RCX, 1u);
+            a.shift(Jit::SHR, RAX, 1);
+            setCNZ(RCX, RAX);
+            break;
+          case Mnemonic::INC:
+          case Mnemonic::DEC:
+            a.op((operation.mnemonic == Mnemonic::INC) ? Jit::ADD : Jit::SUB, RAX, 1u);
+            a.movzx8(RAX, RAX);
+            setNZ(RAX);
+            break;
+          default:
+            break;
+        }
+      };
+
+      // The register an opcode loads, stores or compares
+      auto registerOf = [&]()
+      {
+        switch (operation.mnemonic)
+        {
+          case Mnemonic::LDX:
+          case Mnemonic::STX:
+          case Mnemonic::CPX:
+          case Mnemonic::INX:
+          case Mnemonic::DEX:
+          case Mnemonic::PHX:
+          case Mnemonic::PLX:
+            return R13;
+          case Mnemonic::LDY:
+          case Mnemonic::STY:
+          case Mnemonic::CPY:
+          case Mnemonic::INY:
+          case Mnemonic::DEY:
+          case Mnemonic::PHY:
+          case Mnemonic::PLY:
+            return R14;
+          default:
+            return R12;
+        }
+      };
+      // Leaves the block for the target of a branch taken
+      auto taken = [&]()
+      {
+        uint8_t penalty = 1 << ((decoded.target & 0xFF00) != ((address + 1) & 0xFF00));
+        return leave(decoded.target, (uint32_t)count + 1, done + penalty, decoded.opcode, penalty);
+      };
+
+      switch (operation.mnemonic)
+      {
+        case Mnemonic::LDA:
+        case Mnemonic::LDX:
+        case Mnemonic::LDY:
+          fetchOperand();
+          a.mov(registerOf(), RAX);
+          setNZ(RAX);
+          break;
+        case Mnemonic::STA:
+        case Mnemonic::STX:
+        case Mnemonic::STY:
+        case Mnemonic::STZ:
+        {
+          TARGET target = locate();
+          prepareWrite(target);
+          if (operation.mnemonic == Mnemonic::STZ)
+          {
+            write(target, (uint8_t)0x00);
+          }
+          else
+          {
+            write(target, registerOf());
+          }
+          break;
+        }
+        case Mnemonic::AND:
+        case Mnemonic::ORA:
+        case Mnemonic::EOR:
+          fetchOperand();
+          a.op((operation.mnemonic == Mnemonic::AND) ? Jit::AND : (operation.mnemonic == Mnemonic::ORA) ? Jit::OR : Jit::XOR, R12, RAX);
+          setNZ(R12);
+          break;
+        case Mnemonic::ADC:
+        case Mnemonic::SBC:
+#ifdef DECIMAL_MODE
+          if constexpr (V != RICOH2A03)
+          {
+            a.test8(R15, ProcessorBase::D);
+            a.jump(Jit::NE, before());
+          }
+#endif
+          fetchOperand();
+          if (operation.mnemonic == Mnemonic::SBC)
+          {
+            a.op(Jit::XOR, RAX, 0xFFu);
+          }
+          // Alu::index(), then the result & the flags from Alu::adc
+          a.mov(RCX, R15);
+          a.op(Jit::AND, RCX, 1u);
+          a.shift(Jit::SHL, RCX, 8);
+          a.op(Jit::OR, RCX, R12);
+          a.shift(Jit::SHL, RCX, 8);
+          a.op(Jit::OR, RCX, RAX);
+          a.load16(RAX, ADDRESS{ R11, 0, RCX, 2 });
+          a.movzx8(R12, RAX);
+          a.shift(Jit::SHR, RAX, 8);
+          a.op(Jit::AND, R15, (uint8_t)~Alu::BINARY_FLAGS);
+          a.op(Jit::OR, R15, RAX);
+          break;
+        case Mnemonic::CMP:
+        case Mnemonic::CPX:
+        case Mnemonic::CPY:
+          fetchOperand();
+          a.mov(RCX, registerOf());
+          a.op(Jit::SUB, RCX, RAX);
+          a.set(Jit::AE, RAX);
+          a.movzx8(RAX, RAX);
+          a.movzx8(RCX, RCX);
+          setCNZ(RAX, RCX);
+          break;
+        case Mnemonic::BIT:
+          fetchOperand();
+          a.mov(RCX, RAX);
+          a.op(Jit::AND, RCX, R12);
+          a.load8(RCX, ADDRESS{ R10, 0, RCX });
+          a.op(Jit::AND, RCX, (uint32_t)ProcessorBase::Z);
+          if (operation.mode == AddressMode::IMM)
+          {
+            a.op(Jit::AND, R15, (uint8_t)~ProcessorBase::Z);
+          }
+          else
+          {
+            a.op(Jit::AND, RAX, (uint32_t)(ProcessorBase::N | ProcessorBase::V));
+            a.op(Jit::AND, R15, (uint8_t)~(ProcessorBase::N | ProcessorBase::V | ProcessorBase::Z));
+            a.op(Jit::OR, R15, RAX);
+          }
+          a.op(Jit::OR, R15, RCX);
+          break;
+        case Mnemonic::ASL:
+        case Mnemonic::LSR:
+        case Mnemonic::ROL:
+        case Mnemonic::ROR:
+        case Mnemonic::INC:
+        case Mnemonic::DEC:
+          if (operation.mode == AddressMode::ACC)
+          {
+            a.mov(RAX, R12);
+            modify();
+            a.mov(R12, RAX);
+          }
+          else
+          {
+            TARGET target = locate();
+            read(target);
+            prepareWrite(target);
+            // The shifts of the 65C02 only take the indexed cycle on a page
+            // crossing
+            addCrossing();
+            // The old value is written first, which only a handler could tell
+            modify();
+            write(target, RAX);
+          }
+          break;
+        case Mnemonic::INX:
+        case Mnemonic::INY:
+        case Mnemonic::DEX:
+        case Mnemonic::DEY:
+        {
+          REGISTER reg = registerOf();
+          a.op((operation.mnemonic == Mnemonic::INX || operation.mnemonic == Mnemonic::INY) ? Jit::ADD : Jit::SUB, reg, 1u);
+          a.movzx8(reg, reg);
+          setNZ(reg);
+          break;
+        }
+        case Mnemonic::TAX:
+        case Mnemonic::TAY:
+          a.mov((operation.mnemonic == Mnemonic::TAX) ? R13 : R14, R12);
+          setNZ(R12);
+          break;
+        case Mnemonic::TXA:
+        case Mnemonic::TYA:
+          a.mov(R12, (operation.mnemonic == Mnemonic::TXA) ? R13 : R14);
+          setNZ(R12);
+          break;
+        case Mnemonic::TSX:
+          a.mov(R13, RBP);
+          setNZ(R13);
+          break;
+        case Mnemonic::TXS:
+          a.mov(RBP, R13);
+          break;
+        case Mnemonic::CLC: a.op(Jit::AND, R15, (uint8_t)~ProcessorBase::C); break;
+        case Mnemonic::CLD: a.op(Jit::AND, R15, (uint8_t)~ProcessorBase::D); break;
+        case Mnemonic::CLI: a.op(Jit::AND, R15, (uint8_t)~ProcessorBase::I); break;
+        case Mnemonic::CLV: a.op(Jit::AND, R15, (uint8_t)~ProcessorBase::V); break;
+        case Mnemonic::SEC: a.op(Jit::OR, R15, (uint32_t)ProcessorBase::C); break;
+        case Mnemonic::SED: a.op(Jit::OR, R15, (uint32_t)ProcessorBase::D); break;
+        case Mnemonic::SEI: a.op(Jit::OR, R15, (uint32_t)ProcessorBase::I); break;
+        case Mnemonic::NOP:
+          break;
+        case Mnemonic::PHA:
+        case Mnemonic::PHX:
+        case Mnemonic::PHY:
+          prepareWrite(stack);
+          push(registerOf());
+          break;
+        case Mnemonic::PHP:
+          prepareWrite(stack);
+          a.mov(RAX, R15);
+          a.op(Jit::OR, RAX, (uint32_t)(ProcessorBase::B | ProcessorBase::U));
+          push(RAX);
+          break;
+        case Mnemonic::PLA:
+        case Mnemonic::PLX:
+        case Mnemonic::PLY:
+        case Mnemonic::PLP:
+          a.lea(RSI, ADDRESS{ RBP, 1 });
+          a.movzx8(RSI, RSI);
+          read(stack);
+          a.mov(RBP, RSI);
+          if (operation.mnemonic == Mnemonic::PLP)
+          {
+            a.mov(R15, RAX);
+            a.op(Jit::OR, R15, (uint32_t)ProcessorBase::U);
+          }
+          else
+          {
+            a.mov(registerOf(), RAX);
+            setNZ(RAX);
+          }
+          break;
+        case Mnemonic::JSR:
+          prepareWrite(stack);
+          push((uint8_t)((address + 2) >> 8));
+          push((uint8_t)((address + 2) & 0xFF));
+          a.jump(leave(operand, (uint32_t)count + 1, done, decoded.opcode, extra));
+          ended = true;
+          break;
+        case Mnemonic::RTS:
+          a.load64(RAX, page(1, 0));
+          check(RAX);
+          a.lea(RCX, ADDRESS{ RBP, 1 });
+          a.movzx8(RCX, RCX);
+          a.load8(RSI, ADDRESS{ RAX, 0, RCX });
+          a.lea(RCX, ADDRESS{ RBP, 2 });
+          a.movzx8(RCX, RCX);
+          a.load8(RDX, ADDRESS{ RAX, 0, RCX });
+          a.mov(RBP, RCX);
+          a.shift(Jit::SHL, RDX, 8);
+          a.op(Jit::OR, RSI, RDX);
+          a.op(Jit::ADD, RSI, 1u);
+          a.op(Jit::AND, RSI, 0xFFFFu);
+          a.jump(leave(-1, (uint32_t)count + 1, done, decoded.opcode, extra));
+          ended = true;
+          break;
+        case Mnemonic::JMP:
+          a.jump(leave(operand, (uint32_t)count + 1, done, decoded.opcode, extra));
+          ended = true;
+          break;
+        case Mnemonic::BRA:
+          a.jump(taken());
+          ended = true;
+          break;
+        default:
+        {
+          // The conditional branches, on the flag & the value it must have
+          uint8_t flag = 0;
+          bool set = false;
+          switch (operation.mnemonic)
+          {
+            case Mnemonic::BPL: flag = ProcessorBase::N; break;
+            case Mnemonic::BMI: flag = ProcessorBase::N; set = true; break;
+            case Mnemonic::BVC: flag = ProcessorBase::V; break;
+            case Mnemonic::BVS: flag = ProcessorBase::V; set = true; break;
+            case Mnemonic::BCC: flag = ProcessorBase::C; break;
+            case Mnemonic::BCS: flag = ProcessorBase::C; set = true; break;
+            case Mnemonic::BNE: flag = ProcessorBase::Z; break;
+            case Mnemonic::BEQ: flag = ProcessorBase::Z; set = true; break;
+            default: break;
+          }
+          a.test8(R15, flag);
+          a.jump(set ? Jit::NE : Jit::E, taken());
+          break;
+        }
+      }
+
+      cycles = done;
+      lastOpcode = decoded.opcode;
+      lastExtra = extra;
+      if (wroteBlockPage && !ended)
+      {
+        // The rest of the block may have been overwritten
+        a.jump(leave(next, (uint32_t)count + 1, cycles, lastOpcode, lastExtra));
+        ended = true;
+      }
+    }
+    if (!ended)
+    {
+      const BlockCache::DECODED& decoded = instructions[count - 1].second;
+      a.jump(leave(instructions[count - 1].first + 1 + decoded.length, (uint32_t)count, cycles, lastOpcode, lastExtra));
+    }
+
+    // The exits store where the block was left, then the epilogue the
+    // registers
+    Jit::Assembler::LABEL epilogue = a.label();
+    for (const EXIT& exit : exits)
+    {
+      a.bind(exit.label);
+      if (exit.pc < 0)
+      {
+        a.store16(context(offsetof(Jit::CONTEXT, PC)), RSI);
+      }
+      else
+      {
+        a.store16(context(offsetof(Jit::CONTEXT, PC)), (uint16_t)exit.pc);
+      }
+      a.store32(context(offsetof(Jit::CONTEXT, instructions)), exit.instructions);
+      if (exit.instructions > 0)
+      {
+        if (exit.cycles > 0)
+        {
+          a.op(Jit::ADD, context(offsetof(Jit::CONTEXT, cycles)), exit.cycles);
+        }
+        a.store8(context(offsetof(Jit::CONTEXT, opcode)), exit.opcode);
+        if (exit.extra >= 0)
+        {
+          a.store8(context(offsetof(Jit::CONTEXT, extra)), (uint8_t)exit.extra);
+        }
+      }
+      a.jump(epilogue);
+    }
+    a.bind(epilogue);
+    a.store8(context(offsetof(Jit::CONTEXT, AC)), R12);
+    a.store8(context(offsetof(Jit::CONTEXT, X)), R13);
+    a.store8(context(offsetof(Jit::CONTEXT, Y)), R14);
+    a.store8(context(offsetof(Jit::CONTEXT, SR)), R15);
+    a.store8(context(offsetof(Jit::CONTEXT, SP)), RBP);
+    for (REGISTER reg : { R15, R14, R13, R12, RBP, RBX })
+    {
+      a.pop(reg);
+    }
+    a.ret();
+
+    Jit::BlockType code = jit.install(a.finish());
+    if (code != nullptr)
+    {
+      // Only the instructions up to the first leaving the block for good
+      // can run
+      uint32_t most = 0;
+      for (size_t i = 0; i < count; i++)
+      {
+        const OperationType& operation = (*operations)[instructions[i].second.opcode];
+        most += operation.cycles + ((operation.policy & BRANCH) ? 2 : (operation.policy & PAGE_CROSS) ? 1 : 0);
+      }
+
+      Jit::BLOCK& block = jit.block(addr);
+      block.code = code;
+      block.generation = cache.getGeneration(addr);
+      block.length = (uint8_t)count;
+      block.last = instructions[count - 1].first & 0xFF;
+      block.cycles = (uint8_t)most;
+    }
+  }
+
+  // Interprets instructions while counting how often every address is run,
+  // and runs the translated block instead once the address is hot. The
+  // predecoded instructions of the block cache are what gets translated, and
+  // its page generations tell when a block went stale. A block only runs
+  // when nothing has to look between its instructions (see
+  // Processor::canRunBlock()), and it leaves the instruction it can't run to
+  // the interpreter.
+  template <typename BusT>
+  template <ExecutionerBase::VARIANT V>
+  uint32_t BasicExecutioner<BusT>::runJit(uint32_t instructions)
+  {
+    if (!cache.isEnabled())
+    {
+      setBlockCache(true);
+    }
+
+    uint32_t executed = 0;
+    Jit::CONTEXT context;
+    while (executed < instructions)
+    {
+      uint16_t pc = cpu->getProgramCounter();
+      Jit::BLOCK& block = jit.block(pc);
+      if (block.code != nullptr && block.generation != cache.getGeneration(pc))
+      {
+        // The code was overwritten, it must get hot again to be translated
+        block.code = nullptr;
+        block.hits = 0;
+      }
+
+      if (block.code != nullptr && block.length <= instructions - executed &&
+          cpu->canRunBlock(pc, (pc & 0xFF00) | block.last, block.cycles))
+      {
+        cpu->syncFlags();
+        context.AC = cpu->reg.AC;
+        context.X = cpu->reg.X;
+        context.Y = cpu->reg.Y;
+        context.SP = cpu->reg.SP;
+        context.SR = cpu->reg.SR;
+        context.cycles = 0;
+        block.code(&context);
+        cpu->reg.AC = context.AC;
+        cpu->reg.X = context.X;
+        cpu->reg.Y = context.Y;
+        cpu->reg.SP = context.SP;
+        cpu->reg.SR = context.SR;
+        cpu->reg.PC = context.PC;
+        cpu->loadFlags();
+
+        if (context.instructions > 0)
+        {
+          // As finishInstruction() leaves the last one
+          cpu->opcode = context.opcode;
+          cpu->extra_cycles = context.extra;
+          cpu->total_cycles += context.cycles;
+          cpu->cycle_count += context.cycles;
+          cpu->clock_count += context.instructions;
+          cpu->_interrupt = cpu->_previousInterrupt = false;
+          executed += context.instructions;
+          continue;
+        }
+        // The first instruction is left to the interpreter
+      }
+
+      if (!cpu->startInstruction())
+      {
+        break;
+      }
+      execute(cpu->opcode);
+      cpu->finishInstruction();
+      executed++;
+
+      if (block.code == nullptr && ++block.hits == Jit::HOT_THRESHOLD)
+      {
+        translate<V>(pc);
+      }
+    }
+    return executed;
+  }
+#pragma endregion DISPATCH ENGINES
+};
@@ -1,8 +1,17 @@
 #pragma once
 
+#include <array>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <map>
+#include <stdexcept>
+
+#include "BlockCache.hpp"
+#include "Jit.hpp"
+#include "OpcodeProfile.hpp"
 
 #ifdef SPDLOG_FMT_EXTERNAL
 #include <fmt/format.h>
@@ -17,18 +26,233 @@
 #include <spdlog/sinks/basic_file_sink.h>
 #endif
 
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(clang::musttail)
+#define TAILCALL_GUARANTEED 1
+#define MUSTTAIL [[clang::musttail]]
+#endif
+#endif
+#ifndef MUSTTAIL
+#define TAILCALL_GUARANTEED 0
+#define MUSTTAIL
+#endif
+
+// Computed goto is an extension available in GCC & Clang
+#if defined(__GNUC__)
+#define THREADED_DISPATCH 1
+#endif
+
+// The dispatch engine used unless changed with setDispatch(), can be chosen
+// at build time with -DDISPATCH=<engine>
+#ifndef DEFAULT_DISPATCH
+#if defined(__clang__)
+#define DEFAULT_DISPATCH TAILCALL
+#elif defined(THREADED_DISPATCH)
+#define DEFAULT_DISPATCH THREADED
+#else
+#define DEFAULT_DISPATCH SWITCH
+#endif
+#endif
+
+// The processor emulated unless another one is given to the constructor,
+// EMULATE65C02 makes it the 65C02
+#ifndef DEFAULT_VARIANT
+#ifdef EMULATE65C02
+#define DEFAULT_VARIANT WDC65C02
+#else
+#define DEFAULT_VARIANT MOS6502
+#endif
+#endif
+
 namespace CPU
 {
-  class Processor;
+  template <typename BusT>
+  class BasicProcessor;
+  class Bus;
   class Logger;
-  class Executioner
+
+  // The types of the Executioner, shared by every instantiation of
+  // BasicExecutioner
+  class ExecutionerBase
   {
   public:
-    Executioner();
-    ~Executioner();
+    // The processors of the 6502 family that can be emulated. Every variant
+    // has its own opcode table (see Instructions.hpp) and its own
+    // instantiation of the dispatch engines, so the differences between them
+    // are resolved at compile time rather than checked on every instruction.
+    enum VARIANT
+    {
+      // The NMOS 6502, including its illegal opcodes
+      MOS6502 = 0,
+      // The CMOS 65C02 (WDC), with its new opcodes & addressing modes, the
+      // indirect jump bug fixed and the illegal opcodes turned into NOPs
+      WDC65C02 = 1,
+      // The 2A03 of the NES, a 6502 without decimal mode
+      RICOH2A03 = 2,
+    };
+
+    // The interpreter loops available to run instructions. They all execute
+    // the same opcode table and must produce identical results, they only
+    // differ in how the next instruction is dispatched.
+    enum DISPATCH
+    {
+      // Member function pointers looked up in the opcode table
+      TABLE = 0,
+      // A single switch statement over all 256 opcodes
+      SWITCH = 1,
+      // Computed goto, jumps directly from one opcode to the next
+      // (GCC & Clang only, falls back to SWITCH elsewhere)
+      THREADED = 2,
+      // Every opcode is a function that tail calls the next one
+      TAILCALL = 3,
+      // Hot basic blocks are translated into native code, see Jit. Turns
+      // on the block cache (x86-64 & the Bus only, falls back to SWITCH
+      // elsewhere)
+      JIT = 4,
+      // THREADED, running the pairs of opcodes listed as superinstructions
+      // (see Instructions.hpp) without dispatching between them
+      SUPERINSTRUCTION = 5,
+    };
+
+    // Addressing modes, one for each addressing mode handler
+    enum class AddressMode : uint8_t
+    {
+      ACC, IMP, IMM, REL, ZP0, ZPX, ZPY, ABS,
+      ABX, ABY, IND, IZX, IZY,
+      // 65C02 addressing modes
+      IZP, IAX,
+    };
+
+    // Instruction mnemonics, one for each operation handler
+    enum class Mnemonic : uint8_t
+    {
+      ADC, AND, ASL, BCC, BCS, BEQ, BIT, BMI,
+      BNE, BPL, BRK, BVC, BVS, CLC, CLD, CLI,
+      CLV, CMP, CPX, CPY, DEC, DEX, DEY, EOR,
+      INC, INX, INY, JMP, JSR, LDA, LDX, LDY,
+      LSR, NOP, ORA, PHA, PHP, PLA, PLP, ROL,
+      ROR, RTI, RTS, SBC, SEC, SED, SEI, STA,
+      STX, STY, TAX, TAY, TSX, TXA, TXS, TYA,
+      // Illegal opcodes
+      ALR, ANC, ANC2, ANE, ARR, DCP, ISC, LAS,
+      LAX, LXA, RLA, RRA, SAX, SBX, SHA, SHX,
+      SHY, SLO, SRE, TAS, USBC, DOP, TOP, JAM,
+      // 65C02 opcodes
+      BRA, PHX, PHY, PLX, PLY, STP, STZ, TRB,
+      TSB, WAI,
+      // Invalid opcode
+      XXX,
+    };
+
+    // Extra cycles an opcode takes on top of its memory accesses, depending
+    // on the outcome of the addressing
+    enum CYCLEPOLICY : uint8_t
+    {
+      // No extra cycles
+      NONE = 0,
+      // One extra cycle when indexing crosses a page boundary
+      PAGE_CROSS = (1 << 0),
+      // One extra cycle always, stores and read-modify-write instructions
+      // using indexed addressing always fix up the high byte of the address
+      INDEXED_WRITE = (1 << 1),
+      // One extra cycle when the branch is taken, two if it crosses a page
+      BRANCH = (1 << 2),
+    };
+
+    static constexpr std::array<std::string_view, 15> addressModeNames = {{
+      "ACC", "IMP", "IMM", "REL", "ZP0", "ZPX", "ZPY", "ABS", "ABX", "ABY", "IND", "IZX", "IZY",
+      "IZP", "IAX"
+    }};
+
+    static constexpr std::array<std::string_view, 91> mnemonicNames = {{
+      "ADC", "AND", "ASL", "BCC", "BCS", "BEQ", "BIT", "BMI",
+      "BNE", "BPL", "BRK", "BVC", "BVS", "CLC", "CLD", "CLI",
+      "CLV", "CMP", "CPX", "CPY", "DEC", "DEX", "DEY", "EOR",
+      "INC", "INX", "INY", "JMP", "JSR", "LDA", "LDX", "LDY",
+      "LSR", "NOP", "ORA", "PHA", "PHP", "PLA", "PLP", "ROL",
+      "ROR", "RTI", "RTS", "SBC", "SEC", "SED", "SEI", "STA",
+      "STX", "STY", "TAX", "TAY", "TSX", "TXA", "TXS", "TYA",
+      "ALR", "ANC", "ANC2", "ANE", "ARR", "DCP", "ISC", "LAS",
+      "LAX", "LXA", "RLA", "RRA", "SAX", "SBX", "SHA", "SHX",
+      "SHY", "SLO", "SRE", "TAS", "USBC", "DOP", "TOP", "JAM",
+      "BRA", "PHX", "PHY", "PLX", "PLY", "STP", "STZ", "TRB",
+      "TSB", "WAI",
+      "XXX",
+    }};
+
+    // Number of operand bytes following the opcode
+    static constexpr uint8_t operandLength(AddressMode mode)
+    {
+      switch (mode)
+      {
+        case AddressMode::ACC:
+        case AddressMode::IMP:
+          return 0;
+        case AddressMode::ABS:
+        case AddressMode::ABX:
+        case AddressMode::ABY:
+        case AddressMode::IND:
+        case AddressMode::IAX:
+          return 2;
+        default:
+          return 1;
+      }
+    }
+
+    static constexpr uint8_t cyclePolicy(Mnemonic mnemonic, AddressMode mode)
+    {
+      switch (mnemonic)
+      {
+        case Mnemonic::BCC:
+        case Mnemonic::BCS:
+        case Mnemonic::BEQ:
+        case Mnemonic::BMI:
+        case Mnemonic::BNE:
+        case Mnemonic::BPL:
+        case Mnemonic::BVC:
+        case Mnemonic::BVS:
+        case Mnemonic::BRA:
+          return BRANCH;
+        case Mnemonic::STA:
+        case Mnemonic::STZ:
+          return (mode == AddressMode::ABX || mode == AddressMode::ABY || mode == AddressMode::IZY) ? INDEXED_WRITE : NONE;
+        case Mnemonic::ASL:
+        case Mnemonic::DEC:
+        case Mnemonic::INC:
+        case Mnemonic::LSR:
+        case Mnemonic::ROL:
+        case Mnemonic::ROR:
+          return (mode == AddressMode::ABX) ? INDEXED_WRITE : NONE;
+        default:
+          return (mode == AddressMode::ABX || mode == AddressMode::ABY || mode == AddressMode::IZY) ? PAGE_CROSS : NONE;
+      }
+    }
+
+    template <typename T, size_t N>
+    static constexpr T fromName(const std::array<std::string_view, N>& names, std::string_view name)
+    {
+      for (size_t i = 0; i < N; i++)
+      {
+        if (names[i] == name)
+        {
+          return static_cast<T>(i);
+        }
+      }
+      throw std::invalid_argument("Unknown name in opcode table");
+    }
+  };
+
+  // Executes the instructions of a BasicProcessor. Like the processor it is
+  // a template on the type of the bus, see BasicProcessor
+  template <typename BusT>
+  class BasicExecutioner : public ExecutionerBase
+  {
+  public:
+    BasicExecutioner(VARIANT variant = DEFAULT_VARIANT);
+    ~BasicExecutioner();
 
   public:
-    void ConnectCpu(Processor* n) { cpu = n; }
+    void ConnectCpu(BasicProcessor<BusT>* n) { cpu = n; }
 
     void breakOperation(bool isBreak, uint16_t vector);
     void branchOperation(bool performBranch);
@@ -36,7 +260,33 @@ namespace CPU
     void reset();
 
   public:
-    typedef uint8_t(Executioner::* ExecutionType)(void);
+    void     setDispatch(DISPATCH engine) { dispatch = engine; }
+    DISPATCH getDispatch() { return dispatch; }
+
+    // The variant is chosen when the processor is constructed
+    VARIANT  getVariant() { return variant; }
+
+    // Executes up to the given number of instructions with the selected
+    // dispatch engine, returns the number of instructions executed
+    uint32_t run(uint32_t instructions);
+
+    // Predecoded instructions, see BlockCache. Disabled by default
+    BlockCache cache;
+
+    void setBlockCache(bool enable);
+    // Reads the opcode at the address, through the block cache
+    uint8_t fetchOpcode(uint16_t addr);
+
+    // Counts of the opcode sequences executed, see OpcodeProfile. While
+    // enabled, run() uses the TABLE engine
+    OpcodeProfile profile;
+
+    // Back to the settings of a new executioner: the default dispatch
+    // engine, no block cache and no profile (its counts cleared)
+    void restoreDefaults();
+
+  public:
+    typedef uint8_t(BasicExecutioner::* ExecutionType)(void);
 
     // This structure are used to compile and store
     // the opcode translation tables.
@@ -45,7 +295,10 @@ namespace CPU
 	    // Function: A function pointer to the implementation of the opcode
       ExecutionType op = nullptr;
       // Mnemonic: A textual representation of the instruction (used for disassembly)
-      std::string name;
+      std::string_view name;
+
+      // Formatted with operator<<, see Formatters.hpp
+      typedef std::true_type streamed;
 
       friend std::ostream &operator<<(std::ostream &os, const tMode& obj)
       {
@@ -54,8 +307,8 @@ namespace CPU
       }
     };
 
-    // This structure and the following map are used to compile and store
-    // the opcode translation tables.
+    // This structure is used to compile and store the opcode translation
+    // table, see Instructions.hpp
     struct OperationType
     {
       // Opcode Function : The opcode used by the instruction
@@ -65,6 +318,25 @@ namespace CPU
       // Cycle Count : An integer that represents the base number of clock cycles the
       //               CPU requires to perform the instruction
       uint8_t cycles = 0;
+      // Decoded from the names above, so the emulator never compares strings
+      Mnemonic    mnemonic = Mnemonic::XXX;
+      AddressMode mode = AddressMode::IMP;
+      // Operand Length : Number of bytes following the opcode
+      uint8_t     length = 0;
+      // Cycle Policy : CYCLEPOLICY bits, the extra cycles the opcode may take
+      uint8_t     policy = NONE;
+
+      constexpr OperationType(tMode operate, tMode addrmode, uint8_t cycles)
+        : operate(operate), addrmode(addrmode), cycles(cycles),
+          mnemonic(fromName<Mnemonic>(mnemonicNames, operate.name)),
+          mode(fromName<AddressMode>(addressModeNames, addrmode.name)),
+          length(operandLength(mode)),
+          policy(cyclePolicy(mnemonic, mode))
+      {
+      }
+
+      // Formatted with operator<<, see Formatters.hpp
+      typedef std::true_type streamed;
 
       friend std::ostream &operator<<(std::ostream &os, const OperationType& obj)
       {
@@ -77,38 +349,40 @@ namespace CPU
       }
     };
 
-    std::map<uint8_t, OperationType> lookup = {};
-
 
   private:
-    Processor* cpu = nullptr;
-
-    // Is the instruction byte
-    uint8_t* opcode = nullptr;
-    // Counts how many cycles the instruction has remaining
-    uint8_t* cycle_count = nullptr;
-    // A global accumulation of the number of clocks
-    uint32_t* clock_count = nullptr;
-
-    // Assistive variables to facilitate emulation
-
-    // 8-bit - Represents the working input value to the ALU
-    uint8_t  fetched = 0x00;
-    // 8-bit - A convenience variable used everywhere
-    // @deprecated
-    uint16_t temp = 0x0000;
-    // 16-bit - All used memory addresses end up in here
-    uint16_t addr_abs = 0x0000;
-    // 16bit - Represents absolute address following a branch
-    uint16_t addr_rel = 0x0000;
+    BasicProcessor<BusT>* cpu = nullptr;
+
+    DISPATCH dispatch = DEFAULT_DISPATCH;
+
+    VARIANT variant;
+    // The opcode table of the variant, and its fused opcodes (see Op())
+    const std::array<OperationType, 256>* operations = nullptr;
+    const std::array<ExecutionType, 256>* fusedOperations = nullptr;
+
+    // The assistive variables (fetched, addr_abs, ...) are kept with the
+    // registers in ProcessorState, on the hot cache line of the processor
 
     // The read location of data can come from two sources, a memory address, or
     // its immediately available as part of the instruction. This function decides
     // depending on address mode of instruction byte
     uint8_t fetch();
 
-    // Populates all instructions for the 6502 CPU into the lookup-map
-    void loadInstructions();
+    // The predecoded instruction being executed, nullptr when it was not
+    // found in the block cache
+    BlockCache::DECODED* decoded = nullptr;
+    uint16_t decodedAddress = 0x0000;
+
+    // Predecodes the instructions from the address into the block cache
+    void decodeBlock(uint16_t addr);
+    // True if the opcode changes the flow of control, which ends a block
+    bool endsBlock(uint8_t opcode);
+    // Reads the operand byte at the program counter
+    uint8_t readOperand();
+
+    // Adds the extra cycle given by the cycle policy of the current opcode
+    // for indexed addressing. Returns true if a cycle was added
+    bool addPolicyCycles(bool pageCrossed);
 
     // Internal use methods, uses the currently loaded opcode
   private:
@@ -116,6 +390,66 @@ namespace CPU
     std::string getInstructionName();
     std::string getAddressModeName();
     std::string getOperation();
+    Mnemonic    getMnemonic();
+    AddressMode getAddressMode();
+
+    // Dispatch engines, see run()
+  private:
+    typedef uint32_t(*TailCallType)(BasicExecutioner*, uint32_t);
+
+    // Number of instructions a tail call chain may run before returning to
+    // the run loop. Without a guaranteed tail call every link in the chain
+    // uses stack, so the chain is kept short.
+#if TAILCALL_GUARANTEED
+    static constexpr uint32_t TAILCALL_CHAIN = UINT32_MAX;
+#else
+    static constexpr uint32_t TAILCALL_CHAIN = 64;
+#endif
+    template <VARIANT V>
+    static const std::array<TailCallType, 256> tailcalls;
+
+    // Runs the selected dispatch engine, between loading and syncing the
+    // lazy flags
+    uint32_t runEngine(uint32_t instructions);
+    // The engines of the variant
+    template <VARIANT V>
+    uint32_t runVariant(uint32_t instructions);
+    uint32_t runTable(uint32_t instructions);
+    template <VARIANT V>
+    uint32_t runSwitch(uint32_t instructions);
+    template <VARIANT V, bool SUPER>
+    uint32_t runThreaded(uint32_t instructions);
+    template <VARIANT V>
+    uint32_t runTailCall(uint32_t instructions);
+    template <VARIANT V>
+    uint32_t runJit(uint32_t instructions);
+
+    // Executes the operation of a single opcode, resolved at compile time
+    template <VARIANT V, uint8_t OP>
+    void operation();
+    // How the engine continues after a superinstruction
+    enum CONTINUATION : uint8_t
+    {
+      // The last opcode run has to be finished
+      FINISH,
+      // The next instruction has been started, but isn't fused
+      DISPATCH_NEXT,
+      // Stopped between two instructions
+      STOP,
+    };
+    // Runs the opcode, followed by the opcodes fused to it while they follow
+    template <VARIANT V, uint8_t OP>
+    CONTINUATION superinstruction(uint32_t& executed, uint32_t instructions);
+    template <VARIANT V, uint8_t OP>
+    static uint32_t tailcall(BasicExecutioner* executioner, uint32_t remaining);
+    template <VARIANT V, size_t... OP>
+    static constexpr std::array<TailCallType, 256> makeTailCalls(std::index_sequence<OP...>);
+
+    // Translated blocks of the JIT engine
+    Jit jit;
+    // Translates the block starting at the address into x86-64 code
+    template <VARIANT V>
+    void translate(uint16_t addr);
 
     // External use methods, uses opcode via arguments
   public:
@@ -126,8 +460,27 @@ namespace CPU
     std::string getAddressModeName(uint8_t opcode);
     // Helper method, returns instruction mnemonics (INST:ADDR [opcode])
     std::string getOperation(uint8_t opcode);
+    // Helper method, returns decoded instruction
+    Mnemonic    getMnemonic(uint8_t opcode);
+    // Helper method, returns decoded address mode
+    AddressMode getAddressMode(uint8_t opcode);
+    // Helper method, returns number of operand bytes following the opcode
+    uint8_t     getOperandLength(uint8_t opcode);
+    // Helper method, returns the CYCLEPOLICY bits of the opcode
+    uint8_t     getCyclePolicy(uint8_t opcode);
+    // Helper method, returns the cycles an instruction of the opcode took,
+    // given the extra cycles added while it ran
+    uint8_t     getInstructionCycles(uint8_t opcode, uint8_t extra);
 
 
+  public:
+    // Fused Opcodes ================================================
+    // Every opcode is an instantiation of this template, running the
+    // addressing mode and then the operation. Returns 1 if both allow
+    // the extra cycle for crossing a page boundary.
+    template <ExecutionType Mode, ExecutionType Operation>
+    uint8_t Op();
+
   public:
     // Addressing Modes =============================================
     // The 6502 has a variety of addressing modes to access data in 
@@ -155,9 +508,13 @@ namespace CPU
     uint8_t ABS();
     uint8_t ABX();
     uint8_t ABY();
+    template <VARIANT V>
     uint8_t IND();
     uint8_t IZX();
     uint8_t IZY();
+    // 65C02 only
+    uint8_t IZP();
+    uint8_t IAX();
 
     // Opcodes ======================================================
     // There are 56 "legitimate" opcodes provided by the 6502 CPU. I
@@ -180,7 +537,11 @@ namespace CPU
     // I have included detailed explanations of each function in 
     // the class implementation file. Note they are listed in
     // alphabetical order here for ease of finding.
+    //
+    // The few opcodes that behave differently on the variants are
+    // templates, instantiated for every variant.
 
+    template <VARIANT V>
     uint8_t ADC();
     uint8_t AND();
     uint8_t ASL();
@@ -224,6 +585,7 @@ namespace CPU
     uint8_t ROR();
     uint8_t RTI();
     uint8_t RTS();
+    template <VARIANT V>
     uint8_t SBC();
     uint8_t SEC();
     uint8_t SED();
@@ -246,11 +608,13 @@ namespace CPU
     uint8_t ANE();
     uint8_t ARR();
     uint8_t DCP();
+    template <VARIANT V>
     uint8_t ISC();
     uint8_t LAS();
     uint8_t LAX();
     uint8_t LXA();
     uint8_t RLA();
+    template <VARIANT V>
     uint8_t RRA();
     uint8_t SAX();
     uint8_t SBX();
@@ -260,12 +624,30 @@ namespace CPU
     uint8_t SLO();
     uint8_t SRE();
     uint8_t TAS();
+    template <VARIANT V>
     uint8_t USBC();
     uint8_t DOP();
     uint8_t TOP();
     uint8_t JAM();
 #endif
 
+    // 65C02 opcodes
+    uint8_t BRA();
+    uint8_t PHX();
+    uint8_t PHY();
+    uint8_t PLX();
+    uint8_t PLY();
+    uint8_t STP();
+    uint8_t STZ();
+    uint8_t TRB();
+    uint8_t TSB();
+    uint8_t WAI();
+    // The opcodes the 65C02 leaves undefined do nothing, most of them take
+    // the cycles of NOP with their addressing mode. These take 1 cycle, and
+    // the 8 cycles of opcode 0x5C
+    uint8_t NOP1();
+    uint8_t NOP8();
+
 #ifndef ILLEGAL
     // I capture all "unofficial" opcodes with this function. It is
     // functionally identical to a NOP
@@ -280,4 +662,7 @@ namespace CPU
     uint8_t  magic = 0xFF;
 #endif
   };
+
+  // The executioner of the Bus
+  typedef BasicExecutioner<Bus> Executioner;
 }
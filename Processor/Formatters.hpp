@@ -17,12 +17,18 @@ using Proc = CPU::Processor;
 using Exec = CPU::Executioner;
 
 
+namespace CPU
+{
+  // The types nested in the processor & executioner templates, which are
+  // different for every bus
+  template <typename T>
+  concept Streamed = T::streamed::value;
+}
+
 template <> struct fmt::formatter<CPU::Bus::MEMORYMAP> : ostream_formatter {};
 
-template <> struct fmt::formatter<Exec::tMode> : ostream_formatter {};
-template <> struct fmt::formatter<Exec::OperationType> : ostream_formatter {};
+template <CPU::Streamed T> struct fmt::formatter<T> : ostream_formatter {};
 
-template <> struct fmt::formatter<Proc::DISASSEMBLY> : ostream_formatter {};
 //template <> struct fmt::formatter<Proc::FLAGS6502> : ostream_formatter {};
 template <> struct fmt::formatter<Proc::REGISTER> : ostream_formatter {};
 
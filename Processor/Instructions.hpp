@@ -2,449 +2,745 @@
 
 #include "Executioner.hpp"
 
+#include <array>
+#include <utility>
+#include <stdexcept>
+
 namespace CPU
 {
-  class Executioner;
-
+  // The opcode translation table. Every one of the 256 possible opcodes has
+  // a slot, indexed by the opcode itself, so decoding an instruction is a
+  // single indexed load. The table is built at compile time and shared
+  // (read-only) by every Executioner instance.
+  //
+  // This is the table of the NMOS 6502, V picks the instantiation of the
+  // opcodes that behave differently on the variants sharing it. The tables
+  // point into the BasicExecutioner of the bus, so there is one per bus type.
 #pragma region Instructions
-  static const std::map<uint8_t, Executioner::OperationType> lookup = {
+  template <typename BusT, ExecutionerBase::VARIANT V>
+  inline constexpr std::array<typename BasicExecutioner<BusT>::OperationType, 256> lookupNMOS = {{
 #pragma region Instructions 0x0
-    {0x00, { {&Executioner::BRK, "BRK"}, {&Executioner::IMM, "IMM"}, 7 }},
-    {0x01, { {&Executioner::ORA, "ORA"}, {&Executioner::IZX, "IZX"}, 6 }},
+    { {&BasicExecutioner<BusT>::BRK, "BRK"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 7 }, // 0x00
+    { {&BasicExecutioner<BusT>::ORA, "ORA"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 6 }, // 0x01
 #ifdef ILLEGAL
-    {0x02, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x03, { {&Executioner::SLO, "SLO"}, {&Executioner::IZX, "IZX"}, 8 }},
-    {0x04, { {&Executioner::DOP, "DOP"}, {&Executioner::ZP0, "ZP0"}, 3 }},
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x02
+    { {&BasicExecutioner<BusT>::SLO, "SLO"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 8 }, // 0x03
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x04
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x02
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x03
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x04
 #endif
-    {0x05, { {&Executioner::ORA, "ORA"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0x06, { {&Executioner::ASL, "ASL"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::ORA, "ORA"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x05
+    { {&BasicExecutioner<BusT>::ASL, "ASL"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0x06
 #ifdef ILLEGAL
-    {0x07, { {&Executioner::SLO, "SLO"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::SLO, "SLO"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0x07
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x07
 #endif
-    {0x08, { {&Executioner::PHP, "PHP"}, {&Executioner::IMP, "IMP"}, 3 }},
-    {0x09, { {&Executioner::ORA, "ORA"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x0A, { {&Executioner::ASL, "ASL"}, {&Executioner::ACC, "ACC"}, 2 }},
+    { {&BasicExecutioner<BusT>::PHP, "PHP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 3 }, // 0x08
+    { {&BasicExecutioner<BusT>::ORA, "ORA"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x09
+    { {&BasicExecutioner<BusT>::ASL, "ASL"}, {&BasicExecutioner<BusT>::ACC, "ACC"}, 2 }, // 0x0A
 #ifdef ILLEGAL
-    {0x0B, { {&Executioner::ANC, "ANC"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x0C, { {&Executioner::TOP, "TOP"}, {&Executioner::ABS, "ABS"}, 4 }},
+    { {&BasicExecutioner<BusT>::ANC, "ANC"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x0B
+    { {&BasicExecutioner<BusT>::TOP, "TOP"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0x0C
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x0B
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x0C
 #endif
-    {0x0D, { {&Executioner::ORA, "ORA"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0x0E, { {&Executioner::ASL, "ASL"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::ORA, "ORA"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0x0D
+    { {&BasicExecutioner<BusT>::ASL, "ASL"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0x0E
 #ifdef ILLEGAL
-    {0x0F, { {&Executioner::SLO, "SLO"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::SLO, "SLO"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0x0F
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x0F
 #endif
 #pragma endregion Instructions 0x0
-
 #pragma region Instructions 0x1
-    {0x10, { {&Executioner::BPL, "BPL"}, {&Executioner::REL, "REL"}, 2 }},
-    {0x11, { {&Executioner::ORA, "ORA"}, {&Executioner::IZY, "IZY"}, 5 }},
-#ifdef ILLEGAL
-    {0x12, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x13, { {&Executioner::SLO, "SLO"}, {&Executioner::IZY, "IZY"}, 8 }},
-    {0x14, { {&Executioner::DOP, "DOP"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-#endif
-    {0x15, { {&Executioner::ORA, "ORA"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-    {0x16, { {&Executioner::ASL, "ASL"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#ifdef ILLEGAL
-    {0x17, { {&Executioner::SLO, "SLO"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#endif
-    {0x18, { {&Executioner::CLC, "CLC"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0x19, { {&Executioner::ORA, "ORA"}, {&Executioner::ABY, "ABY"}, 4 }},
-#ifdef ILLEGAL
-    {0x1A, { {&Executioner::NOP, "NOP"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0x1B, { {&Executioner::SLO, "SLO"}, {&Executioner::ABY, "ABY"}, 7 }},
-    {0x1C, { {&Executioner::TOP, "TOP"}, {&Executioner::ABX, "ABX"}, 4 }},
-#endif
-    {0x1D, { {&Executioner::ORA, "ORA"}, {&Executioner::ABX, "ABX"}, 4 }},
-    {0x1E, { {&Executioner::ASL, "ASL"}, {&Executioner::ABX, "ABX"}, 7 }},
-#ifdef ILLEGAL
-    {0x1F, { {&Executioner::SLO, "SLO"}, {&Executioner::ABX, "ABX"}, 7 }},
+    { {&BasicExecutioner<BusT>::BPL, "BPL"}, {&BasicExecutioner<BusT>::REL, "REL"}, 2 }, // 0x10
+    { {&BasicExecutioner<BusT>::ORA, "ORA"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 5 }, // 0x11
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x12
+    { {&BasicExecutioner<BusT>::SLO, "SLO"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 8 }, // 0x13
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0x14
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x12
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x13
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x14
+#endif
+    { {&BasicExecutioner<BusT>::ORA, "ORA"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0x15
+    { {&BasicExecutioner<BusT>::ASL, "ASL"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0x16
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::SLO, "SLO"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0x17
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x17
+#endif
+    { {&BasicExecutioner<BusT>::CLC, "CLC"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x18
+    { {&BasicExecutioner<BusT>::ORA, "ORA"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 4 }, // 0x19
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x1A
+    { {&BasicExecutioner<BusT>::SLO, "SLO"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 7 }, // 0x1B
+    { {&BasicExecutioner<BusT>::TOP, "TOP"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0x1C
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x1A
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x1B
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x1C
+#endif
+    { {&BasicExecutioner<BusT>::ORA, "ORA"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0x1D
+    { {&BasicExecutioner<BusT>::ASL, "ASL"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0x1E
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::SLO, "SLO"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0x1F
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x1F
 #endif
 #pragma endregion Instructions 0x1
-
 #pragma region Instructions 0x2
-    {0x20, { {&Executioner::JSR, "JSR"}, {&Executioner::ABS, "ABS"}, 6 }},
-    {0x21, { {&Executioner::AND, "AND"}, {&Executioner::IZX, "IZX"}, 6 }},
+    { {&BasicExecutioner<BusT>::JSR, "JSR"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0x20
+    { {&BasicExecutioner<BusT>::AND, "AND"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 6 }, // 0x21
 #ifdef ILLEGAL
-    {0x22, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x23, { {&Executioner::RRA, "RRA"}, {&Executioner::IZX, "IZX"}, 8 }},
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x22
+    { {&BasicExecutioner<BusT>::template RRA<V>, "RRA"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 8 }, // 0x23
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x22
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x23
 #endif
-    {0x24, { {&Executioner::BIT, "BIT"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0x25, { {&Executioner::AND, "AND"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0x26, { {&Executioner::ROL, "ROL"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::BIT, "BIT"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x24
+    { {&BasicExecutioner<BusT>::AND, "AND"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x25
+    { {&BasicExecutioner<BusT>::ROL, "ROL"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0x26
 #ifdef ILLEGAL
-    {0x27, { {&Executioner::RRA, "RRA"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::template RRA<V>, "RRA"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0x27
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x27
 #endif
-    {0x28, { {&Executioner::PLP, "PLP"}, {&Executioner::IMP, "IMP"}, 4 }},
-    {0x29, { {&Executioner::AND, "AND"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x2A, { {&Executioner::ROL, "ROL"}, {&Executioner::ACC, "ACC"}, 2 }},
+    { {&BasicExecutioner<BusT>::PLP, "PLP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 4 }, // 0x28
+    { {&BasicExecutioner<BusT>::AND, "AND"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x29
+    { {&BasicExecutioner<BusT>::ROL, "ROL"}, {&BasicExecutioner<BusT>::ACC, "ACC"}, 2 }, // 0x2A
 #ifdef ILLEGAL
-    {0x2B, { {&Executioner::ANC2, "ANC2"}, {&Executioner::IMM, "IMM"}, 2 }},
+    { {&BasicExecutioner<BusT>::ANC2, "ANC2"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x2B
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x2B
 #endif
-    {0x2C, { {&Executioner::BIT, "BIT"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0x2D, { {&Executioner::AND, "AND"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0x2E, { {&Executioner::ROL, "ROL"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::BIT, "BIT"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0x2C
+    { {&BasicExecutioner<BusT>::AND, "AND"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0x2D
+    { {&BasicExecutioner<BusT>::ROL, "ROL"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0x2E
 #ifdef ILLEGAL
-    {0x2F, { {&Executioner::RRA, "RRA"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::template RRA<V>, "RRA"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0x2F
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x2F
 #endif
 #pragma endregion Instructions 0x2
-
 #pragma region Instructions 0x3
-    {0x30, { {&Executioner::BMI, "BMI"}, {&Executioner::REL, "REL"}, 2 }},
-    {0x31, { {&Executioner::AND, "AND"}, {&Executioner::IZY, "IZY"}, 5 }},
-#ifdef ILLEGAL
-    {0x32, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x33, { {&Executioner::RRA, "RRA"}, {&Executioner::IZY, "IZY"}, 8 }},
-    {0x34, { {&Executioner::DOP, "DOP"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-#endif
-    {0x35, { {&Executioner::AND, "AND"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-    {0x36, { {&Executioner::ROL, "ROL"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#ifdef ILLEGAL
-    {0x37, { {&Executioner::RRA, "RRA"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#endif
-    {0x38, { {&Executioner::SEC, "SEC"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0x39, { {&Executioner::AND, "AND"}, {&Executioner::ABY, "ABY"}, 4 }},
-#ifdef ILLEGAL
-    {0x3A, { {&Executioner::NOP, "NOP"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0x3B, { {&Executioner::RRA, "RRA"}, {&Executioner::ABY, "ABY"}, 7 }},
-    {0x3C, { {&Executioner::TOP, "TOP"}, {&Executioner::ABX, "ABX"}, 4 }},
-#endif
-    {0x3D, { {&Executioner::AND, "AND"}, {&Executioner::ABX, "ABX"}, 4 }},
-    {0x3E, { {&Executioner::ROL, "ROL"}, {&Executioner::ABX, "ABX"}, 7 }},
-#ifdef ILLEGAL
-    {0x3F, { {&Executioner::RRA, "RRA"}, {&Executioner::ABX, "ABX"}, 7 }},
+    { {&BasicExecutioner<BusT>::BMI, "BMI"}, {&BasicExecutioner<BusT>::REL, "REL"}, 2 }, // 0x30
+    { {&BasicExecutioner<BusT>::AND, "AND"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 5 }, // 0x31
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x32
+    { {&BasicExecutioner<BusT>::template RRA<V>, "RRA"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 8 }, // 0x33
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0x34
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x32
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x33
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x34
+#endif
+    { {&BasicExecutioner<BusT>::AND, "AND"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0x35
+    { {&BasicExecutioner<BusT>::ROL, "ROL"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0x36
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::template RRA<V>, "RRA"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0x37
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x37
+#endif
+    { {&BasicExecutioner<BusT>::SEC, "SEC"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x38
+    { {&BasicExecutioner<BusT>::AND, "AND"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 4 }, // 0x39
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x3A
+    { {&BasicExecutioner<BusT>::template RRA<V>, "RRA"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 7 }, // 0x3B
+    { {&BasicExecutioner<BusT>::TOP, "TOP"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0x3C
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x3A
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x3B
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x3C
+#endif
+    { {&BasicExecutioner<BusT>::AND, "AND"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0x3D
+    { {&BasicExecutioner<BusT>::ROL, "ROL"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0x3E
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::template RRA<V>, "RRA"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0x3F
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x3F
 #endif
 #pragma endregion Instructions 0x3
-
 #pragma region Instructions 0x4
-    {0x40, { {&Executioner::RTI, "RTI"}, {&Executioner::IMP, "IMP"}, 6 }},
-    {0x41, { {&Executioner::EOR, "EOR"}, {&Executioner::IZX, "IZX"}, 6 }},
+    { {&BasicExecutioner<BusT>::RTI, "RTI"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 6 }, // 0x40
+    { {&BasicExecutioner<BusT>::EOR, "EOR"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 6 }, // 0x41
 #ifdef ILLEGAL
-    {0x42, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x43, { {&Executioner::SRE, "SRE"}, {&Executioner::IZX, "IZX"}, 8 }},
-    {0x44, { {&Executioner::DOP, "DOP"}, {&Executioner::ZP0, "ZP0"}, 3 }},
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x42
+    { {&BasicExecutioner<BusT>::SRE, "SRE"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 8 }, // 0x43
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x44
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x42
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x43
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x44
 #endif
-    {0x45, { {&Executioner::EOR, "EOR"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0x46, { {&Executioner::LSR, "LSR"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::EOR, "EOR"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x45
+    { {&BasicExecutioner<BusT>::LSR, "LSR"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0x46
 #ifdef ILLEGAL
-    {0x47, { {&Executioner::SRE, "SRE"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::SRE, "SRE"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0x47
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x47
 #endif
-    {0x48, { {&Executioner::PHA, "PHA"}, {&Executioner::IMP, "IMP"}, 3 }},
-    {0x49, { {&Executioner::EOR, "EOR"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x4A, { {&Executioner::LSR, "LSR"}, {&Executioner::ACC, "ACC"}, 2 }},
+    { {&BasicExecutioner<BusT>::PHA, "PHA"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 3 }, // 0x48
+    { {&BasicExecutioner<BusT>::EOR, "EOR"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x49
+    { {&BasicExecutioner<BusT>::LSR, "LSR"}, {&BasicExecutioner<BusT>::ACC, "ACC"}, 2 }, // 0x4A
 #ifdef ILLEGAL
-    {0x4B, { {&Executioner::ALR, "ALR"}, {&Executioner::IMM, "IMM"}, 2 }},
+    { {&BasicExecutioner<BusT>::ALR, "ALR"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x4B
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x4B
 #endif
-    {0x4C, { {&Executioner::JMP, "JMP"}, {&Executioner::ABS, "ABS"}, 3 }},
-    {0x4D, { {&Executioner::EOR, "EOR"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0x4E, { {&Executioner::LSR, "LSR"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::JMP, "JMP"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 3 }, // 0x4C
+    { {&BasicExecutioner<BusT>::EOR, "EOR"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0x4D
+    { {&BasicExecutioner<BusT>::LSR, "LSR"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0x4E
 #ifdef ILLEGAL
-    {0x4F, { {&Executioner::SRE, "SRE"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::SRE, "SRE"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0x4F
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x4F
 #endif
 #pragma endregion Instructions 0x4
-
 #pragma region Instructions 0x5
-    {0x50, { {&Executioner::BVC, "BVC"}, {&Executioner::REL, "REL"}, 2 }},
-    {0x51, { {&Executioner::EOR, "EOR"}, {&Executioner::IZY, "IZY"}, 5 }},
-#ifdef ILLEGAL
-    {0x52, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x53, { {&Executioner::SRE, "SRE"}, {&Executioner::IZY, "IZY"}, 8 }},
-    {0x54, { {&Executioner::DOP, "DOP"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-#endif
-    {0x55, { {&Executioner::EOR, "EOR"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-    {0x56, { {&Executioner::LSR, "LSR"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#ifdef ILLEGAL
-    {0x57, { {&Executioner::SRE, "SRE"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#endif
-    {0x58, { {&Executioner::CLI, "CLI"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0x59, { {&Executioner::EOR, "EOR"}, {&Executioner::ABY, "ABY"}, 4 }},
-#ifdef ILLEGAL
-    {0x5A, { {&Executioner::NOP, "NOP"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0x5B, { {&Executioner::SRE, "SRE"}, {&Executioner::ABY, "ABY"}, 7 }},
-    {0x5C, { {&Executioner::TOP, "TOP"}, {&Executioner::ABX, "ABX"}, 4 }},
-#endif
-    {0x5D, { {&Executioner::EOR, "EOR"}, {&Executioner::ABX, "ABX"}, 4 }},
-    {0x5E, { {&Executioner::LSR, "LSR"}, {&Executioner::ABX, "ABX"}, 7 }},
-#ifdef ILLEGAL
-    {0x5F, { {&Executioner::SRE, "SRE"}, {&Executioner::ABX, "ABX"}, 7 }},
+    { {&BasicExecutioner<BusT>::BVC, "BVC"}, {&BasicExecutioner<BusT>::REL, "REL"}, 2 }, // 0x50
+    { {&BasicExecutioner<BusT>::EOR, "EOR"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 5 }, // 0x51
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x52
+    { {&BasicExecutioner<BusT>::SRE, "SRE"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 8 }, // 0x53
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0x54
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x52
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x53
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x54
+#endif
+    { {&BasicExecutioner<BusT>::EOR, "EOR"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0x55
+    { {&BasicExecutioner<BusT>::LSR, "LSR"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0x56
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::SRE, "SRE"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0x57
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x57
+#endif
+    { {&BasicExecutioner<BusT>::CLI, "CLI"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x58
+    { {&BasicExecutioner<BusT>::EOR, "EOR"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 4 }, // 0x59
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x5A
+    { {&BasicExecutioner<BusT>::SRE, "SRE"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 7 }, // 0x5B
+    { {&BasicExecutioner<BusT>::TOP, "TOP"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0x5C
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x5A
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x5B
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x5C
+#endif
+    { {&BasicExecutioner<BusT>::EOR, "EOR"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0x5D
+    { {&BasicExecutioner<BusT>::LSR, "LSR"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0x5E
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::SRE, "SRE"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0x5F
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x5F
 #endif
 #pragma endregion Instructions 0x5
-
 #pragma region Instructions 0x6
-    {0x60, { {&Executioner::RTS, "RTS"}, {&Executioner::IMP, "IMP"}, 6 }},
-    {0x61, { {&Executioner::ADC, "ADC"}, {&Executioner::IZX, "IZX"}, 6 }},
+    { {&BasicExecutioner<BusT>::RTS, "RTS"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 6 }, // 0x60
+    { {&BasicExecutioner<BusT>::template ADC<V>, "ADC"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 6 }, // 0x61
 #ifdef ILLEGAL
-    {0x62, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x63, { {&Executioner::RLA, "RLA"}, {&Executioner::IZX, "IZX"}, 8 }},
-    {0x64, { {&Executioner::DOP, "DOP"}, {&Executioner::ZP0, "ZP0"}, 3 }},
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x62
+    { {&BasicExecutioner<BusT>::RLA, "RLA"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 8 }, // 0x63
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x64
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x62
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x63
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x64
 #endif
-    {0x65, { {&Executioner::ADC, "ADC"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0x66, { {&Executioner::ROR, "ROR"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::template ADC<V>, "ADC"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x65
+    { {&BasicExecutioner<BusT>::ROR, "ROR"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0x66
 #ifdef ILLEGAL
-    {0x67, { {&Executioner::RLA, "RLA"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::RLA, "RLA"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0x67
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x67
 #endif
-    {0x68, { {&Executioner::PLA, "PLA"}, {&Executioner::IMP, "IMP"}, 4 }},
-    {0x69, { {&Executioner::ADC, "ADC"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x6A, { {&Executioner::ROR, "ROR"}, {&Executioner::ACC, "ACC"}, 2 }},
+    { {&BasicExecutioner<BusT>::PLA, "PLA"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 4 }, // 0x68
+    { {&BasicExecutioner<BusT>::template ADC<V>, "ADC"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x69
+    { {&BasicExecutioner<BusT>::ROR, "ROR"}, {&BasicExecutioner<BusT>::ACC, "ACC"}, 2 }, // 0x6A
 #ifdef ILLEGAL
-    {0x6B, { {&Executioner::ARR, "ARR"}, {&Executioner::IMM, "IMM"}, 2 }},
+    { {&BasicExecutioner<BusT>::ARR, "ARR"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x6B
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x6B
 #endif
-    {0x6C, { {&Executioner::JMP, "JMP"}, {&Executioner::IND, "IND"}, 5 }},
-    {0x6D, { {&Executioner::ADC, "ADC"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0x6E, { {&Executioner::ROR, "ROR"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::JMP, "JMP"}, {&BasicExecutioner<BusT>::template IND<V>, "IND"}, 5 }, // 0x6C
+    { {&BasicExecutioner<BusT>::template ADC<V>, "ADC"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0x6D
+    { {&BasicExecutioner<BusT>::ROR, "ROR"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0x6E
 #ifdef ILLEGAL
-    {0x6F, { {&Executioner::RLA, "RLA"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::RLA, "RLA"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0x6F
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x6F
 #endif
 #pragma endregion Instructions 0x6
-
 #pragma region Instructions 0x7
-    {0x70, { {&Executioner::BVS, "BVS"}, {&Executioner::REL, "REL"}, 2 }},
-    {0x71, { {&Executioner::ADC, "ADC"}, {&Executioner::IZY, "IZY"}, 5 }},
-#ifdef ILLEGAL
-    {0x72, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x73, { {&Executioner::RLA, "RLA"}, {&Executioner::IZY, "IZY"}, 8 }},
-    {0x74, { {&Executioner::DOP, "DOP"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-#endif
-    {0x75, { {&Executioner::ADC, "ADC"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-    {0x76, { {&Executioner::ROR, "ROR"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#ifdef ILLEGAL
-    {0x77, { {&Executioner::RLA, "RLA"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#endif
-    {0x78, { {&Executioner::SEI, "SEI"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0x79, { {&Executioner::ADC, "ADC"}, {&Executioner::ABY, "ABY"}, 4 }},
-#ifdef ILLEGAL
-    {0x7A, { {&Executioner::NOP, "NOP"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0x7B, { {&Executioner::RLA, "RLA"}, {&Executioner::ABY, "ABY"}, 7 }},
-    {0x7C, { {&Executioner::TOP, "TOP"}, {&Executioner::ABX, "ABX"}, 4 }},
-#endif
-    {0x7D, { {&Executioner::ADC, "ADC"}, {&Executioner::ABX, "ABX"}, 4 }},
-    {0x7E, { {&Executioner::ROR, "ROR"}, {&Executioner::ABX, "ABX"}, 7 }},
-#ifdef ILLEGAL
-    {0x7F, { {&Executioner::RLA, "RLA"}, {&Executioner::ABX, "ABX"}, 7 }},
+    { {&BasicExecutioner<BusT>::BVS, "BVS"}, {&BasicExecutioner<BusT>::REL, "REL"}, 2 }, // 0x70
+    { {&BasicExecutioner<BusT>::template ADC<V>, "ADC"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 5 }, // 0x71
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x72
+    { {&BasicExecutioner<BusT>::RLA, "RLA"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 8 }, // 0x73
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0x74
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x72
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x73
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x74
+#endif
+    { {&BasicExecutioner<BusT>::template ADC<V>, "ADC"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0x75
+    { {&BasicExecutioner<BusT>::ROR, "ROR"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0x76
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::RLA, "RLA"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0x77
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x77
+#endif
+    { {&BasicExecutioner<BusT>::SEI, "SEI"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x78
+    { {&BasicExecutioner<BusT>::template ADC<V>, "ADC"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 4 }, // 0x79
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x7A
+    { {&BasicExecutioner<BusT>::RLA, "RLA"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 7 }, // 0x7B
+    { {&BasicExecutioner<BusT>::TOP, "TOP"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0x7C
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x7A
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x7B
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x7C
+#endif
+    { {&BasicExecutioner<BusT>::template ADC<V>, "ADC"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0x7D
+    { {&BasicExecutioner<BusT>::ROR, "ROR"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0x7E
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::RLA, "RLA"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0x7F
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x7F
 #endif
 #pragma endregion Instructions 0x7
-
 #pragma region Instructions 0x8
 #ifdef ILLEGAL
-    {0x80, { {&Executioner::DOP, "DOP"}, {&Executioner::IMM, "IMM"}, 2 }},
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x80
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x80
 #endif
-    {0x81, { {&Executioner::STA, "STA"}, {&Executioner::IZX, "IZX"}, 6 }},
+    { {&BasicExecutioner<BusT>::STA, "STA"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 6 }, // 0x81
 #ifdef ILLEGAL
-    {0x82, { {&Executioner::DOP, "DOP"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x83, { {&Executioner::SAX, "SAX"}, {&Executioner::IZX, "IZX"}, 6 }},
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x82
+    { {&BasicExecutioner<BusT>::SAX, "SAX"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 6 }, // 0x83
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x82
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x83
 #endif
-    {0x84, { {&Executioner::STY, "STY"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0x85, { {&Executioner::STA, "STA"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0x86, { {&Executioner::STX, "STX"}, {&Executioner::ZP0, "ZP0"}, 3 }},
+    { {&BasicExecutioner<BusT>::STY, "STY"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x84
+    { {&BasicExecutioner<BusT>::STA, "STA"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x85
+    { {&BasicExecutioner<BusT>::STX, "STX"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x86
 #ifdef ILLEGAL
-    {0x87, { {&Executioner::SAX, "SAX"}, {&Executioner::ZP0, "ZP0"}, 3 }},
+    { {&BasicExecutioner<BusT>::SAX, "SAX"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0x87
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x87
 #endif
-    {0x88, { {&Executioner::DEY, "DEY"}, {&Executioner::IMP, "IMP"}, 2 }},
+    { {&BasicExecutioner<BusT>::DEY, "DEY"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x88
 #ifdef ILLEGAL
-
-    {0x89, { {&Executioner::DOP, "DOP"}, {&Executioner::IMM, "IMM"}, 2 }},
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x89
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x89
 #endif
-    {0x8A, { {&Executioner::TXA, "TXA"}, {&Executioner::IMP, "IMP"}, 2 }},
+    { {&BasicExecutioner<BusT>::TXA, "TXA"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x8A
 #ifdef ILLEGAL
-    {0x8B, { {&Executioner::ANE, "ANE"}, {&Executioner::IMM, "IMM"}, 2 }},
+    { {&BasicExecutioner<BusT>::ANE, "ANE"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x8B
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x8B
 #endif
-    {0x8C, { {&Executioner::STY, "STY"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0x8D, { {&Executioner::STA, "STA"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0x8E, { {&Executioner::STX, "STX"}, {&Executioner::ABS, "ABS"}, 4 }},
+    { {&BasicExecutioner<BusT>::STY, "STY"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0x8C
+    { {&BasicExecutioner<BusT>::STA, "STA"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0x8D
+    { {&BasicExecutioner<BusT>::STX, "STX"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0x8E
 #ifdef ILLEGAL
-    {0x8F, { {&Executioner::SAX, "SAX"}, {&Executioner::ABS, "ABS"}, 4 }},
+    { {&BasicExecutioner<BusT>::SAX, "SAX"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0x8F
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x8F
 #endif
 #pragma endregion Instructions 0x8
-
 #pragma region Instructions 0x9
-    {0x90, { {&Executioner::BCC, "BCC"}, {&Executioner::REL, "REL"}, 2 }},
-    {0x91, { {&Executioner::STA, "STA"}, {&Executioner::IZY, "IZY"}, 6 }},
+    { {&BasicExecutioner<BusT>::BCC, "BCC"}, {&BasicExecutioner<BusT>::REL, "REL"}, 2 }, // 0x90
+    { {&BasicExecutioner<BusT>::STA, "STA"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 6 }, // 0x91
 #ifdef ILLEGAL
-    {0x92, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0x93, { {&Executioner::SHA, "SHA"}, {&Executioner::IZY, "IZY"}, 6 }},
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0x92
+    { {&BasicExecutioner<BusT>::SHA, "SHA"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 6 }, // 0x93
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x92
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x93
 #endif
-    {0x94, { {&Executioner::STY, "STY"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-    {0x95, { {&Executioner::STA, "STA"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-    {0x96, { {&Executioner::STX, "STX"}, {&Executioner::ZPY, "ZPY"}, 4 }},
+    { {&BasicExecutioner<BusT>::STY, "STY"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0x94
+    { {&BasicExecutioner<BusT>::STA, "STA"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0x95
+    { {&BasicExecutioner<BusT>::STX, "STX"}, {&BasicExecutioner<BusT>::ZPY, "ZPY"}, 4 }, // 0x96
 #ifdef ILLEGAL
-    {0x97, { {&Executioner::SAX, "SAX"}, {&Executioner::ZPY, "ZPY"}, 4 }},
+    { {&BasicExecutioner<BusT>::SAX, "SAX"}, {&BasicExecutioner<BusT>::ZPY, "ZPY"}, 4 }, // 0x97
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x97
 #endif
-    {0x98, { {&Executioner::TYA, "TYA"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0x99, { {&Executioner::STA, "STA"}, {&Executioner::ABY, "ABY"}, 5 }},
-    {0x9A, { {&Executioner::TXS, "TXS"}, {&Executioner::IMP, "IMP"}, 2 }},
+    { {&BasicExecutioner<BusT>::TYA, "TYA"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x98
+    { {&BasicExecutioner<BusT>::STA, "STA"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 5 }, // 0x99
+    { {&BasicExecutioner<BusT>::TXS, "TXS"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x9A
 #ifdef ILLEGAL
-    {0x9B, { {&Executioner::TAS, "TAS"}, {&Executioner::ABY, "ABY"}, 5 }},
-    {0x9C, { {&Executioner::SHY, "SHY"}, {&Executioner::ABX, "ABX"}, 5 }},
+    { {&BasicExecutioner<BusT>::TAS, "TAS"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 5 }, // 0x9B
+    { {&BasicExecutioner<BusT>::SHY, "SHY"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 5 }, // 0x9C
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x9B
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x9C
 #endif
-    {0x9D, { {&Executioner::STA, "STA"}, {&Executioner::ABX, "ABX"}, 5 }},
+    { {&BasicExecutioner<BusT>::STA, "STA"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 5 }, // 0x9D
 #ifdef ILLEGAL
-    {0x9E, { {&Executioner::SHX, "SHX"}, {&Executioner::ABY, "ABY"}, 5 }},
-    {0x9F, { {&Executioner::SHA, "SHA"}, {&Executioner::ABY, "ABY"}, 5 }},
+    { {&BasicExecutioner<BusT>::SHX, "SHX"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 5 }, // 0x9E
+    { {&BasicExecutioner<BusT>::SHA, "SHA"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 5 }, // 0x9F
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x9E
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0x9F
 #endif
 #pragma endregion Instructions 0x9
-
 #pragma region Instructions 0xA
-    {0xA0, { {&Executioner::LDY, "LDY"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xA1, { {&Executioner::LDA, "LDA"}, {&Executioner::IZX, "IZX"}, 6 }},
-    {0xA2, { {&Executioner::LDX, "LDX"}, {&Executioner::IMM, "IMM"}, 2 }},
+    { {&BasicExecutioner<BusT>::LDY, "LDY"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xA0
+    { {&BasicExecutioner<BusT>::LDA, "LDA"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 6 }, // 0xA1
+    { {&BasicExecutioner<BusT>::LDX, "LDX"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xA2
 #ifdef ILLEGAL
-    {0xA3, { {&Executioner::LAX, "LAX"}, {&Executioner::IZX, "IZX"}, 6 }},
+    { {&BasicExecutioner<BusT>::LAX, "LAX"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 6 }, // 0xA3
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xA3
 #endif
-    {0xA4, { {&Executioner::LDY, "LDY"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0xA5, { {&Executioner::LDA, "LDA"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0xA6, { {&Executioner::LDX, "LDX"}, {&Executioner::ZP0, "ZP0"}, 3 }},
+    { {&BasicExecutioner<BusT>::LDY, "LDY"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0xA4
+    { {&BasicExecutioner<BusT>::LDA, "LDA"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0xA5
+    { {&BasicExecutioner<BusT>::LDX, "LDX"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0xA6
 #ifdef ILLEGAL
-    {0xA7, { {&Executioner::LAX, "LAX"}, {&Executioner::ZP0, "ZP0"}, 3 }},
+    { {&BasicExecutioner<BusT>::LAX, "LAX"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0xA7
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xA7
 #endif
-    {0xA8, { {&Executioner::TAY, "TAY"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0xA9, { {&Executioner::LDA, "LDA"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xAA, { {&Executioner::TAX, "TAX"}, {&Executioner::IMP, "IMP"}, 2 }},
+    { {&BasicExecutioner<BusT>::TAY, "TAY"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xA8
+    { {&BasicExecutioner<BusT>::LDA, "LDA"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xA9
+    { {&BasicExecutioner<BusT>::TAX, "TAX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xAA
 #ifdef ILLEGAL
-    {0xAB, { {&Executioner::LXA, "LXA"}, {&Executioner::IMM, "IMM"}, 2 }},
+    { {&BasicExecutioner<BusT>::LXA, "LXA"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xAB
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xAB
 #endif
-    {0xAC, { {&Executioner::LDY, "LDY"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0xAD, { {&Executioner::LDA, "LDA"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0xAE, { {&Executioner::LDX, "LDX"}, {&Executioner::ABS, "ABS"}, 4 }},
+    { {&BasicExecutioner<BusT>::LDY, "LDY"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0xAC
+    { {&BasicExecutioner<BusT>::LDA, "LDA"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0xAD
+    { {&BasicExecutioner<BusT>::LDX, "LDX"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0xAE
 #ifdef ILLEGAL
-    {0xAF, { {&Executioner::LAX, "LAX"}, {&Executioner::ABS, "ABS"}, 4 }},
+    { {&BasicExecutioner<BusT>::LAX, "LAX"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0xAF
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xAF
 #endif
 #pragma endregion Instructions 0xA
-
 #pragma region Instructions 0xB
-    {0xB0, { {&Executioner::BCS, "BCS"}, {&Executioner::REL, "REL"}, 2 }},
-    {0xB1, { {&Executioner::LDA, "LDA"}, {&Executioner::IZY, "IZY"}, 5 }},
+    { {&BasicExecutioner<BusT>::BCS, "BCS"}, {&BasicExecutioner<BusT>::REL, "REL"}, 2 }, // 0xB0
+    { {&BasicExecutioner<BusT>::LDA, "LDA"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 5 }, // 0xB1
 #ifdef ILLEGAL
-    {0xB2, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xB3, { {&Executioner::LAX, "LAX"}, {&Executioner::IZY, "IZY"}, 5 }},
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xB2
+    { {&BasicExecutioner<BusT>::LAX, "LAX"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 5 }, // 0xB3
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xB2
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xB3
 #endif
-    {0xB4, { {&Executioner::LDY, "LDY"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-    {0xB5, { {&Executioner::LDA, "LDA"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-    {0xB6, { {&Executioner::LDX, "LDX"}, {&Executioner::ZPY, "ZPY"}, 4 }},
+    { {&BasicExecutioner<BusT>::LDY, "LDY"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0xB4
+    { {&BasicExecutioner<BusT>::LDA, "LDA"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0xB5
+    { {&BasicExecutioner<BusT>::LDX, "LDX"}, {&BasicExecutioner<BusT>::ZPY, "ZPY"}, 4 }, // 0xB6
 #ifdef ILLEGAL
-    {0xB7, { {&Executioner::LAX, "LAX"}, {&Executioner::ZPX, "ZPX"}, 4 }},
+    { {&BasicExecutioner<BusT>::LAX, "LAX"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0xB7
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xB7
 #endif
-    {0xB8, { {&Executioner::CLV, "CLV"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0xB9, { {&Executioner::LDA, "LDA"}, {&Executioner::ABY, "ABY"}, 4 }},
-    {0xBA, { {&Executioner::TSX, "TSX"}, {&Executioner::IMP, "IMP"}, 2 }},
+    { {&BasicExecutioner<BusT>::CLV, "CLV"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xB8
+    { {&BasicExecutioner<BusT>::LDA, "LDA"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 4 }, // 0xB9
+    { {&BasicExecutioner<BusT>::TSX, "TSX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xBA
 #ifdef ILLEGAL
-    {0xBB, { {&Executioner::LAS, "LAS"}, {&Executioner::ABY, "ABY"}, 4 }},
+    { {&BasicExecutioner<BusT>::LAS, "LAS"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 4 }, // 0xBB
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xBB
 #endif
-    {0xBC, { {&Executioner::LDY, "LDY"}, {&Executioner::ABX, "ABX"}, 4 }},
-    {0xBD, { {&Executioner::LDA, "LDA"}, {&Executioner::ABX, "ABX"}, 4 }},
-    {0xBE, { {&Executioner::LDX, "LDX"}, {&Executioner::ABY, "ABY"}, 4 }},
+    { {&BasicExecutioner<BusT>::LDY, "LDY"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0xBC
+    { {&BasicExecutioner<BusT>::LDA, "LDA"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0xBD
+    { {&BasicExecutioner<BusT>::LDX, "LDX"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 4 }, // 0xBE
 #ifdef ILLEGAL
-    {0xBF, { {&Executioner::LAX, "LAX"}, {&Executioner::ABY, "ABY"}, 4 }},
+    { {&BasicExecutioner<BusT>::LAX, "LAX"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 4 }, // 0xBF
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xBF
 #endif
 #pragma endregion Instructions 0xB
-
 #pragma region Instructions 0xC
-    {0xC0, { {&Executioner::CPY, "CPY"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xC1, { {&Executioner::CMP, "CMP"}, {&Executioner::IZX, "IZX"}, 6 }},
+    { {&BasicExecutioner<BusT>::CPY, "CPY"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xC0
+    { {&BasicExecutioner<BusT>::CMP, "CMP"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 6 }, // 0xC1
 #ifdef ILLEGAL
-    {0xC2, { {&Executioner::DOP, "DOP"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xC3, { {&Executioner::DCP, "DCP"}, {&Executioner::IZX, "IZX"}, 8 }},
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xC2
+    { {&BasicExecutioner<BusT>::DCP, "DCP"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 8 }, // 0xC3
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xC2
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xC3
 #endif
-    {0xC4, { {&Executioner::CPY, "CPY"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0xC5, { {&Executioner::CMP, "CMP"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0xC6, { {&Executioner::DEC, "DEC"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::CPY, "CPY"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0xC4
+    { {&BasicExecutioner<BusT>::CMP, "CMP"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0xC5
+    { {&BasicExecutioner<BusT>::DEC, "DEC"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0xC6
 #ifdef ILLEGAL
-    {0xC7, { {&Executioner::DCP, "DCP"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::DCP, "DCP"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0xC7
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xC7
 #endif
-    {0xC8, { {&Executioner::INY, "INY"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0xC9, { {&Executioner::CMP, "CMP"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xCA, { {&Executioner::DEX, "DEX"}, {&Executioner::IMP, "IMP"}, 2 }},
+    { {&BasicExecutioner<BusT>::INY, "INY"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xC8
+    { {&BasicExecutioner<BusT>::CMP, "CMP"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xC9
+    { {&BasicExecutioner<BusT>::DEX, "DEX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xCA
 #ifdef ILLEGAL
-    {0xCB, { {&Executioner::SBX, "SBX"}, {&Executioner::IMM, "IMM"}, 2 }},
+    { {&BasicExecutioner<BusT>::SBX, "SBX"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xCB
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xCB
 #endif
-    {0xCC, { {&Executioner::CPY, "CPY"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0xCD, { {&Executioner::CMP, "CMP"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0xCE, { {&Executioner::DEC, "DEC"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::CPY, "CPY"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0xCC
+    { {&BasicExecutioner<BusT>::CMP, "CMP"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0xCD
+    { {&BasicExecutioner<BusT>::DEC, "DEC"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0xCE
 #ifdef ILLEGAL
-    {0xCF, { {&Executioner::DCP, "DCP"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::DCP, "DCP"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0xCF
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xCF
 #endif
 #pragma endregion Instructions 0xC
-
 #pragma region Instructions 0xD
-    {0xD0, { {&Executioner::BNE, "BNE"}, {&Executioner::REL, "REL"}, 2 }},
-    {0xD1, { {&Executioner::CMP, "CMP"}, {&Executioner::IZY, "IZY"}, 5 }},
-#ifdef ILLEGAL
-    {0xD2, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xD3, { {&Executioner::DCP, "DCP"}, {&Executioner::IZY, "IZY"}, 8 }},
-    {0xD4, { {&Executioner::DOP, "DOP"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-#endif
-    {0xD5, { {&Executioner::CMP, "CMP"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-    {0xD6, { {&Executioner::DEC, "DEC"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#ifdef ILLEGAL
-    {0xD7, { {&Executioner::DCP, "DCP"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#endif
-    {0xD8, { {&Executioner::CLD, "CLD"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0xD9, { {&Executioner::CMP, "CMP"}, {&Executioner::ABY, "ABY"}, 4 }},
-#ifdef ILLEGAL
-    {0xDA, { {&Executioner::NOP, "NOP"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0xDB, { {&Executioner::DCP, "DCP"}, {&Executioner::ABY, "ABY"}, 7 }},
-    {0xDC, { {&Executioner::TOP, "TOP"}, {&Executioner::ABX, "ABX"}, 4 }},
-#endif
-    {0xDD, { {&Executioner::CMP, "CMP"}, {&Executioner::ABX, "ABX"}, 4 }},
-    {0xDE, { {&Executioner::DEC, "DEC"}, {&Executioner::ABX, "ABX"}, 7 }},
-#ifdef ILLEGAL
-    {0xDF, { {&Executioner::DCP, "DCP"}, {&Executioner::ABX, "ABX"}, 7 }},
+    { {&BasicExecutioner<BusT>::BNE, "BNE"}, {&BasicExecutioner<BusT>::REL, "REL"}, 2 }, // 0xD0
+    { {&BasicExecutioner<BusT>::CMP, "CMP"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 5 }, // 0xD1
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xD2
+    { {&BasicExecutioner<BusT>::DCP, "DCP"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 8 }, // 0xD3
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0xD4
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xD2
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xD3
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xD4
+#endif
+    { {&BasicExecutioner<BusT>::CMP, "CMP"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0xD5
+    { {&BasicExecutioner<BusT>::DEC, "DEC"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0xD6
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::DCP, "DCP"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0xD7
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xD7
+#endif
+    { {&BasicExecutioner<BusT>::CLD, "CLD"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xD8
+    { {&BasicExecutioner<BusT>::CMP, "CMP"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 4 }, // 0xD9
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xDA
+    { {&BasicExecutioner<BusT>::DCP, "DCP"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 7 }, // 0xDB
+    { {&BasicExecutioner<BusT>::TOP, "TOP"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0xDC
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xDA
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xDB
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xDC
+#endif
+    { {&BasicExecutioner<BusT>::CMP, "CMP"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0xDD
+    { {&BasicExecutioner<BusT>::DEC, "DEC"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0xDE
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::DCP, "DCP"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0xDF
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xDF
 #endif
 #pragma endregion Instructions 0xD
-
 #pragma region Instructions 0xE
-    {0xE0, { {&Executioner::CPX, "CPX"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xE1, { {&Executioner::SBC, "SBC"}, {&Executioner::IZX, "IZX"}, 6 }},
+    { {&BasicExecutioner<BusT>::CPX, "CPX"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xE0
+    { {&BasicExecutioner<BusT>::template SBC<V>, "SBC"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 6 }, // 0xE1
 #ifdef ILLEGAL
-    {0xE2, { {&Executioner::DOP, "DOP"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xE3, { {&Executioner::ISC, "ISC"}, {&Executioner::IZX, "IZX"}, 8 }},
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xE2
+    { {&BasicExecutioner<BusT>::template ISC<V>, "ISC"}, {&BasicExecutioner<BusT>::IZX, "IZX"}, 8 }, // 0xE3
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xE2
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xE3
 #endif
-    {0xE4, { {&Executioner::CPX, "CPX"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0xE5, { {&Executioner::SBC, "SBC"}, {&Executioner::ZP0, "ZP0"}, 3 }},
-    {0xE6, { {&Executioner::INC, "INC"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::CPX, "CPX"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0xE4
+    { {&BasicExecutioner<BusT>::template SBC<V>, "SBC"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 }, // 0xE5
+    { {&BasicExecutioner<BusT>::INC, "INC"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0xE6
 #ifdef ILLEGAL
-    {0xE7, { {&Executioner::ISC, "ISC"}, {&Executioner::ZP0, "ZP0"}, 5 }},
+    { {&BasicExecutioner<BusT>::template ISC<V>, "ISC"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 }, // 0xE7
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xE7
 #endif
-    {0xE8, { {&Executioner::INX, "INX"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0xE9, { {&Executioner::SBC, "SBC"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xEA, { {&Executioner::NOP, "NOP"}, {&Executioner::IMP, "IMP"}, 2 }},
+    { {&BasicExecutioner<BusT>::INX, "INX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xE8
+    { {&BasicExecutioner<BusT>::template SBC<V>, "SBC"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xE9
+    { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xEA
 #ifdef ILLEGAL
-    {0xEB, { {&Executioner::USBC, "USBC"}, {&Executioner::IMM, "IMM"}, 2 }},
+    { {&BasicExecutioner<BusT>::template USBC<V>, "USBC"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xEB
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xEB
 #endif
-    {0xEC, { {&Executioner::CPX, "CPX"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0xED, { {&Executioner::SBC, "SBC"}, {&Executioner::ABS, "ABS"}, 4 }},
-    {0xEE, { {&Executioner::INC, "INC"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::CPX, "CPX"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0xEC
+    { {&BasicExecutioner<BusT>::template SBC<V>, "SBC"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 }, // 0xED
+    { {&BasicExecutioner<BusT>::INC, "INC"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0xEE
 #ifdef ILLEGAL
-    {0xEF, { {&Executioner::ISC, "ISC"}, {&Executioner::ABS, "ABS"}, 6 }},
+    { {&BasicExecutioner<BusT>::template ISC<V>, "ISC"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 }, // 0xEF
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xEF
 #endif
 #pragma endregion Instructions 0xE
-
 #pragma region Instructions 0xF
-    {0xF0, { {&Executioner::BEQ, "BEQ"}, {&Executioner::REL, "REL"}, 2 }},
-    {0xF1, { {&Executioner::SBC, "SBC"}, {&Executioner::IZY, "IZY"}, 5 }},
-#ifdef ILLEGAL
-    {0xF2, { {&Executioner::JAM, "JAM"}, {&Executioner::IMM, "IMM"}, 2 }},
-    {0xF3, { {&Executioner::ISC, "ISC"}, {&Executioner::IZY, "IZY"}, 8 }},
-    {0xF4, { {&Executioner::DOP, "DOP"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-#endif
-    {0xF5, { {&Executioner::SBC, "SBC"}, {&Executioner::ZPX, "ZPX"}, 4 }},
-    {0xF6, { {&Executioner::INC, "INC"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#ifdef ILLEGAL
-    {0xF7, { {&Executioner::ISC, "ISC"}, {&Executioner::ZPX, "ZPX"}, 6 }},
-#endif
-    {0xF8, { {&Executioner::SED, "SED"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0xF9, { {&Executioner::SBC, "SBC"}, {&Executioner::ABY, "ABY"}, 4 }},
-#ifdef ILLEGAL
-    {0xFA, { {&Executioner::NOP, "NOP"}, {&Executioner::IMP, "IMP"}, 2 }},
-    {0xFB, { {&Executioner::ISC, "ISC"}, {&Executioner::ABY, "ABY"}, 7 }},
-    {0xFC, { {&Executioner::TOP, "TOP"}, {&Executioner::ABX, "ABX"}, 4 }},
-#endif
-    {0xFD, { {&Executioner::SBC, "SBC"}, {&Executioner::ABX, "ABX"}, 4 }},
-    {0xFE, { {&Executioner::INC, "INC"}, {&Executioner::ABX, "ABX"}, 7 }},
-#ifdef ILLEGAL
-    {0xFF, { {&Executioner::ISC, "ISC"}, {&Executioner::ABX, "ABX"}, 7 }},
+    { {&BasicExecutioner<BusT>::BEQ, "BEQ"}, {&BasicExecutioner<BusT>::REL, "REL"}, 2 }, // 0xF0
+    { {&BasicExecutioner<BusT>::template SBC<V>, "SBC"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 5 }, // 0xF1
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::JAM, "JAM"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 }, // 0xF2
+    { {&BasicExecutioner<BusT>::template ISC<V>, "ISC"}, {&BasicExecutioner<BusT>::IZY, "IZY"}, 8 }, // 0xF3
+    { {&BasicExecutioner<BusT>::DOP, "DOP"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0xF4
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xF2
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xF3
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xF4
+#endif
+    { {&BasicExecutioner<BusT>::template SBC<V>, "SBC"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 }, // 0xF5
+    { {&BasicExecutioner<BusT>::INC, "INC"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0xF6
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::template ISC<V>, "ISC"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 6 }, // 0xF7
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xF7
+#endif
+    { {&BasicExecutioner<BusT>::SED, "SED"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xF8
+    { {&BasicExecutioner<BusT>::template SBC<V>, "SBC"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 4 }, // 0xF9
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xFA
+    { {&BasicExecutioner<BusT>::template ISC<V>, "ISC"}, {&BasicExecutioner<BusT>::ABY, "ABY"}, 7 }, // 0xFB
+    { {&BasicExecutioner<BusT>::TOP, "TOP"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0xFC
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xFA
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xFB
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xFC
+#endif
+    { {&BasicExecutioner<BusT>::template SBC<V>, "SBC"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 }, // 0xFD
+    { {&BasicExecutioner<BusT>::INC, "INC"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0xFE
+#ifdef ILLEGAL
+    { {&BasicExecutioner<BusT>::template ISC<V>, "ISC"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 7 }, // 0xFF
+#else
+    { {&BasicExecutioner<BusT>::XXX, "XXX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 2 }, // 0xFF
 #endif
 #pragma endregion Instructions 0xF
-  };
+  }};
+
+  // The NMOS 6502
+  template <typename BusT>
+  inline constexpr const std::array<typename BasicExecutioner<BusT>::OperationType, 256>& lookup = lookupNMOS<BusT, ExecutionerBase::MOS6502>;
+  // The 2A03 only differs by ignoring the decimal flag
+  template <typename BusT>
+  inline constexpr const std::array<typename BasicExecutioner<BusT>::OperationType, 256>& lookup2A03 = lookupNMOS<BusT, ExecutionerBase::RICOH2A03>;
+
+  // The 65C02 starts from the NMOS table. Its new opcodes take the slots of
+  // illegal opcodes, the remaining illegal opcodes do nothing. The bit
+  // manipulation opcodes of the Rockwell & later WDC parts (RMB, SMB, BBR &
+  // BBS in the x7 & xF columns) are not emulated, these slots do nothing too.
+  template <typename BusT>
+  inline constexpr std::array<typename BasicExecutioner<BusT>::OperationType, 256> lookup65C02 = []() {
+    std::array<typename BasicExecutioner<BusT>::OperationType, 256> table = lookupNMOS<BusT, ExecutionerBase::WDC65C02>;
+
+    // Undefined opcodes, the columns x3, x7, xB & xF take a single cycle
+    for (size_t op = 0x03; op < table.size(); op += 0x04)
+    {
+      table[op] = { {&BasicExecutioner<BusT>::NOP1, "NOP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 1 };
+    }
+    for (uint8_t op : { 0x02, 0x22, 0x42, 0x62, 0x82, 0xC2, 0xE2 })
+    {
+      table[op] = { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 };
+    }
+    for (uint8_t op : { 0x54, 0xD4, 0xF4 })
+    {
+      table[op] = { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 };
+    }
+    table[0x44] = { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 };
+    table[0x5C] = { {&BasicExecutioner<BusT>::NOP8, "NOP"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 8 };
+    table[0xDC] = { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 };
+    table[0xFC] = { {&BasicExecutioner<BusT>::NOP, "NOP"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 };
+
+    // New opcodes
+    table[0x04] = { {&BasicExecutioner<BusT>::TSB, "TSB"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 };
+    table[0x0C] = { {&BasicExecutioner<BusT>::TSB, "TSB"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 };
+    table[0x12] = { {&BasicExecutioner<BusT>::ORA, "ORA"}, {&BasicExecutioner<BusT>::IZP, "IZP"}, 5 };
+    table[0x14] = { {&BasicExecutioner<BusT>::TRB, "TRB"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 5 };
+    table[0x1A] = { {&BasicExecutioner<BusT>::INC, "INC"}, {&BasicExecutioner<BusT>::ACC, "ACC"}, 2 };
+    table[0x1C] = { {&BasicExecutioner<BusT>::TRB, "TRB"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 6 };
+    table[0x32] = { {&BasicExecutioner<BusT>::AND, "AND"}, {&BasicExecutioner<BusT>::IZP, "IZP"}, 5 };
+    table[0x34] = { {&BasicExecutioner<BusT>::BIT, "BIT"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 };
+    table[0x3A] = { {&BasicExecutioner<BusT>::DEC, "DEC"}, {&BasicExecutioner<BusT>::ACC, "ACC"}, 2 };
+    table[0x3C] = { {&BasicExecutioner<BusT>::BIT, "BIT"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 4 };
+    table[0x52] = { {&BasicExecutioner<BusT>::EOR, "EOR"}, {&BasicExecutioner<BusT>::IZP, "IZP"}, 5 };
+    table[0x5A] = { {&BasicExecutioner<BusT>::PHY, "PHY"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 3 };
+    table[0x64] = { {&BasicExecutioner<BusT>::STZ, "STZ"}, {&BasicExecutioner<BusT>::ZP0, "ZP0"}, 3 };
+    table[0x72] = { {&BasicExecutioner<BusT>::template ADC<ExecutionerBase::WDC65C02>, "ADC"}, {&BasicExecutioner<BusT>::IZP, "IZP"}, 5 };
+    table[0x74] = { {&BasicExecutioner<BusT>::STZ, "STZ"}, {&BasicExecutioner<BusT>::ZPX, "ZPX"}, 4 };
+    table[0x7A] = { {&BasicExecutioner<BusT>::PLY, "PLY"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 4 };
+    table[0x7C] = { {&BasicExecutioner<BusT>::JMP, "JMP"}, {&BasicExecutioner<BusT>::IAX, "IAX"}, 6 };
+    table[0x80] = { {&BasicExecutioner<BusT>::BRA, "BRA"}, {&BasicExecutioner<BusT>::REL, "REL"}, 2 };
+    table[0x89] = { {&BasicExecutioner<BusT>::BIT, "BIT"}, {&BasicExecutioner<BusT>::IMM, "IMM"}, 2 };
+    table[0x92] = { {&BasicExecutioner<BusT>::STA, "STA"}, {&BasicExecutioner<BusT>::IZP, "IZP"}, 5 };
+    table[0x9C] = { {&BasicExecutioner<BusT>::STZ, "STZ"}, {&BasicExecutioner<BusT>::ABS, "ABS"}, 4 };
+    table[0x9E] = { {&BasicExecutioner<BusT>::STZ, "STZ"}, {&BasicExecutioner<BusT>::ABX, "ABX"}, 5 };
+    table[0xB2] = { {&BasicExecutioner<BusT>::LDA, "LDA"}, {&BasicExecutioner<BusT>::IZP, "IZP"}, 5 };
+    table[0xCB] = { {&BasicExecutioner<BusT>::WAI, "WAI"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 3 };
+    table[0xD2] = { {&BasicExecutioner<BusT>::CMP, "CMP"}, {&BasicExecutioner<BusT>::IZP, "IZP"}, 5 };
+    table[0xDA] = { {&BasicExecutioner<BusT>::PHX, "PHX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 3 };
+    table[0xDB] = { {&BasicExecutioner<BusT>::STP, "STP"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 3 };
+    table[0xF2] = { {&BasicExecutioner<BusT>::template SBC<ExecutionerBase::WDC65C02>, "SBC"}, {&BasicExecutioner<BusT>::IZP, "IZP"}, 5 };
+    table[0xFA] = { {&BasicExecutioner<BusT>::PLX, "PLX"}, {&BasicExecutioner<BusT>::IMP, "IMP"}, 4 };
+
+    // The indirect jump reads the pointer across pages, taking a cycle more
+    table[0x6C].cycles = 6;
+    // Shifts & rotates with absolute X addressing only take the extra cycle
+    // when the page is crossed
+    for (uint8_t op : { 0x1E, 0x3E, 0x5E, 0x7E })
+    {
+      table[op].cycles = 6;
+      table[op].policy = ExecutionerBase::PAGE_CROSS;
+    }
+    return table;
+  }();
+
+  // The opcode table of each variant
+  template <typename BusT, ExecutionerBase::VARIANT V>
+  inline constexpr const std::array<typename BasicExecutioner<BusT>::OperationType, 256>& instructionSet =
+    (V == ExecutionerBase::WDC65C02) ? lookup65C02<BusT> : lookupNMOS<BusT, V>;
 #pragma endregion Instructions
 
-};
+  // Superinstructions, pairs of opcodes that usually run one after another.
+  // The SUPERINSTRUCTION engine runs the second opcode straight after the
+  // first, without dispatching, whenever it follows. Pairs chain when the
+  // second opcode of a pair starts another one (INX; CPX #imm; BNE).
+  // The pairs were picked from OpcodeProfile counts.
+#pragma region Superinstructions
+  inline constexpr std::array<std::pair<uint8_t, uint8_t>, 11> superinstructions = {{
+    { 0x88, 0xD0 }, // DEY; BNE
+    { 0xCA, 0xD0 }, // DEX; BNE
+    { 0xE8, 0xE0 }, // INX; CPX #imm
+    { 0xC8, 0xC0 }, // INY; CPY #imm
+    { 0xE0, 0xD0 }, // CPX #imm; BNE
+    { 0xC0, 0xD0 }, // CPY #imm; BNE
+    { 0xC9, 0xD0 }, // CMP #imm; BNE
+    { 0xC5, 0xD0 }, // CMP zp; BNE
+    { 0xA5, 0x8D }, // LDA zp; STA abs
+    { 0x18, 0x69 }, // CLC; ADC #imm
+    { 0x38, 0xE9 }, // SEC; SBC #imm
+  }};
+
+  // The opcode fused to each opcode, -1 if none
+  inline constexpr std::array<int16_t, 256> successors = []() {
+    std::array<int16_t, 256> table = {};
+    table.fill(-1);
+    for (auto [first, second] : superinstructions)
+    {
+      if (table[first] != -1)
+      {
+        throw std::invalid_argument("Opcode starts more than one superinstruction");
+      }
+      table[first] = second;
+    }
+
+    // Chains are expanded at compile time, so they must end
+    for (int16_t op = 0; op < 256; op++)
+    {
+      int16_t next = table[op];
+      for (size_t n = 0; next != -1; n++)
+      {
+        if (n > superinstructions.size())
+        {
+          throw std::invalid_argument("Superinstructions form a loop");
+        }
+        next = table[next];
+      }
+    }
+    return table;
+  }();
+#pragma endregion Superinstructions
+}
@@ -0,0 +1,482 @@
+#pragma once
+
+#include "Jit.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef JIT_DISPATCH
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace CPU
+{
+  PROCESSOR_INLINE Jit::~Jit()
+  {
+#ifdef JIT_DISPATCH
+    if (buffer != nullptr)
+    {
+      munmap(buffer, BUFFER_SIZE);
+    }
+#endif
+  }
+
+  PROCESSOR_INLINE void Jit::clear()
+  {
+    blocks.reset();
+    used = 0;
+  }
+
+#ifdef JIT_DISPATCH
+  PROCESSOR_INLINE Jit::BlockType Jit::install(const std::vector<uint8_t>& code)
+  {
+    size_t size = code.size();
+    if (code.empty() || size > BUFFER_SIZE)
+    {
+      return nullptr;
+    }
+
+    if (buffer == nullptr)
+    {
+      void* memory = mmap(nullptr, BUFFER_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (memory == MAP_FAILED)
+      {
+        return nullptr;
+      }
+      buffer = static_cast<uint8_t*>(memory);
+    }
+
+    if (used + size > BUFFER_SIZE)
+    {
+      clear();
+    }
+
+    // The buffer is never writable and executable at the same time, only
+    // the pages the block is written to are made writable
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t first = used / pageSize * pageSize;
+    size_t last = std::min((used + size + pageSize - 1) / pageSize * pageSize, BUFFER_SIZE);
+    if (mprotect(buffer + first, last - first, PROT_READ | PROT_WRITE) != 0)
+    {
+      clear();
+      return nullptr;
+    }
+
+    uint8_t* block = buffer + used;
+    std::memcpy(block, code.data(), size);
+    used += size;
+
+    if (mprotect(buffer + first, last - first, PROT_READ | PROT_EXEC) != 0)
+    {
+      // None of the blocks can run any more
+      clear();
+      return nullptr;
+    }
+
+    return reinterpret_cast<BlockType>(block);
+  }
+#else
+  PROCESSOR_INLINE Jit::BlockType Jit::install(const std::vector<uint8_t>&)
+  {
+    return nullptr;
+  }
+#endif
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region ASSEMBLER
+// ASSEMBLER
+
+  PROCESSOR_INLINE void Jit::Assembler::emit16(uint16_t value)
+  {
+    emit(value & 0xFF);
+    emit(value >> 8);
+  }
+
+  PROCESSOR_INLINE void Jit::Assembler::emit32(uint32_t value)
+  {
+    for (int i = 0; i < 4; i++)
+    {
+      emit((value >> (i * 8)) & 0xFF);
+    }
+  }
+
+  // 0100WRXB, W for 64-bit operands, R, X & B extend the reg, index & base
+  // (or rm) fields to r8-r15
+  PROCESSOR_INLINE void Jit::Assembler::rex(bool wide, uint8_t reg, uint8_t index, uint8_t base, bool byteRegister)
+  {
+    uint8_t prefix = 0x40 | (wide ? 0x08 : 0x00) | ((reg & 0x08) >> 1) | ((index & 0x08) >> 2) | ((base & 0x08) >> 3);
+    if (prefix != 0x40 || byteRegister)
+    {
+      emit(prefix);
+    }
+  }
+
+  PROCESSOR_INLINE void Jit::Assembler::rex(bool wide, uint8_t reg, ADDRESS address, bool byteRegister)
+  {
+    rex(wide, reg, (address.index == NOREG) ? 0 : address.index, address.base, byteRegister);
+  }
+
+  // Memory operands always use a SIB byte, which takes any base & index
+  // register, and the shortest displacement
+  PROCESSOR_INLINE void Jit::Assembler::modrm(uint8_t reg, ADDRESS address)
+  {
+    uint8_t base = address.base & 0x07;
+    uint8_t mod;
+    if (address.displacement == 0 && base != RBP)
+    {
+      mod = 0x00;
+    }
+    else if (address.displacement >= -128 && address.displacement <= 127)
+    {
+      mod = 0x01;
+    }
+    else
+    {
+      mod = 0x02;
+    }
+
+    uint8_t scale = (address.scale == 8) ? 3 : (address.scale == 4) ? 2 : (address.scale == 2) ? 1 : 0;
+    uint8_t index = (address.index == NOREG) ? RSP : (address.index & 0x07);
+
+    emit((mod << 6) | ((reg & 0x07) << 3) | RSP);
+    emit((scale << 6) | (index << 3) | base);
+    if (mod == 0x01)
+    {
+      emit(static_cast<uint8_t>(address.displacement));
+    }
+    else if (mod == 0x02)
+    {
+      emit32(static_cast<uint32_t>(address.displacement));
+    }
+  }
+
+  PROCESSOR_INLINE void Jit::Assembler::modrm(uint8_t reg, REGISTER rm)
+  {
+    emit(0xC0 | ((reg & 0x07) << 3) | (rm & 0x07));
+  }
+
+  // mov r32, r32
+  PROCESSOR_INLINE void Jit::Assembler::mov(REGISTER dst, REGISTER src)
+  {
+    rex(false, src, 0, dst);
+    emit(0x89);
+    modrm(src, dst);
+  }
+
+  // mov r32, imm32
+  PROCESSOR_INLINE void Jit::Assembler::mov(REGISTER dst, uint32_t imm)
+  {
+    rex(false, 0, 0, dst);
+    emit(0xB8 + (dst & 0x07));
+    emit32(imm);
+  }
+
+  // mov r64, imm64
+  PROCESSOR_INLINE void Jit::Assembler::mov64(REGISTER dst, uint64_t imm)
+  {
+    rex(true, 0, 0, dst);
+    emit(0xB8 + (dst & 0x07));
+    emit32(imm & 0xFFFFFFFF);
+    emit32(imm >> 32);
+  }
+
+  // lea r32, m
+  PROCESSOR_INLINE void Jit::Assembler::lea(REGISTER dst, ADDRESS src)
+  {
+    rex(false, dst, src);
+    emit(0x8D);
+    modrm(dst, src);
+  }
+
+  // mov r64, m64
+  PROCESSOR_INLINE void Jit::Assembler::load64(REGISTER dst, ADDRESS src)
+  {
+    rex(true, dst, src);
+    emit(0x8B);
+    modrm(dst, src);
+  }
+
+  // movzx r32, m8
+  PROCESSOR_INLINE void Jit::Assembler::load8(REGISTER dst, ADDRESS src)
+  {
+    rex(false, dst, src);
+    emit(0x0F);
+    emit(0xB6);
+    modrm(dst, src);
+  }
+
+  // movzx r32, m16
+  PROCESSOR_INLINE void Jit::Assembler::load16(REGISTER dst, ADDRESS src)
+  {
+    rex(false, dst, src);
+    emit(0x0F);
+    emit(0xB7);
+    modrm(dst, src);
+  }
+
+  // movzx r32, r8
+  PROCESSOR_INLINE void Jit::Assembler::movzx8(REGISTER dst, REGISTER src)
+  {
+    rex(false, dst, 0, src, src >= RSP && src <= RDI);
+    emit(0x0F);
+    emit(0xB6);
+    modrm(dst, src);
+  }
+
+  // mov m8, r8
+  PROCESSOR_INLINE void Jit::Assembler::store8(ADDRESS dst, REGISTER src)
+  {
+    rex(false, src, dst, src >= RSP && src <= RDI);
+    emit(0x88);
+    modrm(src, dst);
+  }
+
+  // mov m8, imm8
+  PROCESSOR_INLINE void Jit::Assembler::store8(ADDRESS dst, uint8_t imm)
+  {
+    rex(false, 0, dst);
+    emit(0xC6);
+    modrm(0, dst);
+    emit(imm);
+  }
+
+  // mov m16, r16
+  PROCESSOR_INLINE void Jit::Assembler::store16(ADDRESS dst, REGISTER src)
+  {
+    emit(0x66);
+    rex(false, src, dst);
+    emit(0x89);
+    modrm(src, dst);
+  }
+
+  // mov m16, imm16
+  PROCESSOR_INLINE void Jit::Assembler::store16(ADDRESS dst, uint16_t imm)
+  {
+    emit(0x66);
+    rex(false, 0, dst);
+    emit(0xC7);
+    modrm(0, dst);
+    emit16(imm);
+  }
+
+  // mov m32, imm32
+  PROCESSOR_INLINE void Jit::Assembler::store32(ADDRESS dst, uint32_t imm)
+  {
+    rex(false, 0, dst);
+    emit(0xC7);
+    modrm(0, dst);
+    emit32(imm);
+  }
+
+  // <op> r32, r32
+  PROCESSOR_INLINE void Jit::Assembler::op(OPERATION operation, REGISTER dst, REGISTER src)
+  {
+    rex(false, src, 0, dst);
+    emit((operation << 3) | 0x01);
+    modrm(src, dst);
+  }
+
+  // <op> r32, imm8/imm32
+  PROCESSOR_INLINE void Jit::Assembler::op(OPERATION operation, REGISTER dst, uint32_t imm)
+  {
+    int32_t value = static_cast<int32_t>(imm);
+    rex(false, 0, 0, dst);
+    emit((value >= -128 && value <= 127) ? 0x83 : 0x81);
+    modrm(operation, dst);
+    if (value >= -128 && value <= 127)
+    {
+      emit(static_cast<uint8_t>(value));
+    }
+    else
+    {
+      emit32(imm);
+    }
+  }
+
+  // <op> m32, r32
+  PROCESSOR_INLINE void Jit::Assembler::op(OPERATION operation, ADDRESS dst, REGISTER src)
+  {
+    rex(false, src, dst);
+    emit((operation << 3) | 0x01);
+    modrm(src, dst);
+  }
+
+  // <op> m32, imm8/imm32
+  PROCESSOR_INLINE void Jit::Assembler::op(OPERATION operation, ADDRESS dst, uint32_t imm)
+  {
+    int32_t value = static_cast<int32_t>(imm);
+    rex(false, 0, dst);
+    emit((value >= -128 && value <= 127) ? 0x83 : 0x81);
+    modrm(operation, dst);
+    if (value >= -128 && value <= 127)
+    {
+      emit(static_cast<uint8_t>(value));
+    }
+    else
+    {
+      emit32(imm);
+    }
+  }
+
+  // <op> r8, m8
+  PROCESSOR_INLINE void Jit::Assembler::op8(OPERATION operation, REGISTER dst, ADDRESS src)
+  {
+    rex(false, dst, src, dst >= RSP && dst <= RDI);
+    emit((operation << 3) | 0x02);
+    modrm(dst, src);
+  }
+
+  // <op> m8, r8
+  PROCESSOR_INLINE void Jit::Assembler::op8(OPERATION operation, ADDRESS dst, REGISTER src)
+  {
+    rex(false, src, dst, src >= RSP && src <= RDI);
+    emit(operation << 3);
+    modrm(src, dst);
+  }
+
+  // <op> m8, imm8
+  PROCESSOR_INLINE void Jit::Assembler::op8(OPERATION operation, ADDRESS dst, uint8_t imm)
+  {
+    rex(false, 0, dst);
+    emit(0x80);
+    modrm(operation, dst);
+    emit(imm);
+  }
+
+  // <op> m16, r16
+  PROCESSOR_INLINE void Jit::Assembler::op16(OPERATION operation, ADDRESS dst, REGISTER src)
+  {
+    emit(0x66);
+    rex(false, src, dst);
+    emit((operation << 3) | 0x01);
+    modrm(src, dst);
+  }
+
+  // <op> m16, imm8/imm16
+  PROCESSOR_INLINE void Jit::Assembler::op16(OPERATION operation, ADDRESS dst, uint16_t imm)
+  {
+    int16_t value = static_cast<int16_t>(imm);
+    emit(0x66);
+    rex(false, 0, dst);
+    emit((value >= -128 && value <= 127) ? 0x83 : 0x81);
+    modrm(operation, dst);
+    if (value >= -128 && value <= 127)
+    {
+      emit(static_cast<uint8_t>(value));
+    }
+    else
+    {
+      emit16(imm);
+    }
+  }
+
+  // inc m32
+  PROCESSOR_INLINE void Jit::Assembler::inc(ADDRESS dst)
+  {
+    rex(false, 0, dst);
+    emit(0xFF);
+    modrm(0, dst);
+  }
+
+  // test r8, imm8
+  PROCESSOR_INLINE void Jit::Assembler::test8(REGISTER reg, uint8_t imm)
+  {
+    rex(false, 0, 0, reg, reg >= RSP && reg <= RDI);
+    emit(0xF6);
+    modrm(0, reg);
+    emit(imm);
+  }
+
+  // test r64, r64
+  PROCESSOR_INLINE void Jit::Assembler::test64(REGISTER a, REGISTER b)
+  {
+    rex(true, b, 0, a);
+    emit(0x85);
+    modrm(b, a);
+  }
+
+  // <shift> r32, imm8
+  PROCESSOR_INLINE void Jit::Assembler::shift(SHIFT operation, REGISTER reg, uint8_t count)
+  {
+    rex(false, 0, 0, reg);
+    emit(0xC1);
+    modrm(operation, reg);
+    emit(count);
+  }
+
+  // <shift> r32, cl
+  PROCESSOR_INLINE void Jit::Assembler::shift(SHIFT operation, REGISTER reg)
+  {
+    rex(false, 0, 0, reg);
+    emit(0xD3);
+    modrm(operation, reg);
+  }
+
+  // set<cc> r8
+  PROCESSOR_INLINE void Jit::Assembler::set(CONDITION condition, REGISTER dst)
+  {
+    rex(false, 0, 0, dst, dst >= RSP && dst <= RDI);
+    emit(0x0F);
+    emit(0x90 + condition);
+    modrm(0, dst);
+  }
+
+  PROCESSOR_INLINE void Jit::Assembler::push(REGISTER reg)
+  {
+    rex(false, 0, 0, reg);
+    emit(0x50 + (reg & 0x07));
+  }
+
+  PROCESSOR_INLINE void Jit::Assembler::pop(REGISTER reg)
+  {
+    rex(false, 0, 0, reg);
+    emit(0x58 + (reg & 0x07));
+  }
+
+  PROCESSOR_INLINE void Jit::Assembler::ret()
+  {
+    emit(0xC3);
+  }
+
+  PROCESSOR_INLINE Jit::Assembler::LABEL Jit::Assembler::label()
+  {
+    labels.push_back(-1);
+    return labels.size() - 1;
+  }
+
+  PROCESSOR_INLINE void Jit::Assembler::bind(LABEL label)
+  {
+    labels[label] = static_cast<int64_t>(code.size());
+  }
+
+  // jmp rel32
+  PROCESSOR_INLINE void Jit::Assembler::jump(LABEL label)
+  {
+    emit(0xE9);
+    jumps.push_back({ code.size(), label });
+    emit32(0);
+  }
+
+  // j<cc> rel32
+  PROCESSOR_INLINE void Jit::Assembler::jump(CONDITION condition, LABEL label)
+  {
+    emit(0x0F);
+    emit(0x80 + condition);
+    jumps.push_back({ code.size(), label });
+    emit32(0);
+  }
+
+  PROCESSOR_INLINE const std::vector<uint8_t>& Jit::Assembler::finish()
+  {
+    for (const auto& [position, label] : jumps)
+    {
+      // Relative to the end of the instruction
+      uint32_t rel = static_cast<uint32_t>(labels[label] - static_cast<int64_t>(position + 4));
+      std::memcpy(code.data() + position, &rel, sizeof(rel));
+    }
+    jumps.clear();
+    return code;
+  }
+#pragma endregion ASSEMBLER
+}
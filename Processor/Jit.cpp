@@ -0,0 +1 @@
+#include "Jit-inl.hpp"
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "Common.hpp"
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Native code is generated for x86-64 with the System V calling convention
+// (Linux, macOS & BSD)
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(_WIN32)
+#define JIT_DISPATCH 1
+#endif
+
+namespace CPU
+{
+  // Translates hot basic blocks into x86-64 machine code. The Jit holds the
+  // executable memory, the translated blocks and the assembler writing them,
+  // Executioner::translate() decides what every opcode becomes.
+  //
+  // A block keeps the registers of the processor in host registers, and
+  // reads & writes the memory of the bus through its page table, so nothing
+  // is called while it runs. It is left with the registers stored back into
+  // its CONTEXT when the flow of control changes, before an access the page
+  // table can't do (a handler, a device, an aliased page, ...), before an
+  // instruction it can't run (e.g. ADC in decimal mode), and after a write
+  // to its own page, which makes it stale.
+  class Jit
+  {
+  public:
+    Jit() = default;
+    ~Jit();
+
+    Jit(const Jit&) = delete;
+    Jit& operator=(const Jit&) = delete;
+
+    // The state a block runs on, the registers are loaded from it when the
+    // block is entered and stored back when it is left, with where it was
+    // left
+    struct CONTEXT
+    {
+      uint8_t  AC = 0x00;
+      uint8_t  X = 0x00;
+      uint8_t  Y = 0x00;
+      uint8_t  SP = 0x00;
+      uint8_t  SR = 0x00;
+      // Opcode & extra cycles of the last instruction run
+      uint8_t  opcode = 0x00;
+      uint8_t  extra = 0;
+      // Address of the next instruction
+      uint16_t PC = 0x0000;
+      // Number of instructions run, 0 when the first one is left to the
+      // interpreter
+      uint32_t instructions = 0;
+      // Number of cycles they took
+      uint32_t cycles = 0;
+    };
+
+    typedef void(*BlockType)(CONTEXT*);
+
+    // Where the generated code finds the memory of the bus, see
+    // Bus::getJitMemory()
+    struct MEMORY
+    {
+      // 256 pages of a read & a write pointer, nullptr when the page has no
+      // memory to read from or to write to
+      const void*    pages = nullptr;
+      // Rows written, one bit per 16 bytes of a page
+      uint16_t*      dirty = nullptr;
+      // Next page sharing the memory of the page, itself if none
+      const uint8_t* aliases = nullptr;
+      // Generations of the block cache pages
+      uint32_t*      generations = nullptr;
+    };
+
+    struct BLOCK
+    {
+      // Translated code, nullptr until the address gets hot
+      BlockType code = nullptr;
+      // Generation of the block cache page the block was translated from
+      uint32_t  generation = 0;
+      // Number of times the address was interpreted
+      uint8_t   hits = 0;
+      // Number of instructions in the block
+      uint8_t   length = 0;
+      // Offset in the page of the last instruction
+      uint8_t   last = 0x00;
+      // Most cycles the instructions can take
+      uint8_t   cycles = 0;
+    };
+
+    // Number of times an address is interpreted before it is translated
+    static constexpr uint8_t HOT_THRESHOLD = 64;
+
+    // True if native code can be generated on this platform
+    static constexpr bool isAvailable()
+    {
+#ifdef JIT_DISPATCH
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    // Returns the block starting at the address, allocating its page if needed
+    BLOCK& block(uint16_t addr)
+    {
+      if (blocks == nullptr)
+      {
+        blocks = std::make_unique<Pages>();
+      }
+
+      std::unique_ptr<Page>& page = (*blocks)[addr >> 8];
+      if (page == nullptr)
+      {
+        page = std::make_unique<Page>();
+      }
+      return (*page)[addr & 0xFF];
+    }
+
+    // The general purpose registers, by their encoding
+    enum REGISTER : uint8_t
+    {
+      RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+      R8, R9, R10, R11, R12, R13, R14, R15,
+      NOREG = 0xFF,
+    };
+
+    // Memory operand, [base + index * scale + displacement]
+    struct ADDRESS
+    {
+      REGISTER base;
+      int32_t  displacement = 0;
+      REGISTER index = NOREG;
+      uint8_t  scale = 1;
+    };
+
+    // Condition codes of the conditional jumps & setcc
+    enum CONDITION : uint8_t
+    {
+      O, NO, B, AE, E, NE, BE, A, S, NS, P, NP, L, GE, LE, G,
+    };
+
+    // Arithmetic & logical operations, by their /digit
+    enum OPERATION : uint8_t
+    {
+      ADD = 0, OR = 1, AND = 4, SUB = 5, XOR = 6, CMP = 7,
+    };
+
+    // Shifts, by their /digit
+    enum SHIFT : uint8_t
+    {
+      SHL = 4, SHR = 5,
+    };
+
+    // Writes the machine code of a block. The operations are 32-bit unless
+    // their name says otherwise, the 8-bit ones taking the low byte of the
+    // registers. Jumps go to labels, bound anywhere in the block.
+    class Assembler
+    {
+    public:
+      typedef size_t LABEL;
+
+      void mov(REGISTER dst, REGISTER src);
+      void mov(REGISTER dst, uint32_t imm);
+      void mov64(REGISTER dst, uint64_t imm);
+      void lea(REGISTER dst, ADDRESS src);
+      void load64(REGISTER dst, ADDRESS src);
+      // Zero-extended
+      void load8(REGISTER dst, ADDRESS src);
+      void load16(REGISTER dst, ADDRESS src);
+      void movzx8(REGISTER dst, REGISTER src);
+      void store8(ADDRESS dst, REGISTER src);
+      void store8(ADDRESS dst, uint8_t imm);
+      void store16(ADDRESS dst, REGISTER src);
+      void store16(ADDRESS dst, uint16_t imm);
+      void store32(ADDRESS dst, uint32_t imm);
+
+      void op(OPERATION operation, REGISTER dst, REGISTER src);
+      void op(OPERATION operation, REGISTER dst, uint32_t imm);
+      void op(OPERATION operation, ADDRESS dst, REGISTER src);
+      void op(OPERATION operation, ADDRESS dst, uint32_t imm);
+      void op8(OPERATION operation, REGISTER dst, ADDRESS src);
+      void op8(OPERATION operation, ADDRESS dst, REGISTER src);
+      void op8(OPERATION operation, ADDRESS dst, uint8_t imm);
+      void op16(OPERATION operation, ADDRESS dst, REGISTER src);
+      void op16(OPERATION operation, ADDRESS dst, uint16_t imm);
+      void inc(ADDRESS dst);
+      void test8(REGISTER reg, uint8_t imm);
+      void test64(REGISTER a, REGISTER b);
+      void shift(SHIFT operation, REGISTER reg, uint8_t count);
+      // Shifts by cl
+      void shift(SHIFT operation, REGISTER reg);
+      void set(CONDITION condition, REGISTER dst);
+
+      void push(REGISTER reg);
+      void pop(REGISTER reg);
+      void ret();
+
+      LABEL label();
+      void  bind(LABEL label);
+      void  jump(LABEL label);
+      void  jump(CONDITION condition, LABEL label);
+
+      // The machine code, with the jumps resolved. Every label jumped to
+      // must be bound
+      const std::vector<uint8_t>& finish();
+
+    private:
+      std::vector<uint8_t> code;
+      // Position of every label, -1 until bound
+      std::vector<int64_t> labels;
+      // Position of every rel32 and the label it jumps to
+      std::vector<std::pair<size_t, LABEL>> jumps;
+
+      void emit(uint8_t byte) { code.push_back(byte); }
+      void emit16(uint16_t value);
+      void emit32(uint32_t value);
+      // The REX prefix, if the operands need one. An 8-bit register from
+      // spl to dil always needs one
+      void rex(bool wide, uint8_t reg, uint8_t index, uint8_t base, bool byteRegister = false);
+      void rex(bool wide, uint8_t reg, ADDRESS address, bool byteRegister = false);
+      // ModRM (with SIB & displacement) of the operands
+      void modrm(uint8_t reg, ADDRESS address);
+      void modrm(uint8_t reg, REGISTER rm);
+    };
+
+    // Copies the code of a block into executable memory. When the buffer is
+    // full every block is dropped first, so blocks must be looked up again
+    // afterwards. Returns nullptr if the code could not be installed
+    BlockType install(const std::vector<uint8_t>& code);
+
+    // Drops every translated block
+    void clear();
+
+  private:
+    typedef std::array<BLOCK, 256> Page;
+    typedef std::array<std::unique_ptr<Page>, 256> Pages;
+
+    static constexpr size_t BUFFER_SIZE = 1024 * 1024;
+
+    // Allocated once the first block gets hot
+    std::unique_ptr<Pages> blocks;
+
+    // Executable memory, allocated on first use
+    uint8_t* buffer = nullptr;
+    size_t   used = 0;
+  };
+}
+
+#ifdef HEADER_ONLY
+#include "Jit-inl.hpp"
+#endif
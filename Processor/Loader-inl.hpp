@@ -0,0 +1,348 @@
+#pragma once
+
+#include "Loader.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#ifdef SPDLOG_FMT_EXTERNAL
+#include <fmt/format.h>
+#else
+#include <spdlog/fmt/fmt.h>
+#endif
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CPU
+{
+  // A record following the previous one in memory extends its segment
+  struct Loader::RECORDS
+  {
+    std::vector<uint8_t> bytes;
+    // Address & offset in bytes of the start of every segment
+    std::vector<std::pair<uint16_t, size_t>> starts;
+    uint64_t next = UINT64_MAX;
+
+    void add(uint64_t address, const uint8_t* data, size_t size, size_t line)
+    {
+      if (size == 0)
+      {
+        return;
+      }
+      if (address + size > 0x10000)
+      {
+        throw std::runtime_error(fmt::format("Record on line {} is outside of the address space", line));
+      }
+      if (address != next)
+      {
+        starts.push_back({ (uint16_t)address, bytes.size() });
+      }
+      bytes.insert(bytes.end(), data, data + size);
+      next = address + size;
+    }
+
+    IMAGE image(int32_t entry)
+    {
+      auto storage = std::make_shared<std::vector<uint8_t>>(std::move(bytes));
+      IMAGE result;
+      for (size_t i = 0; i < starts.size(); i++)
+      {
+        size_t end = (i + 1 < starts.size()) ? starts[i + 1].second : storage->size();
+        result.segments.push_back({ starts[i].first, std::span<const uint8_t>(storage->data() + starts[i].second, end - starts[i].second) });
+      }
+      result.entry = entry;
+      result.storage = storage;
+      return result;
+    }
+  };
+
+  PROCESSOR_INLINE std::vector<uint8_t> Loader::hexBytes(std::span<const uint8_t> digits, size_t line)
+  {
+    if (digits.size() % 2 != 0)
+    {
+      throw std::runtime_error(fmt::format("Odd number of digits on line {}", line));
+    }
+
+    std::vector<uint8_t> bytes(digits.size() / 2, 0x00);
+    for (size_t i = 0; i < digits.size(); i++)
+    {
+      uint8_t c = digits[i];
+      if (!std::isxdigit(c))
+      {
+        throw std::runtime_error(fmt::format("Invalid digit on line {}", line));
+      }
+      uint8_t digit = std::isdigit(c) ? c - '0' : std::toupper(c) - 'A' + 10;
+      bytes[i / 2] = (uint8_t)((bytes[i / 2] << 4) | digit);
+    }
+    return bytes;
+  }
+
+  template <typename VISITOR>
+  void Loader::forEachLine(std::span<const uint8_t> data, VISITOR&& visit)
+  {
+    size_t number = 0;
+    size_t start = 0;
+    while (start < data.size())
+    {
+      size_t end = start;
+      while (end < data.size() && data[end] != '\n')
+      {
+        end++;
+      }
+      size_t first = start, last = end;
+      while (first < last && std::isspace(data[first]))
+      {
+        first++;
+      }
+      while (last > first && std::isspace(data[last - 1]))
+      {
+        last--;
+      }
+      number++;
+      if (last > first)
+      {
+        visit(data.subspan(first, last - first), number);
+      }
+      start = end + 1;
+    }
+  }
+
+  PROCESSOR_INLINE Loader::IMAGE Loader::load(const std::string& path, FORMAT format, uint16_t address)
+  {
+#ifdef _WIN32
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+      throw std::runtime_error(fmt::format("Unable to open {}", path));
+    }
+    auto storage = std::make_shared<std::vector<uint8_t>>((size_t)file.tellg());
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(storage->data()), (std::streamsize)storage->size());
+    std::span<const uint8_t> data(storage->data(), storage->size());
+    std::shared_ptr<const void> mapping = storage;
+#else
+    int file = open(path.c_str(), O_RDONLY);
+    struct stat status;
+    if (file < 0 || fstat(file, &status) != 0)
+    {
+      if (file >= 0)
+      {
+        close(file);
+      }
+      throw std::runtime_error(fmt::format("Unable to open {}", path));
+    }
+
+    size_t size = (size_t)status.st_size;
+    void* memory = (size > 0) ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0) : nullptr;
+    close(file);
+    if (memory == MAP_FAILED)
+    {
+      throw std::runtime_error(fmt::format("Unable to map {}", path));
+    }
+
+    // Unmapped with the last image using it
+    std::shared_ptr<const void> mapping(memory, [size](const void* memory) {
+      if (memory != nullptr)
+      {
+        munmap(const_cast<void*>(memory), size);
+      }
+    });
+    std::span<const uint8_t> data(static_cast<const uint8_t*>(memory), size);
+#endif
+
+    IMAGE image = decode(data, format, address);
+    if (format == RAW || format == PRG)
+    {
+      image.storage = mapping;
+    }
+    return image;
+  }
+
+  PROCESSOR_INLINE Loader::IMAGE Loader::load(const std::string& path, uint16_t address)
+  {
+    return load(path, detect(path), address);
+  }
+
+  PROCESSOR_INLINE Loader::IMAGE Loader::decode(std::span<const uint8_t> data, FORMAT format, uint16_t address)
+  {
+    IMAGE image;
+    switch (format)
+    {
+      case RAW:
+      {
+        if (data.size() > 0x10000)
+        {
+          throw std::runtime_error(fmt::format("Image is {} bytes, larger than the address space", data.size()));
+        }
+        if (!data.empty())
+        {
+          image.segments.push_back({ address, data });
+        }
+        break;
+      }
+      case PRG:
+      {
+        if (data.size() < 2 || data.size() - 2 > 0x10000 - (size_t)(data[0] | (data[1] << 8)))
+        {
+          throw std::runtime_error("PRG image does not fit in the address space");
+        }
+        if (data.size() > 2)
+        {
+          image.segments.push_back({ (uint16_t)(data[0] | (data[1] << 8)), data.subspan(2) });
+        }
+        break;
+      }
+      case INTEL_HEX:
+        return decodeIntelHex(data);
+      case SRECORD:
+        return decodeSRecord(data);
+    }
+    return image;
+  }
+
+  PROCESSOR_INLINE Loader::FORMAT Loader::detect(const std::string& path)
+  {
+    std::string extension = path.substr(std::min(path.rfind('.'), path.size()));
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+
+    if (extension == ".prg")
+    {
+      return PRG;
+    }
+    if (extension == ".hex" || extension == ".ihx")
+    {
+      return INTEL_HEX;
+    }
+    if (extension == ".s19" || extension == ".s28" || extension == ".s37" || extension == ".srec" || extension == ".mot")
+    {
+      return SRECORD;
+    }
+    return RAW;
+  }
+
+  // :LLAAAATT<data>CC, the checksum makes the sum of the bytes 0
+  PROCESSOR_INLINE Loader::IMAGE Loader::decodeIntelHex(std::span<const uint8_t> data)
+  {
+    RECORDS records;
+    int32_t entry = -1;
+    uint32_t base = 0;
+    bool end = false;
+
+    forEachLine(data, [&](std::span<const uint8_t> line, size_t number) {
+      if (end)
+      {
+        return;
+      }
+      if (line[0] != ':')
+      {
+        throw std::runtime_error(fmt::format("Line {} is not an Intel HEX record", number));
+      }
+
+      std::vector<uint8_t> bytes = hexBytes(line.subspan(1), number);
+      if (bytes.size() < 5 || bytes.size() != (size_t)bytes[0] + 5)
+      {
+        throw std::runtime_error(fmt::format("Invalid length on line {}", number));
+      }
+      uint8_t sum = 0;
+      for (uint8_t b : bytes)
+      {
+        sum += b;
+      }
+      if (sum != 0)
+      {
+        throw std::runtime_error(fmt::format("Invalid checksum on line {}", number));
+      }
+
+      const uint8_t* payload = bytes.data() + 4;
+      uint32_t address = (bytes[1] << 8) | bytes[2];
+      bool isAddress = bytes[3] >= 0x02 && bytes[3] <= 0x05;
+      if (isAddress && bytes[0] != ((bytes[3] & 0x01) ? 4 : 2))
+      {
+        throw std::runtime_error(fmt::format("Invalid address record on line {}", number));
+      }
+      switch (bytes[3])
+      {
+        // Data
+        case 0x00: records.add((uint64_t)base + address, payload, bytes[0], number); break;
+        // End of file
+        case 0x01: end = true; break;
+        // Extended segment & linear address
+        case 0x02: base = ((payload[0] << 8) | payload[1]) << 4; break;
+        case 0x04: base = ((payload[0] << 8) | payload[1]) << 16; break;
+        // Start segment (CS:IP) & linear address
+        case 0x03: entry = (((payload[0] << 8) | payload[1]) << 4) + ((payload[2] << 8) | payload[3]); break;
+        case 0x05: entry = (int32_t)(((uint32_t)payload[0] << 24) | (payload[1] << 16) | (payload[2] << 8) | payload[3]); break;
+        default:
+          throw std::runtime_error(fmt::format("Unknown record type {:02X} on line {}", bytes[3], number));
+      }
+    });
+
+    return records.image((entry >= 0 && entry <= 0xFFFF) ? entry : -1);
+  }
+
+  // S<type><count><address><data><checksum>, the checksum is the ones'
+  // complement of the sum of the other bytes
+  PROCESSOR_INLINE Loader::IMAGE Loader::decodeSRecord(std::span<const uint8_t> data)
+  {
+    RECORDS records;
+    int32_t entry = -1;
+
+    forEachLine(data, [&](std::span<const uint8_t> line, size_t number) {
+      if (line.size() < 2 || line[0] != 'S' || !std::isdigit(line[1]))
+      {
+        throw std::runtime_error(fmt::format("Line {} is not an S-record", number));
+      }
+
+      std::vector<uint8_t> bytes = hexBytes(line.subspan(2), number);
+      if (bytes.empty() || bytes.size() != (size_t)bytes[0] + 1)
+      {
+        throw std::runtime_error(fmt::format("Invalid length on line {}", number));
+      }
+      uint8_t sum = 0;
+      for (size_t i = 0; i < bytes.size() - 1; i++)
+      {
+        sum += bytes[i];
+      }
+      if ((uint8_t)~sum != bytes.back())
+      {
+        throw std::runtime_error(fmt::format("Invalid checksum on line {}", number));
+      }
+
+      uint8_t type = line[1] - '0';
+      // Bytes of the address of each type of record
+      static constexpr uint8_t ADDRESS_SIZE[] = { 2, 2, 3, 4, 0, 2, 3, 4, 3, 2 };
+      size_t addressSize = ADDRESS_SIZE[type];
+      if (type == 4 || bytes.size() < addressSize + 2)
+      {
+        throw std::runtime_error(fmt::format("Invalid record on line {}", number));
+      }
+
+      uint32_t address = 0;
+      for (size_t i = 0; i < addressSize; i++)
+      {
+        address = (address << 8) | bytes[1 + i];
+      }
+      const uint8_t* payload = bytes.data() + 1 + addressSize;
+      size_t payloadSize = bytes.size() - 2 - addressSize;
+
+      switch (type)
+      {
+        // Data
+        case 1: case 2: case 3: records.add(address, payload, payloadSize, number); break;
+        // Start address
+        case 7: case 8: case 9: entry = (address <= 0xFFFF) ? (int32_t)address : -1; break;
+        // Header & record counts
+        default: break;
+      }
+    });
+
+    return records.image(entry);
+  }
+}
@@ -0,0 +1 @@
+#include "Loader-inl.hpp"
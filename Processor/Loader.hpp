@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Common.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CPU
+{
+  // Reads program images into the segments of memory they fill. Raw & PRG
+  // files are mapped into memory and read in place, Intel HEX & S-record
+  // files are decoded once. Placing an image (see Processor::LoadImage())
+  // is a copy per segment, so reloading it between runs costs no more than
+  // copying its bytes.
+  class Loader
+  {
+  public:
+    enum FORMAT
+    {
+      // The bytes of the file, placed at the address given to load()
+      RAW = 0,
+      // Commodore program, a little endian load address followed by the bytes
+      PRG = 1,
+      // Intel HEX, data, end of file & start address records
+      INTEL_HEX = 2,
+      // Motorola S-records, S1 to S3 data & S7 to S9 start address records
+      SRECORD = 3,
+    };
+
+    struct SEGMENT
+    {
+      // Where the first byte goes
+      uint16_t address = 0x0000;
+      std::span<const uint8_t> bytes;
+    };
+
+    struct IMAGE
+    {
+      std::vector<SEGMENT> segments;
+      // The start address given by the image, -1 if none
+      int32_t entry = -1;
+      // Holds the memory of the segments, the mapped file or the decoded
+      // bytes. Copies of an image share it
+      std::shared_ptr<const void> storage;
+    };
+
+    // Throws std::runtime_error when the file can not be read or decoded.
+    // The address is only used by raw images
+    static IMAGE load(const std::string& path, FORMAT format, uint16_t address = 0x0000);
+    // As load(), the format is told by the extension of the file
+    static IMAGE load(const std::string& path, uint16_t address = 0x0000);
+    // Raw & PRG images point into the data, it must outlive them
+    static IMAGE decode(std::span<const uint8_t> data, FORMAT format, uint16_t address = 0x0000);
+    // .prg, .hex & .ihx, .s19, .s28, .s37, .srec & .mot, or else raw
+    static FORMAT detect(const std::string& path);
+
+  private:
+    // The data records of a text format, decoded into one buffer
+    struct RECORDS;
+
+    static IMAGE decodeIntelHex(std::span<const uint8_t> data);
+    static IMAGE decodeSRecord(std::span<const uint8_t> data);
+    // The bytes of the hex digits of a record
+    static std::vector<uint8_t> hexBytes(std::span<const uint8_t> digits, size_t line);
+    // Calls visit(line, number) for every line that is not blank, without
+    // its line break & surrounding spaces
+    template <typename VISITOR>
+    static void forEachLine(std::span<const uint8_t> data, VISITOR&& visit);
+  };
+}
+
+#ifdef HEADER_ONLY
+#include "Loader-inl.hpp"
+#endif
@@ -1,12 +1,13 @@
 #pragma once
 
+#include "Common.hpp"
 #include "Formatters.hpp"
 #include <spdlog/spdlog.h>
 #include <spdlog/pattern_formatter.h>
 
 namespace CPU
 {
-  static std::shared_ptr<spdlog::logger> logger = nullptr;
+  inline std::shared_ptr<spdlog::logger> logger = nullptr;
   class Logger
   {
   public:
@@ -52,3 +53,12 @@ namespace CPU
     }
   };
 };
+
+#ifdef HEADER_ONLY
+// Every class of the processor is declared by now (Formatters.hpp includes
+// them), so the implementation of all of them is included from here
+#include "Logger-inl.hpp"
+#include "Bus-inl.hpp"
+#include "Executioner-inl.hpp"
+#include "Processor-inl.hpp"
+#endif
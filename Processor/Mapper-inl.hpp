@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Mapper.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+#ifdef SPDLOG_FMT_EXTERNAL
+#include <fmt/format.h>
+#else
+#include <spdlog/fmt/fmt.h>
+#endif
+
+namespace CPU
+{
+#pragma region BANKED MEMORY
+  PROCESSOR_INLINE BankedMemory::BankedMemory(size_t bankSize, const uint8_t* image, size_t imageSize)
+    : BankedMemory(bankSize, std::max<size_t>((imageSize + bankSize - 1) / std::max<size_t>(bankSize, 1), 1))
+  {
+    this->image = image;
+    this->imageSize = imageSize;
+  }
+
+  PROCESSOR_INLINE BankedMemory::BankedMemory(size_t bankSize, const std::string& path)
+    : BankedMemory(bankSize, (size_t)1)
+  {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+      throw std::runtime_error(fmt::format("Unable to open {}", path));
+    }
+
+    this->path = path;
+    imageSize = (size_t)file.tellg();
+    banks.resize(std::max<size_t>((imageSize + bankSize - 1) / bankSize, 1));
+  }
+
+  PROCESSOR_INLINE BankedMemory::BankedMemory(size_t bankSize, size_t bankCount)
+    : bankSize(bankSize), banks(bankCount)
+  {
+    // A bank is switched in page by page
+    if (bankSize == 0 || (bankSize & 0xFF) != 0 || bankSize > 64 * 1024)
+    {
+      throw std::invalid_argument(fmt::format("Invalid bank size ({})", bankSize));
+    }
+    if (bankCount == 0)
+    {
+      throw std::invalid_argument("Banked memory needs at least one bank");
+    }
+  }
+
+  PROCESSOR_INLINE uint8_t* BankedMemory::bank(size_t index)
+  {
+    std::unique_ptr<uint8_t[]>& slot = banks[index % banks.size()];
+    if (slot != nullptr)
+    {
+      return slot.get();
+    }
+
+    // Only kept once it is filled, a bank that failed to read is read again
+    // the next time it is used
+    std::unique_ptr<uint8_t[]> memory = std::make_unique<uint8_t[]>(bankSize);
+    size_t offset = (index % banks.size()) * bankSize;
+    size_t size = (offset < imageSize) ? std::min(bankSize, imageSize - offset) : 0;
+    if (size > 0 && image != nullptr)
+    {
+      std::memcpy(memory.get(), image + offset, size);
+    }
+    else if (size > 0)
+    {
+      std::ifstream file(path, std::ios::binary);
+      file.seekg((std::streamoff)offset);
+      file.read(reinterpret_cast<char*>(memory.get()), (std::streamsize)size);
+      if (file.fail() || file.gcount() != (std::streamsize)size)
+      {
+        throw std::runtime_error(fmt::format("Unable to read bank {} of {}", index % banks.size(), path));
+      }
+    }
+
+    slot = std::move(memory);
+    allocated++;
+    return slot.get();
+  }
+#pragma endregion BANKED MEMORY
+
+#pragma region MAPPERS
+  PROCESSOR_INLINE Mapper::Mapper(Bus& bus, BankedMemory& memory)
+    : bus(bus), memory(memory)
+  {
+  }
+
+  PROCESSOR_INLINE Mapper::~Mapper()
+  {
+    for (const auto& [page, mapping] : replaced)
+    {
+      if (bus.getMapping(page).handler == this)
+      {
+        bus.restoreMapping(page, mapping);
+      }
+    }
+  }
+
+  PROCESSOR_INLINE void Mapper::select(uint16_t offset, size_t bank)
+  {
+    for (uint16_t page = offset >> 8; page <= ((offset + memory.getBankSize() - 1) >> 8); page++)
+    {
+      if (bus.getMapping((uint8_t)page).handler != this)
+      {
+        replaced[(uint8_t)page] = bus.getMapping((uint8_t)page);
+      }
+    }
+    bus.mapBank(offset, (uint16_t)(offset + memory.getBankSize() - 1), memory.bank(bank), this);
+  }
+
+  PROCESSOR_INLINE Switch16K::Switch16K(Bus& bus, BankedMemory& memory)
+    : Mapper(bus, memory)
+  {
+    if (memory.getBankSize() != 16 * 1024)
+    {
+      throw std::invalid_argument("Switch16K needs banks of 16 KB");
+    }
+    select(0x8000, 0);
+    select(0xC000, memory.getBankCount() - 1);
+  }
+
+  PROCESSOR_INLINE void Switch16K::write(uint16_t /*addr*/, uint8_t data)
+  {
+    select(0x8000, data);
+  }
+
+  PROCESSOR_INLINE Switch32K::Switch32K(Bus& bus, BankedMemory& memory)
+    : Mapper(bus, memory)
+  {
+    if (memory.getBankSize() != 32 * 1024)
+    {
+      throw std::invalid_argument("Switch32K needs banks of 32 KB");
+    }
+    select(0x8000, 0);
+  }
+
+  PROCESSOR_INLINE void Switch32K::write(uint16_t /*addr*/, uint8_t data)
+  {
+    select(0x8000, data);
+  }
+#pragma endregion MAPPERS
+}
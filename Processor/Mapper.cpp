@@ -0,0 +1 @@
+#include "Mapper-inl.hpp"
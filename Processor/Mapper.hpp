@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Common.hpp"
+#include "Bus.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CPU
+{
+  // Memory larger than the address space (e.g. the ROM of a cartridge),
+  // split into banks of the same size. A bank is allocated and filled from
+  // its image the first time it is used, so a program only costs the banks
+  // it switches in, whatever the size of the image. The bytes past the end
+  // of the image are 0x00.
+  class BankedMemory
+  {
+  public:
+    // Copies the image bank by bank, it must outlive the memory
+    BankedMemory(size_t bankSize, const uint8_t* image, size_t imageSize);
+    // Reads the banks from the file
+    BankedMemory(size_t bankSize, const std::string& path);
+    // Empty banks, e.g. for banked RAM
+    BankedMemory(size_t bankSize, size_t bankCount);
+
+    BankedMemory(const BankedMemory&) = delete;
+    BankedMemory& operator=(const BankedMemory&) = delete;
+
+    // The memory of the bank. The number wraps around the number of banks,
+    // as the bits of a bank register that no bank uses
+    uint8_t* bank(size_t index);
+
+    size_t getBankSize() { return bankSize; }
+    size_t getBankCount() { return banks.size(); }
+    // Number of banks used so far
+    size_t getAllocated() { return allocated; }
+
+  private:
+    size_t bankSize;
+    size_t allocated = 0;
+    std::vector<std::unique_ptr<uint8_t[]>> banks;
+
+    // Where the banks are filled from, the memory or the file of the image
+    const uint8_t* image = nullptr;
+    size_t         imageSize = 0;
+    std::string    path;
+  };
+
+  // Switches the banks of a BankedMemory into windows of the address space.
+  // A switch points the pages of the window to the bank (see
+  // Bus::mapBank()), so nothing is copied and reads of the window go
+  // straight to the bank. The writes to the windows go to the mapper, they
+  // are its registers. The bus & the memory must outlive the mapper, which
+  // puts back the mapping the pages of its windows had when it is destroyed
+  // (the pages mapped to something else since are left as they are). The
+  // bus points to the mapper, so it can't be copied or moved.
+  class Mapper : public PageHandler
+  {
+  public:
+    Mapper(Bus& bus, BankedMemory& memory);
+    ~Mapper() override;
+
+    Mapper(const Mapper&) = delete;
+    Mapper& operator=(const Mapper&) = delete;
+
+    // Reads of the windows never get here
+    uint8_t read(uint16_t /*addr*/, bool /*bReadOnly*/) override { return 0x00; }
+
+  protected:
+    // Switches the bank into the window starting at offset, the window is
+    // the size of a bank
+    void select(uint16_t offset, size_t bank);
+
+    Bus&          bus;
+    BankedMemory& memory;
+
+  private:
+    // The mapping of the pages before they were first switched
+    std::map<uint8_t, Bus::MAPPING> replaced;
+  };
+
+  // 16 KB banks. The bank written to 0x8000-0xFFFF is switched into
+  // 0x8000-0xBFFF, 0xC000-0xFFFF holds the last bank (as UxROM of the NES)
+  class Switch16K : public Mapper
+  {
+  public:
+    Switch16K(Bus& bus, BankedMemory& memory);
+
+    void write(uint16_t addr, uint8_t data) override;
+  };
+
+  // 32 KB banks. The bank written to 0x8000-0xFFFF is switched into
+  // 0x8000-0xFFFF, so every bank holds the vectors (as AxROM of the NES)
+  class Switch32K : public Mapper
+  {
+  public:
+    Switch32K(Bus& bus, BankedMemory& memory);
+
+    void write(uint16_t addr, uint8_t data) override;
+  };
+}
+
+#ifdef HEADER_ONLY
+#include "Mapper-inl.hpp"
+#endif
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Processor.hpp"
+#include "Processor-inl.hpp"
+#include "Executioner-inl.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace CPU
+{
+  // A compile time description of the address space, for buses where the
+  // layout of the memory is known when the emulator is built. Every region
+  // covers FIRST to LAST (inclusive):
+  //
+  //   RAM<FIRST, LAST>  is read & written
+  //   ROM<FIRST, LAST>  is read, writes are ignored (load it with LoadProgram())
+  //
+  // and addresses outside of every region read as 0x00. The checks are
+  // constant expressions folded into the accesses, so a map that is RAM from
+  // 0x0000 to 0xFFFF compiles down to indexing the memory array, e.g.
+  //
+  //   MappedBus<MemoryMap<RAM<0x0000, 0xFFFF>>> bus;
+  //   MappedBus<MemoryMap<RAM<0x0000, 0x7FFF>, ROM<0xC000, 0xFFFF>>> bus;
+  template <uint16_t FIRST, uint16_t LAST, bool WRITABLE>
+  struct MemoryRegion
+  {
+    static_assert(FIRST <= LAST, "A region must start before it ends");
+
+    static constexpr uint16_t first = FIRST;
+    static constexpr uint16_t last = LAST;
+
+    static constexpr bool contains(uint16_t addr) { return addr >= FIRST && addr <= LAST; }
+    static constexpr bool isWritable(uint16_t addr) { return WRITABLE && contains(addr); }
+  };
+
+  template <uint16_t FIRST, uint16_t LAST>
+  struct RAM : public MemoryRegion<FIRST, LAST, true> {};
+
+  template <uint16_t FIRST, uint16_t LAST>
+  struct ROM : public MemoryRegion<FIRST, LAST, false> {};
+
+  // True if no address is in two of the regions
+  template <typename... REGIONS>
+  constexpr bool areDisjoint()
+  {
+    std::array<uint16_t, sizeof...(REGIONS)> first = { REGIONS::first... };
+    std::array<uint16_t, sizeof...(REGIONS)> last = { REGIONS::last... };
+    for (size_t i = 0; i < first.size(); i++)
+    {
+      for (size_t j = i + 1; j < first.size(); j++)
+      {
+        if (first[i] <= last[j] && first[j] <= last[i])
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  template <typename... REGIONS>
+  struct MemoryMap
+  {
+    static constexpr bool isMapped(uint16_t addr) { return (REGIONS::contains(addr) || ...); }
+    static constexpr bool isWritable(uint16_t addr) { return (REGIONS::isWritable(addr) || ...); }
+
+    static_assert(sizeof...(REGIONS) > 0, "A memory map needs at least one region");
+    static_assert(areDisjoint<REGIONS...>(), "The regions of a memory map must not overlap");
+  };
+
+  // A bus laid out by a MemoryMap, with nothing else on it. The regions are
+  // backed by one array indexed by the address, which LoadProgram() writes
+  // directly (ROM included). Nothing but the processor changes the memory,
+  // so no address is volatile (see Bus::setVolatile()).
+  template <typename MAP>
+  class MappedBus
+  {
+  public:
+    MappedBus(ExecutionerBase::VARIANT variant = ExecutionerBase::DEFAULT_VARIANT)
+      : cpu(variant)
+    {
+      // Connect CPU to communication bus
+      cpu.ConnectBus(this);
+      reset();
+    }
+
+  public: // Devices on bus
+    BasicProcessor<MappedBus> cpu;
+
+    std::array<uint8_t, 64 * 1024> ram;
+
+  public: // Bus Read & Write
+    void reset()
+    {
+      ram.fill(0x00);
+      cpu.executioner.cache.clear();
+    }
+
+    void load(uint16_t address, std::span<const uint8_t> bytes)
+    {
+      size_t first = std::min(bytes.size(), ram.size() - address);
+      std::copy_n(bytes.begin(), first, ram.begin() + address);
+      std::copy(bytes.begin() + first, bytes.end(), ram.begin());
+      cpu.executioner.cache.clear();
+    }
+
+    void write(uint16_t addr, uint8_t data)
+    {
+      if (MAP::isWritable(addr))
+      {
+        ram[addr] = data;
+        cpu.executioner.cache.invalidate(addr);
+      }
+    }
+
+    uint8_t read(uint16_t addr, bool /*bReadOnly*/ = false)
+    {
+      return MAP::isMapped(addr) ? ram[addr] : 0x00;
+    }
+
+    bool isVolatile(uint16_t /*addr*/) { return false; }
+
+  public: // DEBUG
+    // Memory is only logged from Bus
+    void dump(uint16_t /*offsetStart*/) {}
+    void dump(uint16_t /*offsetStart*/, uint16_t /*offsetStop*/) {}
+  };
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+
+namespace CPU
+{
+  // Counts how often every sequence of two and three opcodes is executed, to
+  // find the sequences worth running as superinstructions (see the
+  // superinstructions table in Instructions.hpp).
+  //
+  // Executioner::execute() records every opcode while the profile is
+  // enabled, which makes run() use the TABLE engine. The counts are only
+  // allocated once the profile is enabled.
+  class OpcodeProfile
+  {
+  public:
+    // A sequence of opcodes and the number of times it was executed
+    struct NGRAM
+    {
+      std::vector<uint8_t> opcodes;
+      uint64_t             count = 0;
+    };
+
+    void setEnabled(bool enable)
+    {
+      enabled = enable;
+      if (enabled && pairs == nullptr)
+      {
+        pairs = std::make_unique<Pairs>();
+      }
+      length = 0;
+    }
+    bool isEnabled() { return enabled; }
+
+    void record(uint8_t opcode)
+    {
+      if (length >= 1)
+      {
+        (*pairs)[(previous[1] << 8) | opcode]++;
+      }
+      if (length >= 2)
+      {
+        triples[(previous[0] << 16) | (previous[1] << 8) | opcode]++;
+      }
+
+      previous[0] = previous[1];
+      previous[1] = opcode;
+      length = std::min(length + 1, 2);
+    }
+
+    // Number of times the opcodes were executed one after another
+    uint64_t getCount(uint8_t first, uint8_t second)
+    {
+      return (pairs == nullptr) ? 0 : (*pairs)[(first << 8) | second];
+    }
+    uint64_t getCount(uint8_t first, uint8_t second, uint8_t third)
+    {
+      auto it = triples.find((first << 16) | (second << 8) | third);
+      return (it == triples.end()) ? 0 : it->second;
+    }
+
+    // The most frequent sequences of two or three opcodes, most frequent first
+    std::vector<NGRAM> getMostFrequent(size_t n, uint8_t size = 2)
+    {
+      std::vector<NGRAM> result;
+      if (size == 2 && pairs != nullptr)
+      {
+        for (uint32_t i = 0; i < pairs->size(); i++)
+        {
+          if ((*pairs)[i] > 0)
+          {
+            result.push_back({ { (uint8_t)(i >> 8), (uint8_t)i }, (*pairs)[i] });
+          }
+        }
+      }
+      else if (size == 3)
+      {
+        for (auto& [key, count] : triples)
+        {
+          result.push_back({ { (uint8_t)(key >> 16), (uint8_t)(key >> 8), (uint8_t)key }, count });
+        }
+      }
+
+      std::sort(result.begin(), result.end(), [](const NGRAM& a, const NGRAM& b) {
+        return (a.count != b.count) ? a.count > b.count : a.opcodes < b.opcodes;
+      });
+      if (result.size() > n)
+      {
+        result.resize(n);
+      }
+      return result;
+    }
+
+    void clear()
+    {
+      if (pairs != nullptr)
+      {
+        pairs->fill(0);
+      }
+      triples.clear();
+      length = 0;
+    }
+
+  private:
+    typedef std::array<uint64_t, 256 * 256> Pairs;
+
+    bool                                   enabled = false;
+    std::unique_ptr<Pairs>                 pairs;
+    std::unordered_map<uint32_t, uint64_t> triples;
+
+    // The last two opcodes recorded
+    uint8_t previous[2] = { 0x00, 0x00 };
+    int     length = 0;
+  };
+}
@@ -0,0 +1,1272 @@
+#pragma once
+
+#include "Processor.hpp"
+//#include "Instructions.hpp"
+#include "Types.hpp"
+#include "Executioner.hpp"
+#include "Logger.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <sstream>
+#include <spdlog/spdlog.h>
+#ifdef SPDLOG_FMT_EXTERNAL
+#include <fmt/format.h>
+#else
+#include <spdlog/fmt/fmt.h>
+#endif
+
+namespace CPU
+{
+
+  // Constructor
+  template <typename BusT>
+  BasicProcessor<BusT>::BasicProcessor(ExecutionerBase::VARIANT variant)
+    : executioner(variant)
+  {
+    // Assembles the translation table.
+    // The table is one big initialiser list of initialiser lists...
+    executioner.ConnectCpu(this);
+  }
+
+  template <typename BusT>
+  BasicProcessor<BusT>::~BasicProcessor()
+  {
+    // Destructor - has nothing to do
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::LoadProgram(uint16_t offset, std::string program)
+  {
+    std::vector<uint8_t> converted;
+
+    Logger::log()->info("** Loading Program: {}", program);
+
+    std::stringstream ss;
+    ss << program;
+    std::string b;
+    while (ss >> b)
+    {
+      converted.push_back((uint8_t)std::stoul(b, nullptr, 16));
+    }
+    LoadProgram(offset, converted.data(), converted.size());
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::LoadProgram(uint16_t offset, std::string program, uint16_t initialProgramCounter)
+  {
+    LoadProgram(offset, program);
+
+    setProgramCounter(initialProgramCounter);
+
+    uint8_t lo = initialProgramCounter & 0xFF;
+    uint8_t hi = (initialProgramCounter >> 8) & 0xFF;
+
+    writeMemoryWithoutCycle(0xFFFC, lo);
+    writeMemoryWithoutCycle(0xFFFD, hi);
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::LoadProgram(uint16_t offset, uint8_t program[], size_t programSize)
+  {
+    size_t ramSize = bus->ram.size();
+
+    if (offset > ramSize)
+    {
+      throw std::runtime_error(fmt::format(
+        "Offset '{:04X}' is larger than memory size '{:d}'",
+        offset, ramSize
+      ));
+    }
+
+    if (programSize > ramSize)
+    {
+      throw std::runtime_error(fmt::format(
+        "Program size is {:d} bytes, that cannot be larger than memory size {:d} bytes",
+        programSize, ramSize
+      ));
+    }
+
+    bus->reset();
+    bus->load(offset, std::span<const uint8_t>(program, programSize));
+    reset();
+    reg.SP = 0xFF;
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::LoadImage(const Loader::IMAGE& image, bool clearMemory)
+  {
+    if (clearMemory)
+    {
+      bus->reset();
+    }
+    for (const Loader::SEGMENT& segment : image.segments)
+    {
+      bus->load(segment.address, segment.bytes);
+    }
+    reset();
+    reg.SP = 0xFF;
+
+    if (image.entry >= 0)
+    {
+      setProgramCounter((uint16_t)image.entry);
+    }
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::LoadProgram(uint16_t offset, uint8_t program[], size_t programSize, uint16_t initialProgramCounter)
+  {
+    LoadProgram(offset, program, programSize);
+
+    setProgramCounter(initialProgramCounter);
+    uint8_t lo = initialProgramCounter & 0xFF;
+    uint8_t hi = (initialProgramCounter >> 8) & 0xFF;
+
+    writeMemoryWithoutCycle(0xFFFC, lo);
+    writeMemoryWithoutCycle(0xFFFD, hi);
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region BUS CONNECTIVITY
+// BUS CONNECTIVITY
+
+// Dump 16 bytes of RAM 0x???0 -> 0x???F to logfile
+  template <typename BusT>
+  void BasicProcessor<BusT>::dumpRam(uint16_t offset)
+  {
+    if (bus != nullptr)
+    {
+      bus->dump(offset);
+    }
+  }
+  // Dump RAM from start offset to end offset to logfile
+  template <typename BusT>
+  void BasicProcessor<BusT>::dumpRam(uint16_t offsetStart, uint16_t offsetStop)
+  {
+    if (bus != nullptr)
+    {
+      bus->dump(offsetStart, offsetStop);
+    }
+  }
+
+
+  // readMemory() & writeMemory() are defined in Processor.hpp
+#pragma endregion BUS CONNECTIVITY
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region EXTERNAL INPUTS
+// EXTERNAL INPUTS
+
+  // Forces the 6502 into a known state. This is hard-wired inside the CPU. The
+  // registers are set to 0x00, the status register is cleared except for unused
+  // bit which remains at 1. An absolute address is read from location 0xFFFC
+  // which contains a second address that the program counter is set to. This 
+  // allows the programmer to jump to a known and programmable location in the
+  // memory to start executing from. Typically the programmer would set the value
+  // at location 0xFFFC at compile time.
+  template <typename BusT>
+  void BasicProcessor<BusT>::reset()
+  {
+    //UpdateMemoryMap();
+
+    // Reset internal registers
+    reg.reset();
+    loadFlags();
+
+    executioner.reset();
+
+    // Reset takes time
+    clearState();
+    total_cycles = 0;
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::restore(const REGISTER& registers, uint64_t cycles)
+  {
+    reg = registers;
+    loadFlags();
+
+    clearState();
+    total_cycles = cycles;
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::restoreDefaults()
+  {
+    timing = CYCLE_ACCURATE;
+    setIdleDetection(false);
+    nextEvent = UINT64_MAX;
+    idleCycles = 0;
+    setIrqLine(false);
+    TriggerNmi = false;
+
+    executioner.restoreDefaults();
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::clearState()
+  {
+    extra_cycles = 0;
+    cycle_count = 0;
+    clock_count = 0;
+    fault = NONE;
+
+    idleLoop = {};
+    idleAddress = -1;
+
+    _previousInterrupt = false;
+    TriggerNmi = false;
+    TriggerIRQ = irqLine;
+  }
+
+  // Interrupt requests are a complex operation and only happen if the
+  // "disable interrupt" flag is 0. IRQs can happen at any time, but
+  // you dont want them to be destructive to the operation of the running 
+  // program. Therefore the current instruction is allowed to finish
+  // (which I facilitate by doing the whole thing when cycles == 0) and 
+  // then the current program counter is stored on the stack. Then the
+  // current status register is stored on the stack. When the routine
+  // that services the interrupt has finished, the status register
+  // and program counter can be restored to how they where before it 
+  // occurred. This is impemented by the "RTI" instruction. Once the IRQ
+  // has happened, in a similar way to a reset, a programmable address
+  // is read form hard coded location 0xFFFE, which is subsequently
+  // set to the program counter.
+  template <typename BusT>
+  void BasicProcessor<BusT>::irq()
+  {
+    // If interrupts aren't allowed
+    if (GetFlag(I) != 0)
+    {
+      return;
+    }
+
+    //pc--;
+    decrementProgramCounter();
+    executioner.breakOperation(false, 0xFFFE);
+    //opcode = readMemory(pc);
+    opcode = readMemory(getProgramCounter());
+  }
+
+  // A Non-Maskable Interrupt cannot be ignored. It behaves in exactly the
+  // same way as a regular IRQ, but reads the new program counter address
+  // form location 0xFFFA.
+  template <typename BusT>
+  void BasicProcessor<BusT>::nmi()
+  {
+    //pc--;
+    decrementProgramCounter();
+    executioner.breakOperation(false, 0xFFFA);
+    opcode = readMemory(getProgramCounter());
+  }
+
+  // Perform one clock cycles worth of emulation
+  template <typename BusT>
+  ProcessorBase::FAULT6502 BasicProcessor<BusT>::tick()
+  {
+    executioner.run(1);
+    return getFault();
+  }
+
+  template <typename BusT>
+  ProcessorBase::RUNRESULT BasicProcessor<BusT>::run(uint64_t cycles)
+  {
+    return batch(UINT64_MAX, cycles);
+  }
+
+  template <typename BusT>
+  ProcessorBase::RUNRESULT BasicProcessor<BusT>::runInstructions(uint32_t instructions)
+  {
+    return batch(instructions, UINT64_MAX);
+  }
+
+  template <typename BusT>
+  ProcessorBase::RUNRESULT BasicProcessor<BusT>::runUntil(uint16_t address, uint64_t cycles)
+  {
+    stopAddress = address;
+    return batch(UINT64_MAX, cycles);
+  }
+
+  template <typename BusT>
+  ProcessorBase::RUNRESULT BasicProcessor<BusT>::runUntil(PREDICATE6502 predicate, uint64_t cycles)
+  {
+    stopPredicate = std::move(predicate);
+    return batch(UINT64_MAX, cycles);
+  }
+
+  // Runs instructions in one loop of the dispatch engine, until the budget is
+  // used up or startInstruction() finds a stop condition
+  template <typename BusT>
+  ProcessorBase::RUNRESULT BasicProcessor<BusT>::batch(uint64_t instructions, uint64_t cycles)
+  {
+    RUNRESULT result;
+    uint64_t startCycles = total_cycles;
+
+    stopCycles = (cycles > UINT64_MAX - startCycles) ? UINT64_MAX : startCycles + cycles;
+    stopReason = INSTRUCTIONS;
+    batching = true;
+    while (stopReason == INSTRUCTIONS && fault == NONE && result.instructions < instructions)
+    {
+      uint32_t chunk = (uint32_t) std::min<uint64_t>(instructions - result.instructions, UINT32_MAX);
+      result.instructions += executioner.run(chunk);
+
+      if (idleAddress != -1 && reg.PC == idleAddress)
+      {
+        result.instructions += skipIdleLoop(instructions - result.instructions);
+      }
+    }
+    batching = false;
+    idleLoop.head = -1;
+    idleAddress = -1;
+
+    result.reason = (fault != NONE) ? FAULT : stopReason;
+    result.cycles = total_cycles - startCycles;
+
+    stopCycles = UINT64_MAX;
+    stopAddress = -1;
+    stopPredicate = nullptr;
+    return result;
+  }
+
+  // Begins the next instruction
+  template <typename BusT>
+  bool BasicProcessor<BusT>::startInstruction()
+  {
+    if (bus == nullptr)
+    {
+      fault = UNCONNECTED_BUS;
+    }
+
+    if (fault != NONE)
+    {
+#ifdef LOGMODE
+      Logger::log()->error("FAULT {}", (int) fault);
+#endif
+      return false;
+    }
+
+    if (total_cycles >= stopCycles)
+    {
+      stopReason = CYCLES;
+      return false;
+    }
+
+    if (reg.PC == stopAddress)
+    {
+      stopReason = ADDRESS;
+      return false;
+    }
+
+    if (stopPredicate)
+    {
+      // The predicate sees, and may change, the whole status register
+      syncFlags();
+      bool stop = stopPredicate(*this);
+      loadFlags();
+      if (stop)
+      {
+        stopReason = PREDICATE;
+        return false;
+      }
+    }
+
+    if (reg.PC == idleAddress)
+    {
+      // The idle loop is skipped by batch()
+      return false;
+    }
+
+    // This is per operation
+    extra_cycles = 0;
+    functional = timing == FUNCTIONAL;
+
+    // Read next instruction byte. This 8-bit value is used to index
+    // the translation table to get the relevant information about
+    // how to implement the instruction
+
+    opcode = executioner.cache.isEnabled() ? executioner.fetchOpcode(reg.PC) : readMemory(reg.PC);
+//    Logger::log()->info("Processor::tick() PC: 0x{:04X} - OP: 0x{:02X}", reg.PC, opcode);
+
+    //UpdateMemoryMap();
+#ifdef LOGMODE
+    disassemble(reg.PC);
+    Logger::log()->info(
+      "{:>10d}:{:02X} OP: 0x{:02X} / {}:{} {: <17s} {}",
+      clock_count, cycle_count, opcode, executioner.getInstructionName(opcode), executioner.getAddressModeName(opcode),
+      "XXX", reg
+    );
+#endif
+
+    // Always set the unused status flag bit to 1
+    SetFlag(U, true);
+
+    // Increment program counter, we read the opcode byte
+    incrementProgramCounter();
+    return true;
+  }
+
+  // Completes the current instruction
+  template <typename BusT>
+  void BasicProcessor<BusT>::finishInstruction()
+  {
+    // Always set the unused status flag bit to 1
+    SetFlag(U, true);
+
+
+    // Increment global clock count - This is actually unused unless logging is enabled
+    // but I've kept it in because its a handy watch variable for debugging
+    clock_count++;
+
+    if (functional)
+    {
+      uint8_t cycles = executioner.getInstructionCycles(opcode, extra_cycles);
+
+      // Interrupts are only checked between instructions
+      _interrupt = TriggerNmi || (TriggerIRQ && GetFlag(I) == 0);
+      _previousInterrupt = _interrupt;
+      if (_previousInterrupt)
+      {
+        cycles += INTERRUPT_CYCLES;
+      }
+      cycle_count += cycles;
+      total_cycles += cycles;
+    }
+
+#ifdef LOGMODE
+    // This logger dumps every cycle the entire processor state for analysis.
+    // This can be used for debugging the emulation, but has little utility
+    // during emulation. Its also very slow, so only use if you have to.
+    Logger::log()->info(
+      "{:>10d}:{:02X} OP: 0x{:02X} / {}:{} {: <17s} {}",
+      clock_count, cycle_count, opcode, executioner.getInstructionName(opcode), executioner.getAddressModeName(opcode),
+      "XXX", reg
+    );
+#endif
+
+    if (_previousInterrupt)
+    {
+      if (TriggerNmi)
+      {
+        nmi();
+        TriggerNmi = false;
+      }
+      else if (TriggerIRQ)
+      {
+        irq();
+        TriggerIRQ = irqLine;
+      }
+    }
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::setJammed()
+  {
+    fault = JAMMED;
+  }
+#pragma endregion EXTERNAL INPUTS
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region IDLE LOOPS
+// IDLE LOOPS
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::setIdleDetection(bool enable)
+  {
+    idleDetection = enable;
+    idleLoop.head = -1;
+    idleAddress = -1;
+  }
+
+  // A loop is idle once two jumps back in a row find the same registers, with
+  // nothing but the loop itself run in between. As the loop neither writes
+  // nor reads anything that can change, every further iteration is the same
+  // until an interrupt arrives.
+  template <typename BusT>
+  void BasicProcessor<BusT>::loopBack(uint16_t head, uint16_t end)
+  {
+    if (!batching || stopPredicate)
+    {
+      return;
+    }
+    syncFlags();
+
+    bool repeated = idleLoop.head == head && idleLoop.end == end &&
+      idleLoop.registers.AC == reg.AC && idleLoop.registers.X == reg.X &&
+      idleLoop.registers.Y == reg.Y && idleLoop.registers.SP == reg.SP &&
+      idleLoop.registers.SR == reg.SR;
+
+    if (repeated && !TriggerNmi && !TriggerIRQ)
+    {
+      // An interrupt serviced in between shows up as extra instructions
+      uint32_t instructions = clock_count - idleLoop.instructions;
+      if (instructions > 0 && instructions == countIdleInstructions(head, end))
+      {
+        idleLoop.iterationCycles = total_cycles - idleLoop.cycles;
+        idleLoop.iterationInstructions = instructions;
+        idleAddress = head;
+      }
+    }
+
+    idleLoop.head = head;
+    idleLoop.end = end;
+    idleLoop.registers = reg;
+    idleLoop.cycles = total_cycles;
+    idleLoop.instructions = clock_count;
+  }
+
+  template <typename BusT>
+  uint32_t BasicProcessor<BusT>::countIdleInstructions(uint16_t head, uint16_t end)
+  {
+    // Only short polling loops are considered
+    const uint32_t MAX_INSTRUCTIONS = 16;
+
+    uint32_t count = 0;
+    uint32_t addr = head;
+    while (addr < end && count < MAX_INSTRUCTIONS)
+    {
+      uint8_t op = bus->read(addr, true);
+      ExecutionerBase::Mnemonic mnemonic = executioner.getMnemonic(op);
+      ExecutionerBase::AddressMode mode = executioner.getAddressMode(op);
+      uint32_t next = addr + 1 + executioner.getOperandLength(op);
+      count++;
+
+      if (next == end)
+      {
+        // The jump back
+        bool jump = (mnemonic == ExecutionerBase::Mnemonic::JMP && mode == ExecutionerBase::AddressMode::ABS) ||
+          (executioner.getCyclePolicy(op) & ExecutionerBase::BRANCH) != 0;
+        return jump ? count : 0;
+      }
+
+      switch (mnemonic)
+      {
+        case ExecutionerBase::Mnemonic::LDA:
+        case ExecutionerBase::Mnemonic::LDX:
+        case ExecutionerBase::Mnemonic::LDY:
+        case ExecutionerBase::Mnemonic::CMP:
+        case ExecutionerBase::Mnemonic::CPX:
+        case ExecutionerBase::Mnemonic::CPY:
+        case ExecutionerBase::Mnemonic::BIT:
+        case ExecutionerBase::Mnemonic::AND:
+        case ExecutionerBase::Mnemonic::ORA:
+        case ExecutionerBase::Mnemonic::EOR:
+        case ExecutionerBase::Mnemonic::ADC:
+        case ExecutionerBase::Mnemonic::SBC:
+        case ExecutionerBase::Mnemonic::TAX:
+        case ExecutionerBase::Mnemonic::TAY:
+        case ExecutionerBase::Mnemonic::TXA:
+        case ExecutionerBase::Mnemonic::TYA:
+        case ExecutionerBase::Mnemonic::TSX:
+        case ExecutionerBase::Mnemonic::INX:
+        case ExecutionerBase::Mnemonic::INY:
+        case ExecutionerBase::Mnemonic::DEX:
+        case ExecutionerBase::Mnemonic::DEY:
+        case ExecutionerBase::Mnemonic::CLC:
+        case ExecutionerBase::Mnemonic::SEC:
+        case ExecutionerBase::Mnemonic::CLV:
+        case ExecutionerBase::Mnemonic::CLD:
+        case ExecutionerBase::Mnemonic::SED:
+        case ExecutionerBase::Mnemonic::NOP:
+          break;
+        case ExecutionerBase::Mnemonic::ASL:
+        case ExecutionerBase::Mnemonic::LSR:
+        case ExecutionerBase::Mnemonic::ROL:
+        case ExecutionerBase::Mnemonic::ROR:
+          if (mode != ExecutionerBase::AddressMode::ACC)
+          {
+            return 0;
+          }
+          break;
+        default:
+          return 0;
+      }
+
+      // Indexed reads are not followed
+      switch (mode)
+      {
+        case ExecutionerBase::AddressMode::IMP:
+        case ExecutionerBase::AddressMode::ACC:
+        case ExecutionerBase::AddressMode::IMM:
+          break;
+        case ExecutionerBase::AddressMode::ZP0:
+          if (bus->isVolatile(bus->read(addr + 1, true)))
+          {
+            return 0;
+          }
+          break;
+        case ExecutionerBase::AddressMode::ABS:
+          if (bus->isVolatile(bus->read(addr + 1, true) | (bus->read(addr + 2, true) << 8)))
+          {
+            return 0;
+          }
+          break;
+        default:
+          return 0;
+      }
+      addr = next;
+    }
+    return 0;
+  }
+
+  template <typename BusT>
+  uint64_t BasicProcessor<BusT>::skipIdleLoop(uint64_t instructions)
+  {
+    idleAddress = -1;
+
+    uint64_t iterations = UINT64_MAX;
+    uint64_t limit = std::min(stopCycles, nextEvent);
+    if (limit != UINT64_MAX)
+    {
+      iterations = (limit > total_cycles) ? (limit - total_cycles) / idleLoop.iterationCycles : 0;
+    }
+    if (instructions != UINT64_MAX)
+    {
+      iterations = std::min(iterations, instructions / idleLoop.iterationInstructions);
+    }
+    if (iterations == UINT64_MAX)
+    {
+      // Nothing ends the batch, keep spinning
+      iterations = 0;
+    }
+
+    uint64_t cycles = iterations * idleLoop.iterationCycles;
+    total_cycles += cycles;
+    cycle_count = (cycle_count + cycles) & 0xFF;
+    clock_count += (uint32_t)(iterations * idleLoop.iterationInstructions);
+    idleCycles += cycles;
+
+    // Spins twice before the loop is skipped again
+    idleLoop.head = -1;
+    return iterations * idleLoop.iterationInstructions;
+  }
+#pragma endregion IDLE LOOPS
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region FLAG FUNCTIONS
+// FLAG FUNCTIONS
+
+  // Get status register as string
+  template <typename BusT>
+  std::string BasicProcessor<BusT>::DecodeFlag(uint8_t flag)
+  {
+    return fmt::format("{}{}{}{}{}{}{}{}",
+      ((flag & N) > 0) ? "N" : ".",
+      ((flag & V) > 0) ? "V" : ".",
+      ((flag & U) > 0) ? "U" : ".",
+      ((flag & B) > 0) ? "B" : ".",
+      ((flag & D) > 0) ? "D" : ".",
+      ((flag & I) > 0) ? "I" : ".",
+      ((flag & Z) > 0) ? "Z" : ".",
+      ((flag & C) > 0) ? "C" : "."
+    );
+  }
+  template <typename BusT>
+  uint8_t BasicProcessor<BusT>::DecodeFlag(uint8_t flag, FLAGS6502 f)
+  {
+    return ((reg.SR & Z) > 0) ? 1 : 0;
+  }
+
+#pragma endregion FLAG FUNCTIONS
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region REGISTERS
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::setRegister(REGISTER6502 f, uint8_t v)
+  {
+    switch (f)
+    {
+    case REGISTER6502::AC:
+      reg.AC = v;
+      break;
+    case REGISTER6502::X:
+      reg.X = v;
+      break;
+    case REGISTER6502::Y:
+      reg.Y = v;
+      break;
+    case REGISTER6502::SR:
+      reg.SR = v;
+      loadFlags();
+      break;
+    case REGISTER6502::SP:
+      reg.SP = v;
+      break;
+    case REGISTER6502::PC:
+      throw std::invalid_argument("Unable to set Register \"PC\"");
+      break;
+    }
+  }
+
+
+  template <typename BusT>
+  uint8_t BasicProcessor<BusT>::getRegister(REGISTER6502 f)
+  {
+    if (fault == JAMMED)
+    {
+      return 0xFF;
+    }
+
+    switch (f)
+    {
+    case REGISTER6502::AC:
+      return reg.AC;
+      break;
+    case REGISTER6502::X:
+      return reg.X;
+      break;
+    case REGISTER6502::Y:
+      return reg.Y;
+      break;
+    case REGISTER6502::SR:
+      syncFlags();
+      return reg.SR;
+      break;
+    case REGISTER6502::SP:
+      return reg.SP;
+      break;
+    case REGISTER6502::PC:
+      throw std::invalid_argument("Unable to get Register \"PC\"");
+      break;
+    default:
+      throw std::runtime_error(fmt::format("Invalid register ({:02X})", f));
+    }
+  }
+
+
+  /*
+  void Processor::setRegister(REGISTER6502 f, uint16_t *v)
+  {
+      switch (f)
+      {
+          case REGISTER6502::PC:
+              setRegister(f, (uint16_t) v);
+
+              break;
+          default:
+              setRegister(f, (uint8_t) v);
+      }
+  }
+  void Processor::setRegister(REGISTER6502 f, uint16_t v)
+  {
+      switch (f)
+      {
+          case REGISTER6502::AC:
+              setProgramCounter(v);
+              break;
+          default:
+              setRegister(f, (uint8_t) v);
+      }
+
+  }
+  */
+
+
+  // Increment Program Counter
+  template <typename BusT>
+  uint16_t BasicProcessor<BusT>::incrementProgramCounter()
+  {
+    //Logger::log()->debug("PC++ {: >59}", reg);
+    reg.PC = (reg.PC + 1) & 0xFFFF;
+    return reg.PC;
+  }
+
+
+  // Decrement Program Counter
+  template <typename BusT>
+  uint16_t BasicProcessor<BusT>::decrementProgramCounter()
+  {
+    reg.PC = (reg.PC - 1) & 0xFFFF;
+    return reg.PC;
+  }
+
+
+  // Set Program Counter
+  template <typename BusT>
+  void BasicProcessor<BusT>::setProgramCounter(uint16_t value)
+  {
+    reg.PC = value & 0xFFFF;
+  }
+
+
+  // Get Program Counter
+  template <typename BusT>
+  uint16_t BasicProcessor<BusT>::getProgramCounter()
+  {
+    if (fault == JAMMED)
+    {
+      return 0xFFFF;
+    }
+
+    return reg.PC;
+    //return pc;
+  }
+
+
+  // Increment Stack Pointer
+  template <typename BusT>
+  uint8_t BasicProcessor<BusT>::incrementStackPointer()
+  {
+    reg.SP = (reg.SP + 1) & 0xFF;
+    return reg.SP;
+  }
+
+
+  // Decrement Stack Pointer
+  template <typename BusT>
+  uint8_t BasicProcessor<BusT>::decrementStackPointer()
+  {
+    reg.SP = (reg.SP - 1) & 0xFF;
+    //--stkp;
+    //return stkp;
+    return reg.SP;
+  }
+
+
+  // Peek Stack Pointer (No change on cycle)
+  template <typename BusT>
+  uint8_t BasicProcessor<BusT>::PeekStack()
+  {
+    //return readMemoryWithoutCycle(stkp + 0x100);
+    return readMemoryWithoutCycle(reg.SP + 0x100);
+  }
+
+
+  // Poke Stack Pointer (No change on cycle)
+  template <typename BusT>
+  void BasicProcessor<BusT>::PokeStack(uint8_t value)
+  {
+    //Logger::log()->info("PokeStack: {:02X} -> ${:04X}", value, (reg.SP + 0x100));
+    //writeMemoryWithoutCycle(stkp + 0x100, value);
+    writeMemoryWithoutCycle(reg.SP + 0x100, value);
+  }
+
+
+  // Pop Stack (Change on cycle (+2 cycles) & stackpointer)
+  template <typename BusT>
+  uint8_t BasicProcessor<BusT>::PopStack()
+  {
+    incrementStackPointer();
+    //incrementCycleCount();
+    return readMemory(reg.SP + 0x100);
+  }
+
+
+  // Pop Stack (Change on cycle & stackpointer)
+  template <typename BusT>
+  void BasicProcessor<BusT>::PushStack(uint8_t value)
+  {
+    //Logger::log()->info("PushStack: {:02X} -> ${:04X}", value, (reg.SP + 0x100));
+    writeMemory(reg.SP + 0x100, value);
+    //incrementCycleCount();
+    decrementStackPointer();
+  }
+
+
+  // Dump the Nth row from the bottom of the Stack
+  template <typename BusT>
+  void BasicProcessor<BusT>::DumpStack(uint8_t nRows)
+  {
+    uint16_t offsetStart = (0x200 - (nRows * 0xF)) | 0x100;
+    uint16_t offsetStop = 0x01FF;
+
+    bus->dump(offsetStart, offsetStop);
+  }
+
+  // Dump the whole Stack region
+  template <typename BusT>
+  void BasicProcessor<BusT>::DumpStack()
+  {
+    Logger::log()->info("StackPointer is at 0x{:04X}", reg.SP);
+    bus->dump(0x100, 0x1FF);
+  }
+
+
+  // Dump the row that StackPointer is located at
+  template <typename BusT>
+  void BasicProcessor<BusT>::DumpStackAtPointer()
+  {
+    uint16_t stackStart = (reg.SP + 0x100) & 0xFFF0;
+    uint16_t stackStop  = (reg.SP + 0x100) | 0x000F;
+
+    if ((stackStart & 0xFF00) != 0x100) {
+      stackStart = (stackStart & 0x00FF) + 0x100;
+    }
+    if ((stackStop & 0xFF00) != 0x100) {
+      stackStop = (stackStop & 0x00FF) + 0x100;
+    }
+    if (stackStop < stackStart) {
+      throw std::range_error(fmt::format("Start 0x{:04X} can not be larger than Stop 0x{:04X}", stackStart, stackStop));
+    }
+    Logger::log()->info("StackPointer @ 0x{:04X} (0x{:04X} - 0x{:04X})", reg.SP, stackStart, stackStop);
+
+
+    bus->dump(stackStart, stackStop);
+  }
+
+#pragma endregion REGISTERS
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region INTERNALS
+// INTERNALS
+
+// CPU Internals, like speed control (we don't want it to go to slow or to fast!)
+// Output log every: "cycle % GetLogModValue() == 0"
+  template <typename BusT>
+  uint8_t BasicProcessor<BusT>::GetLogModValue()
+  {
+    switch (cpuspeed)
+    {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return 1;
+    case 6:
+      return 5;
+    case 7:
+      return 20;
+    case 8:
+      return 30;
+    case 9:
+      return 40;
+    case 10:
+      return 50;
+    default:
+      return 5;
+    }
+  }
+
+
+  // Clock down Processor a bit, sleep every GetSleepValue() millisecond
+  template <typename BusT>
+  uint16_t BasicProcessor<BusT>::GetSleepValue()
+  {
+    switch (cpuspeed)
+    {
+    case 0:
+      return 550;
+    case 1:
+      return 550;
+    case 2:
+      return 440;
+    case 3:
+      return 330;
+    case 4:
+      return 220;
+    case 5:
+      return 160;
+    case 6:
+      return 80;
+    case 7:
+      return 40;
+    case 8:
+      return 20;
+    case 9:
+      return 10;
+    case 10:
+      return 5;
+    default:
+      return 5;
+    }
+  }
+
+
+  // Add Extra Cycle (and depending on parameter, increase cycle_count)
+  template <typename BusT>
+  void BasicProcessor<BusT>::addExtraCycle(bool incCycleCount)
+  {
+    extra_cycles = (extra_cycles + 1);
+    if (incCycleCount)
+    {
+      incrementCycleCount();
+    }
+  }
+
+
+#pragma endregion INTERNALS
+
+  ///////////////////////////////////////////////////////////////////////////////
+#pragma region DISASSEMBLER FUNCTIONS
+// DISASSEMBLER FUNCTIONS
+
+  // This is the disassembly function. Its workings are not required for emulation.
+  // It is merely a convenience function to turn the binary instruction code into
+  // human readable form. Its included as part of the emulator because it can take
+  // advantage of many of the CPUs internal operations to do 
+  template <typename BusT>
+  typename BasicProcessor<BusT>::DISASSEMBLY BasicProcessor<BusT>::setDisassembly(uint16_t &addr)
+  {
+    uint8_t value = 0x00,
+      lo = 0x00,
+      hi = 0x00;
+
+    DISASSEMBLY CurrentDisassembly;
+    // Read instruction, and get its readable name
+    uint8_t opcode = bus->read(addr, true);
+    std::string opName = executioner.getInstructionName(opcode);
+    std::string addrMode = executioner.getAddressModeName(opcode);
+
+    // Prefix line with instruction address
+    std::string sInst;
+    ++addr;
+
+    // Get operands from desired locations, and form the
+    // instruction based upon its addressing mode. These
+    // routines mimmick the actual fetch routine of the
+    // 6502 in order to get accurate data as part of the
+    // instruction
+
+    switch (executioner.getAddressMode(opcode))
+    {
+      case ExecutionerBase::AddressMode::ACC:
+      {
+        sInst = fmt::format(
+          "${:04X}: {} AC {{{}}}",
+          addr, opName, addrMode
+        );
+        //sInst += "AC {ACC}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::IMP:
+      {
+        sInst = fmt::format(
+          "${:04X}: {} {{{}}}",
+          addr, opName, addrMode
+        );
+        //sInst += "{IMP}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::IMM:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = 0x00;
+        sInst = fmt::format(
+          "${:04X}: {} #${:02X} {{{}}}",
+          addr, opName, lo, addrMode
+        );
+        //sInst += "#$" + hex(value, 2) + " {IMM}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::ZP0:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = 0x00;
+        sInst = fmt::format(
+          "${:04X}: {} ${:02X} {{{}}}",
+          addr, opName, lo, addrMode
+        );
+        //sInst += "$" + hex(lo, 2) + " {ZP0}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::ZPX:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = 0x00;
+        sInst = fmt::format(
+          "${:04X}: {} ${:02X}, X {{{}}}",
+          addr, opName, lo, addrMode
+        );
+        //sInst += "$" + hex(lo, 2) + ", X {ZPX}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::ZPY:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = 0x00;
+        sInst = fmt::format(
+          "${:04X}: {} ${:02X}, Y {{{}}}",
+          addr, opName, lo, addrMode
+        );
+        //sInst += "$" + hex(lo, 2) + ", Y {ZPY}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::IZX:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = 0x00;
+        sInst = fmt::format(
+          "${:04X}: {} (${:02X}, X) {{{}}}",
+          addr, opName, lo, addrMode
+        );
+        //sInst += "($" + hex(lo, 2) + ", X) {IZX}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::IZY:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = 0x00;
+        sInst = fmt::format(
+          "${:04X}: {} (${:02X}), Y {{{}}}",
+          addr, opName, lo, addrMode
+        );
+        //sInst += "($" + hex(lo, 2) + "), Y {IZY}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::IZP:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = 0x00;
+        sInst = fmt::format(
+          "${:04X}: {} (${:02X}) {{{}}}",
+          addr, opName, lo, addrMode
+        );
+        break;
+      }
+      case ExecutionerBase::AddressMode::ABS:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = bus->read(addr, true);
+        ++addr;
+        sInst = fmt::format(
+          "${:04X}: {} ${:04X} {{{}}}",
+          addr, opName, (hi << 8) | lo, addrMode
+        );
+        //sInst += "$" + hex((uint16_t)(hi << 8) | lo, 4) + " {ABS}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::ABX:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = bus->read(addr, true);
+        ++addr;
+        sInst = fmt::format(
+          "${:04X}: {} ${:04X}, X {{{}}}",
+          addr, opName, (hi << 8) | lo, addrMode
+        );
+        //sInst += "$" + hex((uint16_t)(hi << 8) | lo, 4) + ", X {ABX}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::ABY:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = bus->read(addr, true);
+        ++addr;
+        sInst = fmt::format(
+          "${:04X}: {} ${:04X}, Y {{{}}}",
+          addr, opName, (hi << 8) | lo, addrMode
+        );
+        //sInst += "$" + hex((uint16_t)(hi << 8) | lo, 4) + ", Y {ABY}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::IND:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = bus->read(addr, true);
+        ++addr;
+        sInst = fmt::format(
+          "${:04X}: {} (${:04X}) {{{}}}",
+          addr, opName, (hi << 8) | lo, addrMode
+        );
+        //sInst += "($" + hex((uint16_t)(hi << 8) | lo, 4) + ") {IND}";
+        break;
+      }
+      case ExecutionerBase::AddressMode::IAX:
+      {
+        lo = bus->read(addr, true);
+        ++addr;
+        hi = bus->read(addr, true);
+        ++addr;
+        sInst = fmt::format(
+          "${:04X}: {} (${:04X}, X) {{{}}}",
+          addr, opName, (hi << 8) | lo, addrMode
+        );
+        break;
+      }
+      case ExecutionerBase::AddressMode::REL:
+      {
+        uint8_t value = bus->read(addr, true);
+        ++addr;
+        lo = (addr + value) & 0xFF;
+        hi = ((addr + value) >> 8) & 0xFF;
+        sInst = fmt::format(
+          "${:04X}: {} ${:02X} [${:04X}] {{{}}}",
+          addr, opName, value, (addr + value), addrMode
+        );
+        //sInst += "$" + hex(value, 2) + " [$" + hex(addr + value, 4) + "] {REL}";
+        break;
+      }
+    }
+
+    CurrentDisassembly = {
+      .LowAddress         = lo,
+      .HighAddress        = hi,
+      .OpCode             = opcode,
+      .OpCodeString       = opName,
+      .AddressMode        = addrMode,
+      .DisassemblyOutput  = sInst
+    };
+
+    return CurrentDisassembly;
+  }
+
+  // This disassembly function will turn a chunk of binary code into human readable form.
+  // See the above function for a more descriptive text
+  template <typename BusT>
+  std::map<uint16_t, typename BasicProcessor<BusT>::DISASSEMBLY> BasicProcessor<BusT>::getDisassembly(uint16_t nStart, uint16_t nStop)
+  {
+    std::map<uint16_t, DISASSEMBLY> mapLines;
+
+    // Starting at the specified address we read an instruction
+    // byte, which in turn yields information from the lookup table
+    // as to how many additional bytes we need to read and what the
+    // addressing mode is. I need this info to assemble human readable
+    // syntax, which is different depending upon the addressing mode
+
+    // As the instruction is decoded, a struct is assembled
+    // with the readable output
+    disassemble(nStart, nStop, [&mapLines](uint16_t addr, const DISASSEMBLY& line) {
+      // Add the formed string to a std::map, using the instruction's
+      // address as the key. This makes it convenient to look for later
+      // as the instructions are variable in length, so a straight up
+      // incremental index is not sufficient.
+      mapLines[addr] = line;
+    });
+
+    return mapLines;
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::disassemble(uint16_t addr)
+  {
+#ifdef LOGMODE
+    DISASSEMBLY CD = setDisassembly(addr);
+    Logger::log()->info("{} {}", CD, reg);
+#endif
+  }
+
+  template <typename BusT>
+  void BasicProcessor<BusT>::disassemble(uint16_t nStart, uint16_t nStop)
+  {
+#ifdef LOGMODE
+    uint16_t addr = nStart;
+  //Logger::log()->info("disassemble: nStart: ${:04X} nStop: ${:04X}", nStart, nStop);
+
+    Logger::log()->info("\n");
+    Logger::log()->info("DISASSEMBLE: ${:04X} - ${:04X}", nStart, nStop);
+    Logger::log()->info("OP LO HI OPS DISASSEMBLY");
+
+    while (addr < (uint32_t)nStop)
+    {
+      DISASSEMBLY CD = setDisassembly(addr);
+      Logger::log()->info("{} {}", CD, reg);
+    }
+    Logger::log()->info("OP LO HI OPS DISASSEMBLY\n");
+
+#endif
+  }
+
+#pragma endregion DISASSEMBLER FUNCTIONS
+}
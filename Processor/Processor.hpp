@@ -1,11 +1,16 @@
 #pragma once
 
 #include "Executioner.hpp"
+#include "Loader.hpp"
+#include "ProcessorState.hpp"
 
+#include <array>
 #include <vector>
 #include <map>
+#include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <spdlog/spdlog.h>
 #ifdef SPDLOG_FMT_EXTERNAL
 #include <fmt/format.h>
@@ -22,68 +27,164 @@ namespace CPU
   // prevent circular inclusions
   class Bus;
   class Logger;
-  class Executioner;
 
   // The 6502 Emulation Class. This is it!
-  class Processor
+  //
+  // The state used by every instruction is kept in ProcessorState, the first
+  // cache line of the instance. See Bus.hpp for the memory used per instance.
+  //
+  // The processor is a template of the bus it reads & writes through, so the
+  // memory accesses of the opcodes are inlined into them. Processor is the
+  // one of Bus, built in Processor.cpp. Other buses (see MemoryMap.hpp)
+  // include the implementation from Processor-inl.hpp, or use the
+  // header-only build. The status flags, the registers and the enumerations
+  // below are in ProcessorBase, shared by all of them.
+  template <typename BusT>
+  class BasicProcessor : public BasicProcessorState<BusT>
   {
   public:
-    Processor();
-    ~Processor();
+    typedef BasicProcessorState<BusT> State;
+    using State::reg;
+    using State::total_cycles;
+    using State::clock_count;
+    using State::opcode;
+    using State::extra_cycles;
+    using State::cycle_count;
+    using State::_previousInterrupt;
+    using State::_interrupt;
+    using State::TriggerNmi;
+    using State::TriggerIRQ;
+
+    // The names of ProcessorBase are not found through the dependent base
+    typedef ProcessorBase::FLAGS6502    FLAGS6502;
+    typedef ProcessorBase::REGISTER     REGISTER;
+    typedef ProcessorBase::REGISTER6502 REGISTER6502;
+    typedef ProcessorBase::FAULT6502    FAULT6502;
+    typedef ProcessorBase::STOP6502     STOP6502;
+    typedef ProcessorBase::RUNRESULT    RUNRESULT;
+    typedef ProcessorBase::TIMING6502   TIMING6502;
+    using enum ProcessorBase::FLAGS6502;
+    using enum ProcessorBase::REGISTER6502;
+    using enum ProcessorBase::FAULT6502;
+    using enum ProcessorBase::STOP6502;
+    using enum ProcessorBase::TIMING6502;
+    using ProcessorBase::nzFlags;
+
+  protected:
+    using State::stopCycles;
+    using State::bus;
+    using State::stopAddress;
+    using State::idleAddress;
+    using State::nz;
+    using State::functional;
+    using State::fault;
 
-    // Linkages
-  private:
-    // Linkage to the communications bus
-    Bus* bus = nullptr;
-    bool jammed = 0x00;
+  public:
+    // The variant (see Executioner::VARIANT) is fixed for the lifetime of
+    // the processor
+    BasicProcessor(ExecutionerBase::VARIANT variant = ExecutionerBase::DEFAULT_VARIANT);
+    ~BasicProcessor();
 
+    // Linkages
   public:
     // Linkage to the instructions
-    Executioner executioner;
-
-    uint8_t  opcode = 0x00;     // Is the instruction byte
-    uint8_t  extra_cycles = 0;  // Number of extra cycles that has been added
-    uint8_t  cycle_count = 0;   // Counts how many cycles the instruction has remaining
-    uint32_t clock_count = 0;   // A global accumulation of the number of clocks
-
-    // When true, process interrupt
-    bool _previousInterrupt = false;
-    // If interrupt shall be triggered before next operation
-    bool _interrupt = false;
-    // Set to true when an NMI should occur
-    bool TriggerNmi = false;
-    // Set to true when an IRQ has occurred and is being processed by the CPU
-    bool TriggerIRQ = false;
+    BasicExecutioner<BusT> executioner;
 
     // External event functions. In hardware these represent pins that are asserted
     // to produce a change in state.
 
     // Reset Interrupt - Forces CPU into known state
     void reset();
+    // Puts the processor into the state of a snapshot (see Bus::resetTo()),
+    // as reset() does, with the registers & the cycle count given. The
+    // decoded code is kept, drop what the memory changed under
+    void restore(const REGISTER& registers, uint64_t cycles);
+    // Puts the settings back to those of a new processor (timing, idle
+    // detection, next event, IRQ line & the executioner's), for a bus that
+    // is recycled (see BusPool). The registers & the memory are left alone
+    void restoreDefaults();
     // Interrupt Request - Executes an instruction at a specific location
     void irq();
     // Non-Maskable Interrupt Request - As above, but cannot be disabled
     void nmi();
-    // Performs the next step on the processor
-    void tick();
+
+    // The IRQ line, held by devices (see Bus::attach()). It is level
+    // triggered: TriggerIRQ follows the line, and is raised again after an
+    // IRQ has been serviced for as long as the line is held. The NMI line is
+    // edge triggered, a device raises TriggerNmi directly
+    void setIrqLine(bool held)
+    {
+      irqLine = held;
+      TriggerIRQ = held;
+    }
+    bool getIrqLine() { return irqLine; }
+
+    // Checked before every instruction of runUntil(), stops the run when true
+    typedef std::function<bool(BasicProcessor&)> PREDICATE6502;
+
+    // Performs the next step on the processor, returns the fault if the
+    // processor stopped
+    FAULT6502 tick();
+
+    // Batch execution, using the dispatch engine selected in the Executioner.
+    // Instructions always run to completion, so a cycle budget can be
+    // overrun by the last instruction.
+
+    // Runs until at least the given number of cycles has been consumed
+    RUNRESULT run(uint64_t cycles);
+    // Runs the given number of instructions
+    RUNRESULT runInstructions(uint32_t instructions);
+    // Runs until the program counter is at the address, checked before every
+    // instruction (including the first)
+    RUNRESULT runUntil(uint16_t address, uint64_t cycles = UINT64_MAX);
+    // Runs until the predicate returns true, checked before every instruction
+    RUNRESULT runUntil(PREDICATE6502 predicate, uint64_t cycles = UINT64_MAX);
     // Set flag that CPU is in a "jammed" state, and requires reset.
     void setJammed();
+    // Records a fault, which stops execution until reset
+    void      setFault(FAULT6502 f) { fault = f; }
+    FAULT6502 getFault() { return (FAULT6502) fault; }
+
+    void       setTiming(TIMING6502 mode) { timing = mode; }
+    TIMING6502 getTiming() { return timing; }
+
+  private:
+    TIMING6502 timing = CYCLE_ACCURATE;
+    bool       irqLine = false;
+    // Cycles taken to service an interrupt
+    static constexpr uint8_t INTERRUPT_CYCLES = 7;
+
+    // Stop conditions of the current batch run, besides the cycle & address
+    // kept in ProcessorState
+    STOP6502      stopReason = INSTRUCTIONS;
+    PREDICATE6502 stopPredicate;
+
+    RUNRESULT batch(uint64_t instructions, uint64_t cycles);
+    // Clears the cycle counters of the instruction, the fault, the idle loop
+    // & the pending interrupts, for reset() & restore()
+    void      clearState();
 
+  public:
     // Indicates the current instruction has completed by returning true. This is
     // a utility function to enable "step-by-step" execution, without manually 
     // clocking every cycle
     bool complete();
 
-    // Load program
+    // Load program. The memory is cleared first, then the program is copied
+    // to offset and the processor is reset
     void LoadProgram(uint16_t offset, std::string program);
     void LoadProgram(uint16_t offset, std::string program, uint16_t initialProgramCounter);
     void LoadProgram(uint16_t offset, uint8_t program[], size_t programSize);
     void LoadProgram(uint16_t offset, uint8_t program[], size_t programSize, uint16_t initialProgramCounter);
+    // Copies the segments of the image (see Loader) into memory and resets
+    // the processor, starting at the entry of the image when it has one. The
+    // rest of the memory is left as it is, unless clearMemory is set
+    void LoadImage(const Loader::IMAGE& image, bool clearMemory = false);
 
   // Bus Connectivity
   public:
     // Link this CPU to a communications bus
-    void ConnectBus(Bus* n) { bus = n; }
+    void ConnectBus(BusT* n) { bus = n; }
 
     // Dump 16 bytes of RAM 0x???0 -> 0x???F to logfile
     void dumpRam(uint16_t offset);
@@ -92,96 +193,6 @@ namespace CPU
     void dumpRam(uint16_t offsetStart, uint16_t offsetStop);
 
   public:
-    // The status register stores 8 flags. Ive enumerated these here for ease
-    // of access. You can access the status register directly since its public.
-    // The bits have different interpretations depending upon the context and 
-    // instruction being executed.
-    enum FLAGS6502
-    {
-      // Bit 0 - 0x01 - Carry Bit
-      C = (1 << 0),
-      // Bit 1 - 0x02 - Zero
-      Z = (1 << 1),
-      // Bit 2 - 0x04 - Disable Interrupts
-      I = (1 << 2),
-      // Bit 3 - 0x08 - Decimal Mode (unused in NES implementation)
-      D = (1 << 3),
-      // Bit 4 - 0x10 - Break
-      B = (1 << 4),
-      // Bit 5 - 0x20 - Unused
-      U = (1 << 5),
-      // Bit 6 - 0x40 - Overflow
-      V = (1 << 6),
-      // Bit 7 - 0x80 - Negative
-      N = (1 << 7),
-    };
-
-    enum REGISTER6502
-    {
-      // 16-bit - Program Counter
-      PC = 0,
-      // 8-bit - Accumulator Register
-      AC = 1,
-      // 8-bit - X Register
-      X = 2,
-      // 8-bit - Y Register
-      Y = 3,
-      // 8-bit - Status Register
-      SR = 4,
-      // 8-bit - Stack Pointer (points to location on bus)
-      SP = 5,
-    };
-
-    // CPU Core registers, exposed as public here for ease of access from external
-    // examinors. This is all the 6502 has.
-    struct REGISTER
-    {
-      // 8-bit - Accumulator Register
-      uint8_t  AC = 0x00;
-      // 8-bit - X Register
-      uint8_t  X = 0x00;
-      // 8-bit - Y Register
-      uint8_t  Y = 0x00;
-      // 8-bit - Stack Pointer (points to location on bus)
-      uint8_t  SP = 0x00;
-      // 16-bit - Program Counter
-      uint16_t PC = 0x0000;
-      // 8-bit - Status Register
-      uint8_t  SR = 0x00;
-
-      void reset()
-      {
-        // A RESET pushes SR & PC (3 bytes) to SP 0x100, therefore SP initializes to 0xFD
-        *this = {
-          .AC = 0x00,
-          .X = 0x00,
-          .Y = 0x00,
-          .SP = 0xFD,
-          .PC = 0x0000,
-          .SR = 0x00 | FLAGS6502::U | FLAGS6502::B
-        };
-      }
-
-      friend std::ostream &operator<<(std::ostream &os, const REGISTER& obj)
-      {
-        fmt::format_to(
-          std::ostream_iterator<char>(os),
-          "PC:{:04X} A:{:02X} X:{:02X} Y:{:02X} {}{}{}{}{}{}{}{} STKP:{:02X}",
-          obj.PC, obj.AC, obj.X, obj.Y,
-          (((obj.SR & FLAGS6502::N) > 0) ? "N" : "."),
-          (((obj.SR & FLAGS6502::V) > 0) ? "V" : "."),
-          (((obj.SR & FLAGS6502::U) > 0) ? "U" : "."),
-          (((obj.SR & FLAGS6502::B) > 0) ? "B" : "."),
-          (((obj.SR & FLAGS6502::D) > 0) ? "D" : "."),
-          (((obj.SR & FLAGS6502::I) > 0) ? "I" : "."),
-          (((obj.SR & FLAGS6502::Z) > 0) ? "Z" : "."),
-          (((obj.SR & FLAGS6502::C) > 0) ? "C" : "."),
-          obj.SP
-        );
-        return os;
-      }
-    } reg;
-
     struct DISASSEMBLY
     {
       // 8-bit - Lo-byte
@@ -197,6 +208,9 @@ namespace CPU
       // string - Disassembled Output
       std::string       DisassemblyOutput;
 
+      // Formatted with operator<<, see Formatters.hpp
+      typedef std::true_type streamed;
+
       friend std::ostream &operator<<(std::ostream &os, const DISASSEMBLY& obj)
       {
         fmt::format_to(
@@ -210,8 +224,71 @@ namespace CPU
     };
 
     // Convenience functions to access status register
-    uint8_t     GetFlag(FLAGS6502 f);
-    void        SetFlag(FLAGS6502 f, bool v);
+    uint8_t     GetFlag(FLAGS6502 f)
+    {
+#ifdef LAZY_FLAGS
+      if (f == N)
+      {
+        return nz >> 15;
+      }
+      if (f == Z)
+      {
+        return (nz & 0x00FF) == 0x00;
+      }
+#endif
+      return ((reg.SR & f) > 0) ? 1 : 0;
+    }
+    void        SetFlag(FLAGS6502 f, bool v)
+    {
+#ifdef LAZY_FLAGS
+      if (f == N)
+      {
+        nz = (nz & 0x00FF) | (v ? 0x8000 : 0x0000);
+        return;
+      }
+      if (f == Z)
+      {
+        nz = (nz & 0xFF00) | (v ? 0x00 : 0x01);
+        return;
+      }
+#endif
+      reg.SR = v ? (reg.SR | f) : (reg.SR & ~f);
+    }
+    // Sets the Negative & Zero flags from the result of an operation
+    void        SetNZ(uint8_t result)
+    {
+#ifdef LAZY_FLAGS
+      SetNZ(result, result);
+#else
+      reg.SR = (reg.SR & ~(N | Z)) | nzFlags[result];
+#endif
+    }
+    // Sets the Negative flag from bit 7 of one value and the Zero flag from
+    // another, as BIT does
+    void        SetNZ(uint8_t negative, uint8_t zero)
+    {
+#ifdef LAZY_FLAGS
+      nz = (negative << 8) | zero;
+#else
+      reg.SR = (reg.SR & ~(N | Z)) | (negative & N) | (nzFlags[zero] & Z);
+#endif
+    }
+    // Sets the flags in the mask to their values in flags
+    void        SetFlags(uint8_t mask, uint8_t flags)
+    {
+#ifdef LAZY_FLAGS
+      if (mask & N)
+      {
+        nz = (nz & 0x00FF) | ((flags & N) << 8);
+      }
+      if (mask & Z)
+      {
+        nz = (nz & 0xFF00) | ((flags & Z) ? 0x00 : 0x01);
+      }
+      mask &= ~(N | Z);
+#endif
+      reg.SR = (reg.SR & ~mask) | (flags & mask);
+    }
     std::string DecodeFlag(uint8_t flag);
     uint8_t     DecodeFlag(uint8_t flag, FLAGS6502 f);
 
@@ -219,6 +296,21 @@ namespace CPU
   public:
     DISASSEMBLY setDisassembly(uint16_t &addr);
     std::map<uint16_t, DISASSEMBLY> getDisassembly(uint16_t nStart, uint16_t nStop);
+    // Calls visit(addr, DISASSEMBLY) for every instruction starting from
+    // nStart to nStop, without building a map. The memory is peeked
+    template <typename VISITOR>
+    void disassemble(uint16_t nStart, uint16_t nStop, VISITOR&& visit)
+    {
+      uint32_t addr = nStart;
+      while (addr <= nStop)
+      {
+        uint16_t next = (uint16_t)addr;
+        DISASSEMBLY line = setDisassembly(next);
+        visit((uint16_t)addr, line);
+        // Stops at the end of the address space
+        addr = (next > addr) ? next : 0x10000;
+      }
+    }
     // Produces a map of strings, with keys equivalent to instruction start locations
     // in memory, for the specified address range
     void disassemble(uint16_t addr);
@@ -247,14 +339,74 @@ namespace CPU
     void SetCpuSpeed(uint8_t nSpeed) { cpuspeed = nSpeed; };
 
   public:
-    uint8_t readMemory(uint16_t a);
-    void    writeMemory(uint16_t a, uint8_t d);
-    uint8_t readMemoryWithoutCycle(uint16_t a);
-    void    writeMemoryWithoutCycle(uint16_t a, uint8_t d);
+    // Defined here, for the accesses of the opcodes to be inlined down to
+    // the read & write of the bus
+#pragma region BUS CONNECTIVITY
+    // Reads an 8-bit byte from the bus, located at the specified 16-bit address
+    uint8_t readMemory(uint16_t addr)
+    {
+      // In normal operation "read only" is set to false. This may seem odd. Some
+      // devices on the bus may change state when they are read from, and this 
+      // is intentional under normal circumstances. However the disassembler will
+      // want to read the data at an address without changing the state of the
+      // devices on the bus
+      incrementCycleCount();
+      return bus->read(addr, false);
+    }
+
+    // Writes a byte to the bus at the specified address
+    void    writeMemory(uint16_t addr, uint8_t data)
+    {
+      incrementCycleCount();
+      bus->write(addr, data);
+    }
+
+    // Reads an 8-bit byte from the bus, located at the specified 16-bit address
+    uint8_t readMemoryWithoutCycle(uint16_t addr)
+    {
+      return bus->read(addr, false);
+    }
+
+    // Writes a byte to the bus at the specified address
+    void    writeMemoryWithoutCycle(uint16_t addr, uint8_t data)
+    {
+      bus->write(addr, data);
+    }
+#pragma endregion BUS CONNECTIVITY
+
+  // Instruction cycle, shared by all dispatch engines
+  public:
+    // Fetches the next opcode and moves the program counter past it.
+    // Returns false if a fault prevents the instruction from starting
+    bool     startInstruction();
+    // Completes the current instruction and services pending interrupts
+    void     finishInstruction();
+    // True if the instructions from first to last, taking at most the
+    // cycles, can run without anything looking in between: no fault, stop,
+    // idle loop or pending interrupt. Translated code (see Jit) runs them
+    // as a whole
+    bool     canRunBlock(uint16_t first, uint16_t last, uint32_t cycles)
+    {
+      return bus != nullptr && fault == NONE && !stopPredicate && !idleDetection && !TriggerNmi && !TriggerIRQ &&
+        total_cycles + cycles <= stopCycles && (stopAddress < first || stopAddress > last);
+    }
 
   public:
     void     addExtraCycle(bool incCycleCount = true);
-    void     incrementCycleCount();
+    void     incrementCycleCount()
+    {
+      if (functional)
+      {
+        // Accounted for by finishInstruction()
+        return;
+      }
+
+      cycle_count++;
+      total_cycles++;
+
+      _previousInterrupt = _interrupt;
+      _interrupt = TriggerNmi || (TriggerIRQ && GetFlag(I) == 0);
+    }
     uint16_t incrementProgramCounter();
     uint16_t decrementProgramCounter();
     void     setProgramCounter(uint16_t value);
@@ -262,5 +414,77 @@ namespace CPU
     uint8_t  incrementStackPointer();
     uint8_t  decrementStackPointer();
 
+  public:
+    // Idle loop detection. A loop that reads no volatile memory (see
+    // Bus::setVolatile()), writes nothing and leaves the registers as they
+    // were can only end through an interrupt, so batch runs skip ahead
+    // instead of spinning: the cycles and instructions of the skipped
+    // iterations are credited, up to the end of the batch or the next
+    // scheduled event. Disabled by default, and never used by tick() or
+    // runUntil() with a predicate.
+    void setIdleDetection(bool enable);
+    bool getIdleDetection() { return idleDetection; }
+    // Cycle of the next scheduled event (e.g. a timer raising an interrupt),
+    // idle loops are never skipped past it
+    void     setNextEvent(uint64_t cycle) { nextEvent = cycle; }
+    uint64_t getNextEvent() { return nextEvent; }
+    // Number of cycles skipped in idle loops
+    uint64_t getIdleCycles() { return idleCycles; }
+
+    // Called by the executioner when a jump or branch at the end of the
+    // loop (the address after it) goes back to the head of the loop
+    void loopBack(uint16_t head, uint16_t end);
+
+  private:
+    // The last loop jumped back to, and the state at that jump
+    struct IDLELOOP
+    {
+      int32_t  head = -1;
+      uint16_t end = 0x0000;
+      // Registers, cycles & instructions at the last jump back
+      REGISTER registers;
+      uint64_t cycles = 0;
+      uint32_t instructions = 0;
+      // Cost of one iteration, once the loop is known to be idle
+      uint64_t iterationCycles = 0;
+      uint32_t iterationInstructions = 0;
+    };
+
+    bool     idleDetection = false;
+    bool     batching = false;
+    IDLELOOP idleLoop;
+    uint64_t nextEvent = UINT64_MAX;
+    uint64_t idleCycles = 0;
+
+    // Number of instructions of the loop, if they only read non-volatile
+    // memory and write none, otherwise 0
+    uint32_t countIdleInstructions(uint16_t head, uint16_t end);
+    // Skips iterations of the idle loop, within the budget left of the
+    // batch. Returns the number of instructions skipped
+    uint64_t skipIdleLoop(uint64_t instructions);
+
+  public:
+    // Lazy flags. Built with LAZY_FLAGS, the Negative & Zero flags are kept
+    // as the values they were computed from and only written to reg.SR when
+    // the status register is read (PHP, BRK & interrupts, getRegister()).
+    // Executioner::run() loads them before the first instruction and syncs
+    // them after the last, so reg.SR is current whenever nothing is running.
+    // Outside of a run, change reg.SR through setRegister() for GetFlag() to
+    // see it.
+    void syncFlags()
+    {
+#ifdef LAZY_FLAGS
+      reg.SR = (reg.SR & ~(N | Z)) | ((nz >> 8) & N) | ((nz & 0x00FF) == 0x00 ? Z : 0);
+#endif
+    }
+    void loadFlags()
+    {
+#ifdef LAZY_FLAGS
+      nz = ((reg.SR & N) << 8) | ((reg.SR & Z) ? 0x00 : 0x01);
+#endif
+    }
   };
+
+  // The processor of the Bus
+  typedef BasicProcessor<Bus> Processor;
 }
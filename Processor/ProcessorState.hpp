@@ -0,0 +1,262 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <iterator>
+#ifdef SPDLOG_FMT_EXTERNAL
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#else
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/fmt/ostr.h>
+#endif
+
+namespace CPU
+{
+  template <typename BusT> class BasicExecutioner;
+
+  // Size of a cache line, the hot state of a processor fills exactly one
+  inline constexpr size_t CACHE_LINE = 64;
+
+  // Everything of a processor that does not depend on the bus it is
+  // connected to: the status flags, the registers and the enumerations used
+  // by the Processor interface. It has no members, so it adds nothing to
+  // the size of the state.
+  struct ProcessorBase
+  {
+    // The status register stores 8 flags. Ive enumerated these here for ease
+    // of access. You can access the status register directly since its public.
+    // The bits have different interpretations depending upon the context and
+    // instruction being executed.
+    enum FLAGS6502
+    {
+      // Bit 0 - 0x01 - Carry Bit
+      C = (1 << 0),
+      // Bit 1 - 0x02 - Zero
+      Z = (1 << 1),
+      // Bit 2 - 0x04 - Disable Interrupts
+      I = (1 << 2),
+      // Bit 3 - 0x08 - Decimal Mode (unused in NES implementation)
+      D = (1 << 3),
+      // Bit 4 - 0x10 - Break
+      B = (1 << 4),
+      // Bit 5 - 0x20 - Unused
+      U = (1 << 5),
+      // Bit 6 - 0x40 - Overflow
+      V = (1 << 6),
+      // Bit 7 - 0x80 - Negative
+      N = (1 << 7),
+    };
+
+    // CPU Core registers, exposed as public here for ease of access from external
+    // examinors. This is all the 6502 has.
+    struct REGISTER
+    {
+      // 8-bit - Accumulator Register
+      uint8_t  AC = 0x00;
+      // 8-bit - X Register
+      uint8_t  X = 0x00;
+      // 8-bit - Y Register
+      uint8_t  Y = 0x00;
+      // 8-bit - Stack Pointer (points to location on bus)
+      uint8_t  SP = 0x00;
+      // 16-bit - Program Counter
+      uint16_t PC = 0x0000;
+      // 8-bit - Status Register
+      uint8_t  SR = 0x00;
+
+      void reset()
+      {
+        // A RESET pushes SR & PC (3 bytes) to SP 0x100, therefore SP initializes to 0xFD
+        *this = {
+          .AC = 0x00,
+          .X = 0x00,
+          .Y = 0x00,
+          .SP = 0xFD,
+          .PC = 0x0000,
+          .SR = 0x00 | FLAGS6502::U | FLAGS6502::B
+        };
+      }
+
+      friend std::ostream &operator<<(std::ostream &os, const REGISTER& obj)
+      {
+        fmt::format_to(
+          std::ostream_iterator<char>(os),
+          "PC:{:04X} A:{:02X} X:{:02X} Y:{:02X} {}{}{}{}{}{}{}{} STKP:{:02X}",
+          obj.PC, obj.AC, obj.X, obj.Y,
+          (((obj.SR & FLAGS6502::N) > 0) ? "N" : "."),
+          (((obj.SR & FLAGS6502::V) > 0) ? "V" : "."),
+          (((obj.SR & FLAGS6502::U) > 0) ? "U" : "."),
+          (((obj.SR & FLAGS6502::B) > 0) ? "B" : "."),
+          (((obj.SR & FLAGS6502::D) > 0) ? "D" : "."),
+          (((obj.SR & FLAGS6502::I) > 0) ? "I" : "."),
+          (((obj.SR & FLAGS6502::Z) > 0) ? "Z" : "."),
+          (((obj.SR & FLAGS6502::C) > 0) ? "C" : "."),
+          obj.SP
+        );
+        return os;
+      }
+    };
+
+    enum REGISTER6502
+    {
+      // 16-bit - Program Counter
+      PC = 0,
+      // 8-bit - Accumulator Register
+      AC = 1,
+      // 8-bit - X Register
+      X = 2,
+      // 8-bit - Y Register
+      Y = 3,
+      // 8-bit - Status Register
+      SR = 4,
+      // 8-bit - Stack Pointer (points to location on bus)
+      SP = 5,
+    };
+
+    // Reasons the processor can not continue executing instructions. A fault
+    // stops the run loop and stays set until the processor is reset.
+    enum FAULT6502
+    {
+      // No fault, executing normally
+      NONE = 0,
+      // Opcode has no implementation (only when illegal opcodes are disabled)
+      INVALID_OPCODE = 1,
+      // A JAM opcode halted the processor
+      JAMMED = 2,
+      // No bus is connected to read instructions from
+      UNCONNECTED_BUS = 3,
+      // A STP opcode stopped the processor (65C02)
+      STOPPED = 4,
+    };
+
+    // Reasons a batch run returned
+    enum STOP6502
+    {
+      // The instruction budget was used up
+      INSTRUCTIONS = 0,
+      // The cycle budget was used up
+      CYCLES = 1,
+      // The program counter reached the requested address
+      ADDRESS = 2,
+      // The predicate returned true
+      PREDICATE = 3,
+      // A fault stopped the processor, see getFault()
+      FAULT = 4,
+    };
+
+    struct RUNRESULT
+    {
+      // Why the run returned
+      STOP6502 reason = INSTRUCTIONS;
+      // Number of instructions executed
+      uint64_t instructions = 0;
+      // Number of cycles consumed
+      uint64_t cycles = 0;
+    };
+
+    // How time is accounted for. CYCLE_ACCURATE counts every bus access as
+    // it happens and samples the interrupt lines on each, like the hardware.
+    // FUNCTIONAL adds the cycles of an instruction once it has finished (its
+    // base cycles plus page crossing & branch penalties), and only checks for
+    // interrupts between instructions. The totals are the same, so a run can
+    // fast forward functionally and switch to cycle accurate at any time,
+    // e.g. from a device or a runUntil() predicate. The switch takes effect
+    // from the next instruction.
+    enum TIMING6502
+    {
+      CYCLE_ACCURATE = 0,
+      FUNCTIONAL = 1,
+    };
+
+    // Negative & Zero flags of every result byte
+    static constexpr std::array<uint8_t, 256> nzFlags = []() {
+      std::array<uint8_t, 256> flags = {};
+      for (int v = 0; v < 256; v++)
+      {
+        flags[v] = (v & N) | (v == 0x00 ? Z : 0);
+      }
+      return flags;
+    }();
+  };
+
+  // The state a processor touches on every instruction: the registers, the
+  // pending interrupts, the cycle counters, the stop conditions checked by
+  // startInstruction() and the temporaries of the Executioner. It is the
+  // base of Processor, so it sits on the first cache line of every instance
+  // and running an instruction reads & writes that one line (besides the
+  // memory it accesses). Everything else in a Processor is either only used
+  // by optional features, or shared by every instance (the opcode tables
+  // of Instructions.hpp and the ALU tables of Alu.hpp).
+  //
+  // The members are laid out without padding between them, keep it that way
+  // when adding to it: the struct must stay within the line.
+  template <typename BusT>
+  struct alignas(CACHE_LINE) BasicProcessorState : public ProcessorBase
+  {
+    REGISTER reg;
+
+    uint64_t total_cycles = 0;  // A global accumulation of the number of cycles
+
+  protected:
+    // Cycle at which the current batch run stops
+    uint64_t stopCycles = UINT64_MAX;
+    // Linkage to the communications bus
+    BusT*    bus = nullptr;
+
+  public:
+    uint32_t clock_count = 0;   // A global accumulation of the number of clocks
+
+  protected:
+    // Address at which the current batch run stops, -1 if none
+    int32_t  stopAddress = -1;
+    // Head of the idle loop to skip when execution gets there, -1 if none
+    int32_t  idleAddress = -1;
+    // Lazy Negative & Zero flags, see Processor::syncFlags(). Bit 15 holds
+    // the Negative flag, the Zero flag is set when the low byte is 0
+    uint16_t nz = 0x0001;
+
+  private:
+    // Assistive variables of the Executioner, to facilitate emulation
+    friend class BasicExecutioner<BusT>;
+
+    // 16-bit - All used memory addresses end up in here
+    uint16_t addr_abs = 0x0000;
+    // 16bit - Represents absolute address following a branch
+    uint16_t addr_rel = 0x0000;
+    // 8-bit - A convenience variable used everywhere
+    // @deprecated
+    uint16_t temp = 0x0000;
+    // 8-bit - Represents the working input value to the ALU
+    uint8_t  fetched = 0x00;
+
+  public:
+    uint8_t  opcode = 0x00;     // Is the instruction byte
+    uint8_t  extra_cycles = 0;  // Number of extra cycles that has been added
+    uint8_t  cycle_count = 0;   // Counts how many cycles the instruction has remaining
+
+    // When true, process interrupt
+    bool _previousInterrupt = false;
+    // If interrupt shall be triggered before next operation
+    bool _interrupt = false;
+    // Set to true when an NMI should occur
+    bool TriggerNmi = false;
+    // Set to true when an IRQ has occurred and is being processed by the CPU
+    bool TriggerIRQ = false;
+
+  protected:
+    // The timing of the instruction being executed, see Processor::TIMING6502
+    bool     functional = false;
+    // The fault stopping the processor, see Processor::FAULT6502
+    uint8_t  fault = 0;
+  };
+
+  class Bus;
+
+  // The state of the processor of the Bus
+  typedef BasicProcessorState<Bus> ProcessorState;
+
+  static_assert(sizeof(ProcessorState) == CACHE_LINE, "The hot state of a processor must fit one cache line");
+}
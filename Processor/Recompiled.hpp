@@ -0,0 +1,243 @@
+#pragma once
+
+#include <cstdint>
+
+// Interface between modules generated by the Recompiler and the runtime that
+// loads them (see RecompiledModule). Generated modules only include this
+// header, so they build without the rest of the emulator and don't link
+// against it: memory is reached through the callbacks in the CONTEXT.
+//
+// The operations mirror the ones in the Executioner, so a translated block
+// leaves the registers, memory and cycle count exactly as the interpreter
+// would have.
+namespace CPU
+{
+  namespace Recompiled
+  {
+    // Changes whenever the layout of the structures below changes
+    constexpr uint32_t VERSION = 2;
+
+    // Name of the function a module exports, returning its MODULE
+    constexpr const char* SYMBOL = "recompiled6502";
+
+    // Build options a module must share with the runtime
+    enum OPTIONS : uint32_t
+    {
+      DECIMAL = (1 << 0),
+    };
+
+    constexpr uint32_t BUILD_OPTIONS = 0
+#ifdef DECIMAL_MODE
+      | DECIMAL
+#endif
+      ;
+
+    // The processor a module was translated for, as in Executioner::VARIANT
+    enum VARIANT : uint32_t
+    {
+      MOS6502   = 0,
+      WDC65C02  = 1,
+      RICOH2A03 = 2,
+    };
+
+    // The state a translated block works on
+    struct CONTEXT
+    {
+      // Registers, as in Processor::REGISTER
+      uint8_t  AC = 0x00;
+      uint8_t  X = 0x00;
+      uint8_t  Y = 0x00;
+      uint8_t  SP = 0x00;
+      uint16_t PC = 0x0000;
+      uint8_t  SR = 0x00;
+
+      // Counters, a block adds what it used
+      uint64_t cycles = 0;
+      uint64_t instructions = 0;
+
+      // Memory access through the bus
+      void*    bus = nullptr;
+      uint8_t  (*read)(void* bus, uint16_t addr) = nullptr;
+      void     (*write)(void* bus, uint16_t addr, uint8_t data) = nullptr;
+    };
+
+    // A translated basic block. Runs every instruction of the block and
+    // leaves the address of the next instruction in the program counter
+    typedef void (*BLOCK)(CONTEXT& c);
+
+    struct ENTRY
+    {
+      // Address of the first instruction
+      uint16_t       address;
+      // Number of bytes the block was translated from
+      uint16_t       size;
+      // The bytes, the block is only valid while memory still holds them
+      const uint8_t* bytes;
+      BLOCK          block;
+    };
+
+    struct MODULE
+    {
+      uint32_t     version;
+      uint32_t     options;
+      // Blocks only run on a processor of this variant
+      uint32_t     variant;
+      // Entries sorted by address
+      uint32_t     count;
+      const ENTRY* entries;
+    };
+
+    typedef const MODULE* (*EXPORT)();
+
+#pragma region OPERATIONS
+    // Status register flags, as in Processor::FLAGS6502
+    constexpr uint8_t C = (1 << 0);
+    constexpr uint8_t Z = (1 << 1);
+    constexpr uint8_t I = (1 << 2);
+    constexpr uint8_t D = (1 << 3);
+    constexpr uint8_t B = (1 << 4);
+    constexpr uint8_t U = (1 << 5);
+    constexpr uint8_t V = (1 << 6);
+    constexpr uint8_t N = (1 << 7);
+
+    inline void setFlag(CONTEXT& c, uint8_t f, bool v)
+    {
+      c.SR = v ? (c.SR | f) : (c.SR & ~f);
+    }
+
+    inline uint8_t setNZ(CONTEXT& c, uint8_t value)
+    {
+      c.SR = (c.SR & ~(N | Z)) | (value & N) | (value == 0x00 ? Z : 0);
+      return value;
+    }
+
+    inline uint8_t read(CONTEXT& c, uint16_t addr)
+    {
+      return c.read(c.bus, addr);
+    }
+
+    inline void write(CONTEXT& c, uint16_t addr, uint8_t data)
+    {
+      c.write(c.bus, addr, data);
+    }
+
+    inline void push(CONTEXT& c, uint8_t value)
+    {
+      write(c, 0x100 + c.SP, value);
+      c.SP--;
+    }
+
+    inline uint8_t pop(CONTEXT& c)
+    {
+      c.SP++;
+      return read(c, 0x100 + c.SP);
+    }
+
+    // The 2A03 has no decimal mode, the 65C02 takes a cycle more in it
+    template <VARIANT Variant>
+    inline void adc(CONTEXT& c, uint8_t m)
+    {
+      uint16_t temp;
+#ifdef DECIMAL_MODE
+      if (Variant != RICOH2A03 && (c.SR & D))
+      {
+        c.cycles += (Variant == WDC65C02);
+        uint8_t d0 = (m & 0x0F) + (c.AC & 0x0F) + (c.SR & C);
+        uint8_t d1 = (m >> 4) + (c.AC >> 4) + (d0 > 9 ? 1 : 0);
+        temp = d0 % 10 | (d1 % 10 << 4);
+        setFlag(c, C, d1 > 9);
+      }
+      else
+#endif
+      {
+        temp = (uint16_t)c.AC + (uint16_t)m + (uint16_t)(c.SR & C);
+        setFlag(c, V, (~((uint16_t)m ^ (uint16_t)c.AC) & (temp ^ (uint16_t)c.AC)) & 0x80);
+        setFlag(c, C, temp > 255);
+      }
+      c.AC = setNZ(c, temp & 0xFF);
+    }
+
+    template <VARIANT Variant>
+    inline void sbc(CONTEXT& c, uint8_t m)
+    {
+      uint16_t value;
+#ifdef DECIMAL_MODE
+      if (Variant != RICOH2A03 && (c.SR & D))
+      {
+        c.cycles += (Variant == WDC65C02);
+        int8_t d0 = (c.AC & 0x0F) - (m & 0x0F) - ((c.SR & C) ? 0 : 1);
+        int8_t d1 = (c.AC >> 4) - (m >> 4) - (d0 < 0 ? 1 : 0);
+        value = (d0 < 0 ? 10 + d0 : d0) | ((d1 < 0 ? 10 + d1 : d1) << 4);
+        setFlag(c, C, d1 < 0);
+      }
+      else
+#endif
+      {
+        uint16_t bottom = ((uint16_t)m) ^ 0x00FF;
+        value = (uint16_t)c.AC + bottom + (uint16_t)(c.SR & C);
+        setFlag(c, V, (value ^ (uint16_t)c.AC) & (value ^ bottom) & 0x0080);
+        setFlag(c, C, value & 0xFF00);
+      }
+      c.AC = setNZ(c, value & 0xFF);
+    }
+
+    inline void compare(CONTEXT& c, uint8_t r, uint8_t m)
+    {
+      setFlag(c, C, r >= m);
+      setNZ(c, (uint8_t)(r - m));
+    }
+
+    inline void bit(CONTEXT& c, uint8_t m)
+    {
+      setFlag(c, Z, (c.AC & m) == 0x00);
+      setFlag(c, N, m & N);
+      setFlag(c, V, m & V);
+    }
+
+    inline uint8_t asl(CONTEXT& c, uint8_t m)
+    {
+      setFlag(c, C, m & 0x80);
+      return setNZ(c, m << 1);
+    }
+
+    inline uint8_t lsr(CONTEXT& c, uint8_t m)
+    {
+      setFlag(c, C, m & 0x01);
+      return setNZ(c, m >> 1);
+    }
+
+    inline uint8_t rol(CONTEXT& c, uint8_t m)
+    {
+      uint8_t carry = c.SR & C;
+      setFlag(c, C, m & 0x80);
+      return setNZ(c, (m << 1) | carry);
+    }
+
+    inline uint8_t ror(CONTEXT& c, uint8_t m)
+    {
+      uint8_t carry = c.SR & C;
+      setFlag(c, C, m & 0x01);
+      return setNZ(c, (carry << 7) | (m >> 1));
+    }
+
+    inline uint8_t inc(CONTEXT& c, uint8_t m)
+    {
+      return setNZ(c, m + 1);
+    }
+
+    inline uint8_t dec(CONTEXT& c, uint8_t m)
+    {
+      return setNZ(c, m - 1);
+    }
+
+    // Read-modify-write instructions write the unmodified value back first
+    template <typename F>
+    inline void modify(CONTEXT& c, uint16_t addr, F operation)
+    {
+      uint8_t m = read(c, addr);
+      write(c, addr, m);
+      write(c, addr, operation(c, m));
+    }
+#pragma endregion OPERATIONS
+  }
+}
@@ -0,0 +1,226 @@
+#include "RecompiledModule.hpp"
+#include "Bus.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace CPU
+{
+  RecompiledModule::~RecompiledModule()
+  {
+    unload();
+  }
+
+  bool RecompiledModule::load(const std::string& path)
+  {
+    unload();
+
+#ifdef _WIN32
+    HMODULE library = LoadLibraryA(path.c_str());
+    if (library == nullptr)
+    {
+      error = "Unable to load " + path;
+      return false;
+    }
+    auto symbol = reinterpret_cast<Recompiled::EXPORT>(GetProcAddress(library, Recompiled::SYMBOL));
+    handle = library;
+#else
+    handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle == nullptr)
+    {
+      error = dlerror();
+      return false;
+    }
+    auto symbol = reinterpret_cast<Recompiled::EXPORT>(dlsym(handle, Recompiled::SYMBOL));
+#endif
+
+    if (symbol == nullptr)
+    {
+      unload();
+      error = path + " is not a recompiled module";
+      return false;
+    }
+
+    if (!attach(symbol()))
+    {
+      std::string reason = error;
+      unload();
+      error = reason;
+      return false;
+    }
+    return true;
+  }
+
+  bool RecompiledModule::attach(const Recompiled::MODULE* m)
+  {
+    module = nullptr;
+    states.clear();
+    for (auto& page : pages)
+    {
+      page.reset();
+    }
+    translated = 0;
+    interpreted = 0;
+
+    if (m == nullptr || m->version != Recompiled::VERSION)
+    {
+      error = "Module was generated for another version";
+      return false;
+    }
+    if (m->options != Recompiled::BUILD_OPTIONS)
+    {
+      error = "Module was generated with other build options";
+      return false;
+    }
+
+    for (uint32_t i = 0; i < m->count; i++)
+    {
+      uint16_t addr = m->entries[i].address;
+      std::unique_ptr<Page>& page = pages[addr >> 8];
+      if (page == nullptr)
+      {
+        page = std::make_unique<Page>();
+        page->fill(-1);
+      }
+      (*page)[addr & 0xFF] = i;
+    }
+    states.resize(m->count);
+    module = m;
+    error.clear();
+    return true;
+  }
+
+  void RecompiledModule::unload()
+  {
+    module = nullptr;
+    states.clear();
+    for (auto& page : pages)
+    {
+      page.reset();
+    }
+
+    if (handle != nullptr)
+    {
+#ifdef _WIN32
+      FreeLibrary(static_cast<HMODULE>(handle));
+#else
+      dlclose(handle);
+#endif
+      handle = nullptr;
+    }
+  }
+
+  const Recompiled::ENTRY* RecompiledModule::find(Bus& bus, uint16_t addr)
+  {
+    Page* page = pages[addr >> 8].get();
+    if (page == nullptr || (*page)[addr & 0xFF] < 0)
+    {
+      return nullptr;
+    }
+
+    int32_t index = (*page)[addr & 0xFF];
+    const Recompiled::ENTRY& entry = module->entries[index];
+    STATE& state = states[index];
+
+    // Memory is only compared again once the pages have been written to
+    BlockCache& cache = bus.cpu.executioner.cache;
+    uint16_t end = entry.address + entry.size - 1;
+    uint32_t first = cache.getGeneration(entry.address);
+    uint32_t last = cache.getGeneration(end);
+    if (!state.checked || state.first != first || state.last != last)
+    {
+      state.matches = true;
+      for (uint16_t i = 0; i < entry.size && state.matches; i++)
+      {
+        state.matches = bus.read(entry.address + i, true) == entry.bytes[i];
+      }
+      state.first = first;
+      state.last = last;
+      state.checked = true;
+    }
+
+    return state.matches ? &entry : nullptr;
+  }
+
+  Processor::RUNRESULT RecompiledModule::run(Bus& bus, uint64_t cycles)
+  {
+    Processor& cpu = bus.cpu;
+    Processor::RUNRESULT result;
+    uint64_t start = cpu.total_cycles;
+
+    Recompiled::CONTEXT context;
+    context.bus = &bus;
+    context.read = [](void* bus, uint16_t addr)
+    {
+      return static_cast<Bus*>(bus)->read(addr, false);
+    };
+    context.write = [](void* bus, uint16_t addr, uint8_t data)
+    {
+      static_cast<Bus*>(bus)->write(addr, data);
+    };
+
+    while (cpu.total_cycles - start < cycles)
+    {
+      if (cpu.getFault() != Processor::NONE)
+      {
+        result.reason = Processor::FAULT;
+        break;
+      }
+
+      // Blocks are translated from the opcode table of one variant, the
+      // others are interpreted
+      const Recompiled::ENTRY* entry = nullptr;
+      if (module != nullptr && cpu.executioner.getVariant() == (Executioner::VARIANT)module->variant && !cpu.TriggerNmi && !cpu.TriggerIRQ)
+      {
+        entry = find(bus, cpu.reg.PC);
+      }
+
+      if (entry == nullptr)
+      {
+        uint32_t executed = cpu.executioner.run(1);
+        if (executed == 0)
+        {
+          result.reason = Processor::FAULT;
+          break;
+        }
+        result.instructions += executed;
+        interpreted += executed;
+        continue;
+      }
+
+      context.AC = cpu.reg.AC;
+      context.X = cpu.reg.X;
+      context.Y = cpu.reg.Y;
+      context.SP = cpu.reg.SP;
+      context.PC = cpu.reg.PC;
+      context.SR = cpu.reg.SR;
+      context.cycles = 0;
+      context.instructions = 0;
+
+      entry->block(context);
+
+      cpu.reg.AC = context.AC;
+      cpu.reg.X = context.X;
+      cpu.reg.Y = context.Y;
+      cpu.reg.SP = context.SP;
+      cpu.reg.PC = context.PC;
+      cpu.reg.SR = context.SR;
+
+      cpu.total_cycles += context.cycles;
+      cpu.cycle_count += (uint8_t)context.cycles;
+      cpu.clock_count += (uint32_t)context.instructions;
+      result.instructions += context.instructions;
+      translated += context.instructions;
+    }
+
+    if (result.reason != Processor::FAULT)
+    {
+      result.reason = Processor::CYCLES;
+    }
+    result.cycles = cpu.total_cycles - start;
+    return result;
+  }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Recompiled.hpp"
+#include "Processor.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CPU
+{
+  class Bus;
+
+  // Runs a module generated by the Recompiler. Execution goes through the
+  // translated blocks wherever one starts at the program counter, and falls
+  // back to the interpreter everywhere else: code the Recompiler couldn't
+  // find, untranslated instructions, pending interrupts, blocks whose bytes
+  // were overwritten since they were translated, and everything when the
+  // processor is another variant than the module was translated for.
+  //
+  // Interrupts are only taken between blocks, and a batch can overrun its
+  // cycle budget by the last block it runs.
+  class RecompiledModule
+  {
+  public:
+    RecompiledModule() = default;
+    ~RecompiledModule();
+
+    RecompiledModule(const RecompiledModule&) = delete;
+    RecompiledModule& operator=(const RecompiledModule&) = delete;
+
+    // Loads a module built as a shared library. Returns false if it can't
+    // be used, see getError()
+    bool load(const std::string& path);
+    // Uses a module linked into the program
+    bool attach(const Recompiled::MODULE* module);
+    void unload();
+
+    bool               isLoaded() { return module != nullptr; }
+    const std::string& getError() { return error; }
+
+    // Runs until at least the given number of cycles has been consumed
+    Processor::RUNRESULT run(Bus& bus, uint64_t cycles);
+
+    // Number of instructions run by translated blocks and by the interpreter
+    // since the module was loaded
+    uint64_t getTranslatedInstructions() { return translated; }
+    uint64_t getInterpretedInstructions() { return interpreted; }
+
+  private:
+    // Validity of a block, checked against the block cache generations of
+    // the pages it was translated from
+    struct STATE
+    {
+      uint32_t first = 0;
+      uint32_t last = 0;
+      bool     checked = false;
+      bool     matches = false;
+    };
+    typedef std::array<int32_t, 256> Page;
+
+    void*                              handle = nullptr;
+    const Recompiled::MODULE*          module = nullptr;
+    std::array<std::unique_ptr<Page>, 256> pages;
+    std::vector<STATE>                 states;
+    std::string                        error;
+
+    uint64_t translated = 0;
+    uint64_t interpreted = 0;
+
+    // Returns the block starting at the address if memory still holds its bytes
+    const Recompiled::ENTRY* find(Bus& bus, uint16_t addr);
+  };
+}
@@ -0,0 +1,491 @@
+#include "Recompiler.hpp"
+#include "Executioner.hpp"
+#include "Instructions.hpp"
+
+#include <algorithm>
+#ifdef SPDLOG_FMT_EXTERNAL
+#include <fmt/format.h>
+#else
+#include <spdlog/fmt/fmt.h>
+#endif
+
+namespace CPU
+{
+  typedef Executioner::Mnemonic Mnemonic;
+  typedef Executioner::AddressMode AddressMode;
+
+  Recompiler::Recompiler(const uint8_t* image, size_t size, uint16_t origin, Executioner::VARIANT variant)
+    : image(image, image + std::min(size, (size_t)0x10000 - origin)), origin(origin), variant(variant),
+      operations(variant == Executioner::WDC65C02 ? lookup65C02<Bus> : variant == Executioner::RICOH2A03 ? lookup2A03<Bus> : lookupNMOS<Bus, Executioner::MOS6502>)
+  {
+  }
+
+  void Recompiler::addEntryPoint(uint16_t addr)
+  {
+    entryPoints.push_back(addr);
+  }
+
+  void Recompiler::addVectors()
+  {
+    for (uint16_t vector : { 0xFFFA, 0xFFFC, 0xFFFE })
+    {
+      if (contains(vector, 2))
+      {
+        addEntryPoint(byte(vector) | (byte(vector + 1) << 8));
+      }
+    }
+  }
+
+  bool Recompiler::contains(uint32_t addr, size_t size)
+  {
+    return addr >= origin && addr + size <= origin + image.size();
+  }
+
+  uint8_t Recompiler::byte(uint16_t addr)
+  {
+    return image[addr - origin];
+  }
+
+  const char* Recompiler::variantName()
+  {
+    switch (variant)
+    {
+      case Executioner::WDC65C02:
+        return "WDC65C02";
+      case Executioner::RICOH2A03:
+        return "RICOH2A03";
+      default:
+        return "MOS6502";
+    }
+  }
+
+  bool Recompiler::translatable(uint8_t opcode)
+  {
+    const Executioner::OperationType& operation = operations[opcode];
+    // The documented instructions are listed first. The 65C02 gave some of
+    // them addressing modes of its own, and BIT an immediate mode that only
+    // sets Z
+    return operation.mnemonic <= Mnemonic::TYA && operation.mnemonic != Mnemonic::BRK && operation.mnemonic != Mnemonic::RTI &&
+      operation.mode != AddressMode::IZP && operation.mode != AddressMode::IAX &&
+      !(operation.mnemonic == Mnemonic::BIT && operation.mode == AddressMode::IMM);
+  }
+
+  bool Recompiler::endsBlock(uint8_t opcode)
+  {
+    switch (operations[opcode].mnemonic)
+    {
+      case Mnemonic::JMP:
+      case Mnemonic::JSR:
+      case Mnemonic::RTS:
+        return true;
+      default:
+        return (operations[opcode].policy & Executioner::BRANCH) != 0;
+    }
+  }
+
+  void Recompiler::analyze()
+  {
+    code.clear();
+    leaders.clear();
+    blocks.clear();
+
+    std::vector<uint16_t> work(entryPoints.rbegin(), entryPoints.rend());
+    leaders.insert(entryPoints.begin(), entryPoints.end());
+
+    auto follow = [&](uint32_t addr)
+    {
+      if (addr <= 0xFFFF)
+      {
+        work.push_back(addr);
+        leaders.insert(addr);
+      }
+    };
+
+    while (!work.empty())
+    {
+      uint32_t addr = work.back();
+      work.pop_back();
+
+      while (true)
+      {
+        if (code.count(addr))
+        {
+          // Joins code found before, which has to start a block
+          leaders.insert(addr);
+          break;
+        }
+
+        if (!contains(addr, 1) || !contains(addr, 1 + operations[byte(addr)].length))
+        {
+          break;
+        }
+
+        uint8_t opcode = byte(addr);
+        const Executioner::OperationType& operation = operations[opcode];
+        code[addr] = opcode;
+
+        uint32_t next = addr + 1 + operation.length;
+        uint16_t target = operation.length == 2 ? byte(addr + 1) | (byte(addr + 2) << 8) : 0x0000;
+
+        if (!translatable(opcode))
+        {
+          switch (operation.mnemonic)
+          {
+            case Mnemonic::BRK:
+              // RTI returns past the padding byte
+              follow(addr + 2);
+              break;
+            case Mnemonic::RTI:
+            case Mnemonic::JAM:
+            case Mnemonic::XXX:
+              break;
+            default:
+              if (operation.policy & Executioner::BRANCH)
+              {
+                // BRA of the 65C02
+                follow((next + (int8_t)byte(addr + 1)) & 0xFFFF);
+              }
+              follow(next);
+              break;
+          }
+          break;
+        }
+
+        if (operation.mnemonic == Mnemonic::JMP)
+        {
+          if (operation.mode == AddressMode::ABS)
+          {
+            follow(target);
+          }
+          else
+          {
+            // Guess the target from the pointer the image holds, the block is
+            // only used while memory still holds its bytes
+            uint16_t hi = variant == Executioner::WDC65C02 ? (target + 1) & 0xFFFF : (target & 0xFF00) | ((target + 1) & 0x00FF);
+            if (contains(target, 1) && contains(hi, 1))
+            {
+              follow(byte(target) | (byte(hi) << 8));
+            }
+          }
+          break;
+        }
+        if (operation.mnemonic == Mnemonic::JSR)
+        {
+          follow(target);
+          follow(next);
+          break;
+        }
+        if (operation.mnemonic == Mnemonic::RTS)
+        {
+          break;
+        }
+        if (operation.policy & Executioner::BRANCH)
+        {
+          uint8_t offset = byte(addr + 1);
+          follow((next + (int8_t)offset) & 0xFFFF);
+          follow(next);
+          break;
+        }
+        addr = next;
+      }
+    }
+
+    for (uint16_t leader : leaders)
+    {
+      if (!code.count(leader) || !translatable(code[leader]))
+      {
+        continue;
+      }
+
+      BLOCK block;
+      block.address = leader;
+      uint32_t addr = leader;
+      uint32_t next;
+      while (true)
+      {
+        block.instructions.push_back(addr);
+        next = addr + 1 + operations[code[addr]].length;
+        if (endsBlock(code[addr]) || next > 0xFFFF || leaders.count(next) || !code.count(next) || !translatable(code[next]))
+        {
+          break;
+        }
+        addr = next;
+      }
+      block.size = next - leader;
+      blocks[leader] = block;
+    }
+  }
+
+  void Recompiler::emit(std::ostream& out, const std::string& name)
+  {
+    out << "// 6502 module generated by the Recompiler";
+    if (!name.empty())
+    {
+      out << " from " << name;
+    }
+    out << "\n\n";
+
+    // The operations must behave like the ones of the runtime
+#ifdef DECIMAL_MODE
+    out << "#define DECIMAL_MODE 1\n";
+#endif
+    out << "#include \"Recompiled.hpp\"\n\n";
+    out << "using namespace CPU::Recompiled;\n\n";
+    out << "namespace\n{\n";
+
+    for (const auto& [address, block] : blocks)
+    {
+      emitBlock(out, block);
+    }
+
+    out << "  const ENTRY entries[] = {\n";
+    for (const auto& [address, block] : blocks)
+    {
+      out << fmt::format("    {{ 0x{0:04X}, {1}, bytes_{0:04X}, &block_{0:04X} }},\n", address, block.size);
+    }
+    out << "  };\n\n";
+
+    out << fmt::format("  const MODULE module = {{ VERSION, BUILD_OPTIONS, {}, {}, entries }};\n", variantName(), blocks.size());
+    out << "}\n\n";
+
+    out << "extern \"C\"\n";
+    out << "#ifdef _WIN32\n__declspec(dllexport)\n#else\n__attribute__((visibility(\"default\")))\n#endif\n";
+    out << "const MODULE* recompiled6502()\n{\n  return &module;\n}\n";
+  }
+
+  void Recompiler::emitBlock(std::ostream& out, const BLOCK& block)
+  {
+    out << fmt::format("  const uint8_t bytes_{:04X}[] = {{", block.address);
+    for (uint16_t i = 0; i < block.size; i++)
+    {
+      out << fmt::format("{}0x{:02X}", i ? ", " : " ", byte(block.address + i));
+    }
+    out << " };\n\n";
+
+    out << fmt::format("  void block_{:04X}(CONTEXT& c)\n  {{\n", block.address);
+    for (size_t i = 0; i < block.instructions.size(); i++)
+    {
+      emitInstruction(out, block, i);
+    }
+
+    uint16_t last = block.instructions.back();
+    if (!endsBlock(byte(last)))
+    {
+      out << fmt::format("    c.PC = 0x{:04X};\n", (block.address + block.size) & 0xFFFF);
+      out << fmt::format("    c.instructions += {};\n", block.instructions.size());
+    }
+    out << "  }\n\n";
+  }
+
+  void Recompiler::emitInstruction(std::ostream& out, const BLOCK& block, size_t index)
+  {
+    uint16_t addr = block.instructions[index];
+    uint8_t opcode = byte(addr);
+    const Executioner::OperationType& operation = operations[opcode];
+
+    uint8_t  lo = operation.length > 0 ? byte(addr + 1) : 0x00;
+    uint8_t  hi = operation.length > 1 ? byte(addr + 2) : 0x00;
+    uint16_t operand = lo | (hi << 8);
+    uint16_t next = addr + 1 + operation.length;
+    size_t   executed = index + 1;
+
+    out << fmt::format("    // ${:04X}: {}:{}", addr, operation.operate.name, operation.addrmode.name);
+    for (uint8_t i = 0; i <= operation.length; i++)
+    {
+      out << fmt::format(" {:02X}", byte(addr + i));
+    }
+    out << "\n    {\n";
+
+    // The effective address, or the value for immediate addressing
+    std::string address;
+    std::string crossed;
+    switch (operation.mode)
+    {
+      case AddressMode::IMM:
+        address = fmt::format("0x{:02X}", lo);
+        break;
+      case AddressMode::ZP0:
+        address = fmt::format("0x{:04X}", lo);
+        break;
+      case AddressMode::ZPX:
+        address = fmt::format("(uint8_t)(0x{:02X} + c.X)", lo);
+        break;
+      case AddressMode::ZPY:
+        address = fmt::format("(uint8_t)(0x{:02X} + c.Y)", lo);
+        break;
+      case AddressMode::ABS:
+        address = fmt::format("0x{:04X}", operand);
+        break;
+      case AddressMode::ABX:
+      case AddressMode::ABY:
+        out << fmt::format("      uint16_t a = 0x{:04X} + c.{};\n", operand, operation.mode == AddressMode::ABX ? "X" : "Y");
+        address = "a";
+        crossed = fmt::format("((a & 0xFF00) != 0x{:04X})", hi << 8);
+        break;
+      case AddressMode::IZX:
+        out << fmt::format("      uint8_t t = 0x{:02X} + c.X;\n", lo);
+        out << "      uint16_t a = read(c, t);\n";
+        out << "      a |= read(c, (uint8_t)(t + 1)) << 8;\n";
+        address = "a";
+        break;
+      case AddressMode::IZY:
+        out << fmt::format("      uint16_t p = read(c, 0x{:02X});\n", lo);
+        out << fmt::format("      p |= read(c, 0x{:02X}) << 8;\n", (uint8_t)(lo + 1));
+        out << "      uint16_t a = p + c.Y;\n";
+        address = "a";
+        crossed = "((a & 0xFF00) != (p & 0xFF00))";
+        break;
+      case AddressMode::IND:
+        // Page boundary hardware bug, see Executioner::IND()
+        if (variant != Executioner::WDC65C02 && lo == 0xFF)
+        {
+          out << fmt::format("      uint16_t a = read(c, 0x{:04X}) << 8;\n", operand & 0xFF00);
+        }
+        else
+        {
+          out << fmt::format("      uint16_t a = read(c, 0x{:04X}) << 8;\n", (operand + 1) & 0xFFFF);
+        }
+        out << fmt::format("      a |= read(c, 0x{:04X});\n", operand);
+        address = "a";
+        break;
+      default:
+        break;
+    }
+
+    std::string value = operation.mode == AddressMode::IMM ? address : fmt::format("read(c, {})", address);
+
+    // Base cycles, and the page crossing penalty of indexed reads
+    if (!crossed.empty() && (operation.policy & Executioner::PAGE_CROSS))
+    {
+      out << fmt::format("      c.cycles += {} + {};\n", operation.cycles, crossed);
+    }
+    else
+    {
+      out << fmt::format("      c.cycles += {};\n", operation.cycles);
+    }
+
+    // Leaves the block when a write changed one of its instructions
+    auto check = [&](const std::string& written)
+    {
+      out << fmt::format("      if ((uint16_t)({} - 0x{:04X}) < {})\n", written, block.address, block.size);
+      out << fmt::format("      {{\n        c.PC = 0x{:04X};\n        c.instructions += {};\n        return;\n      }}\n", next, executed);
+    };
+    auto store = [&](const std::string& data)
+    {
+      out << fmt::format("      write(c, {}, {});\n", address, data);
+      check(address);
+    };
+    auto modify = [&](const std::string& function)
+    {
+      if (operation.mode == AddressMode::ACC)
+      {
+        out << fmt::format("      c.AC = {}(c, c.AC);\n", function);
+      }
+      else
+      {
+        out << fmt::format("      modify(c, {}, {});\n", address, function);
+        check(address);
+      }
+    };
+    auto push = [&](const std::string& data)
+    {
+      out << fmt::format("      push(c, {});\n", data);
+      if (block.address <= 0x01FF && block.address + block.size > 0x0100)
+      {
+        check("(0x100 + (uint8_t)(c.SP + 1))");
+      }
+    };
+    auto branch = [&](const std::string& condition)
+    {
+      uint16_t target = (next + (int8_t)lo) & 0xFFFF;
+      uint8_t penalty = (target & 0xFF00) != (next & 0xFF00) ? 2 : 1;
+      out << fmt::format("      c.instructions += {};\n", executed);
+      out << fmt::format("      if ({})\n      {{\n", condition);
+      out << fmt::format("        c.cycles += {};\n        c.PC = 0x{:04X};\n", penalty, target);
+      out << fmt::format("      }}\n      else\n      {{\n        c.PC = 0x{:04X};\n      }}\n", next);
+    };
+
+    switch (operation.mnemonic)
+    {
+      case Mnemonic::LDA: out << fmt::format("      c.AC = setNZ(c, {});\n", value); break;
+      case Mnemonic::LDX: out << fmt::format("      c.X = setNZ(c, {});\n", value); break;
+      case Mnemonic::LDY: out << fmt::format("      c.Y = setNZ(c, {});\n", value); break;
+      case Mnemonic::STA: store("c.AC"); break;
+      case Mnemonic::STX: store("c.X"); break;
+      case Mnemonic::STY: store("c.Y"); break;
+
+      case Mnemonic::ADC: out << fmt::format("      adc<{}>(c, {});\n", variantName(), value); break;
+      case Mnemonic::SBC: out << fmt::format("      sbc<{}>(c, {});\n", variantName(), value); break;
+      case Mnemonic::AND: out << fmt::format("      c.AC = setNZ(c, c.AC & {});\n", value); break;
+      case Mnemonic::ORA: out << fmt::format("      c.AC = setNZ(c, c.AC | {});\n", value); break;
+      case Mnemonic::EOR: out << fmt::format("      c.AC = setNZ(c, c.AC ^ {});\n", value); break;
+      case Mnemonic::CMP: out << fmt::format("      compare(c, c.AC, {});\n", value); break;
+      case Mnemonic::CPX: out << fmt::format("      compare(c, c.X, {});\n", value); break;
+      case Mnemonic::CPY: out << fmt::format("      compare(c, c.Y, {});\n", value); break;
+      case Mnemonic::BIT: out << fmt::format("      bit(c, {});\n", value); break;
+
+      case Mnemonic::ASL: modify("asl"); break;
+      case Mnemonic::LSR: modify("lsr"); break;
+      case Mnemonic::ROL: modify("rol"); break;
+      case Mnemonic::ROR: modify("ror"); break;
+      case Mnemonic::INC: modify("inc"); break;
+      case Mnemonic::DEC: modify("dec"); break;
+
+      case Mnemonic::INX: out << "      c.X = setNZ(c, c.X + 1);\n"; break;
+      case Mnemonic::INY: out << "      c.Y = setNZ(c, c.Y + 1);\n"; break;
+      case Mnemonic::DEX: out << "      c.X = setNZ(c, c.X - 1);\n"; break;
+      case Mnemonic::DEY: out << "      c.Y = setNZ(c, c.Y - 1);\n"; break;
+      case Mnemonic::TAX: out << "      c.X = setNZ(c, c.AC);\n"; break;
+      case Mnemonic::TAY: out << "      c.Y = setNZ(c, c.AC);\n"; break;
+      case Mnemonic::TXA: out << "      c.AC = setNZ(c, c.X);\n"; break;
+      case Mnemonic::TYA: out << "      c.AC = setNZ(c, c.Y);\n"; break;
+      case Mnemonic::TSX: out << "      c.X = setNZ(c, c.SP);\n"; break;
+      case Mnemonic::TXS: out << "      c.SP = c.X;\n"; break;
+
+      case Mnemonic::CLC: out << "      setFlag(c, C, false);\n"; break;
+      case Mnemonic::SEC: out << "      setFlag(c, C, true);\n"; break;
+      case Mnemonic::CLI: out << "      setFlag(c, I, false);\n"; break;
+      case Mnemonic::SEI: out << "      setFlag(c, I, true);\n"; break;
+      case Mnemonic::CLD: out << "      setFlag(c, D, false);\n"; break;
+      case Mnemonic::SED: out << "      setFlag(c, D, true);\n"; break;
+      case Mnemonic::CLV: out << "      setFlag(c, V, false);\n"; break;
+
+      case Mnemonic::PHA: push("c.AC"); break;
+      case Mnemonic::PHP: push("c.SR | B | U"); break;
+      case Mnemonic::PLA: out << "      c.AC = setNZ(c, pop(c));\n"; break;
+      case Mnemonic::PLP: out << "      c.SR = pop(c) | U;\n"; break;
+
+      case Mnemonic::BCC: branch("!(c.SR & C)"); break;
+      case Mnemonic::BCS: branch("c.SR & C"); break;
+      case Mnemonic::BNE: branch("!(c.SR & Z)"); break;
+      case Mnemonic::BEQ: branch("c.SR & Z"); break;
+      case Mnemonic::BPL: branch("!(c.SR & N)"); break;
+      case Mnemonic::BMI: branch("c.SR & N"); break;
+      case Mnemonic::BVC: branch("!(c.SR & V)"); break;
+      case Mnemonic::BVS: branch("c.SR & V"); break;
+
+      case Mnemonic::JMP:
+        out << fmt::format("      c.PC = {};\n", address);
+        out << fmt::format("      c.instructions += {};\n", executed);
+        break;
+      case Mnemonic::JSR:
+        out << fmt::format("      push(c, 0x{:02X});\n", ((next - 1) >> 8) & 0xFF);
+        out << fmt::format("      push(c, 0x{:02X});\n", (next - 1) & 0xFF);
+        out << fmt::format("      c.PC = {};\n", address);
+        out << fmt::format("      c.instructions += {};\n", executed);
+        break;
+      case Mnemonic::RTS:
+        out << "      uint16_t pc = pop(c);\n";
+        out << "      pc |= pop(c) << 8;\n";
+        out << "      c.PC = pc + 1;\n";
+        out << fmt::format("      c.instructions += {};\n", executed);
+        break;
+
+      case Mnemonic::NOP:
+      default:
+        break;
+    }
+
+    out << "    }\n";
+  }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <set>
+#include <vector>
+#include <string>
+#include <ostream>
+
+#include "Executioner.hpp"
+
+namespace CPU
+{
+  // Ahead of time translation of a 6502 binary into a C++ module, see
+  // Recompiled.hpp for the interface and RecompiledModule for the runtime.
+  //
+  // Code is found by recursive descent: starting at the entry points the flow
+  // of control is followed through branches, jumps and subroutine calls, and
+  // the instructions found are split into basic blocks. Every block becomes a
+  // function in the generated module. Computed jumps (JMP indirect, RTS, RTI)
+  // have their targets looked up at runtime, JMP indirect is also followed
+  // through the pointer held by the image. Code that wasn't found is run by
+  // the interpreter.
+  //
+  // BRK, RTI, illegal opcodes and the opcodes & addressing modes added by the
+  // 65C02 are never translated, the interpreter runs them between blocks.
+  // The module only runs on the variant it was translated for.
+  class Recompiler
+  {
+  public:
+    // The image holds the bytes of the binary, loaded at the origin, and is
+    // decoded with the opcode table of the variant
+    Recompiler(const uint8_t* image, size_t size, uint16_t origin, Executioner::VARIANT variant = Executioner::MOS6502);
+
+    // Adds an address execution can start from
+    void addEntryPoint(uint16_t addr);
+    // Adds the NMI, RESET & IRQ vectors as entry points, if the image holds them
+    void addVectors();
+
+    struct BLOCK
+    {
+      // Address of the first instruction
+      uint16_t address = 0x0000;
+      // Number of bytes of the instructions
+      uint16_t size = 0;
+      // Address of every instruction of the block
+      std::vector<uint16_t> instructions;
+    };
+
+    // Finds the code reachable from the entry points and splits it into
+    // basic blocks
+    void analyze();
+    const std::map<uint16_t, BLOCK>& getBlocks() { return blocks; }
+
+    // Writes the C++ translation unit of the module, build it as a shared
+    // library with the Processor directory on the include path
+    void emit(std::ostream& out, const std::string& name = "");
+
+  private:
+    std::vector<uint8_t> image;
+    uint16_t             origin = 0x0000;
+    Executioner::VARIANT variant = Executioner::MOS6502;
+    // The opcode table of the variant
+    const std::array<Executioner::OperationType, 256>& operations;
+
+    std::vector<uint16_t>        entryPoints;
+    // Opcode of every instruction found
+    std::map<uint16_t, uint8_t>  code;
+    // Addresses a block starts at
+    std::set<uint16_t>           leaders;
+    std::map<uint16_t, BLOCK>    blocks;
+
+    // True if the image holds the bytes from the address
+    bool    contains(uint32_t addr, size_t size);
+    uint8_t byte(uint16_t addr);
+    // Name of the variant in Recompiled.hpp
+    const char* variantName();
+    // True if the opcode can be translated, the interpreter runs the others
+    bool translatable(uint8_t opcode);
+    // True if the opcode changes the flow of control, which ends a block
+    bool endsBlock(uint8_t opcode);
+
+    void emitBlock(std::ostream& out, const BLOCK& block);
+    void emitInstruction(std::ostream& out, const BLOCK& block, size_t index);
+  };
+}
@@ -25,7 +25,7 @@
 
 namespace CPU
 {
-  class Executioner;
+  template <typename BusT> class BasicExecutioner;
 
   // A convenient utility to search map-based types
   // after a specific value (needle).
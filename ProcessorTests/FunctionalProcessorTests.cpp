@@ -4,6 +4,7 @@
 
 #include <catch2/catch_all.hpp>
 #include <string>
+#include <chrono>
 //#include <sstream>
 
 #include <fmt/format.h>
@@ -22,7 +23,7 @@ namespace CPUTest
 
 #ifdef TEST_FUNC
 
-FunctionalProcessorTests::PROGRAMDATA KdTestProgram = FunctionalProcessorTests::loadFunctionFile("6502_functional_test.bin");
+Loader::IMAGE KdTestProgram = FunctionalProcessorTests::loadFunctionFile("6502_functional_test.bin", 0x400);
 
 /** 
  * Each Test Case in Klaus_Dormann's Functional Test Program. 
@@ -101,18 +102,114 @@ TEST_CASE("Klaus Dorman Functional Test", "[KlausDormann][functional]")
     fmt::format("Klaus_Dormann's Functional Test Program - TestCase: (0x{:02X}, 0x{:4X}) works", accumulator, programCounter)
   ) {
     bus.cpu.reset();
-    bus.cpu.LoadProgram(0x400, KdTestProgram.program, KdTestProgram.size, 0x400);
+    bus.cpu.LoadImage(KdTestProgram, true);
     bus.cpu.tick();
     bus.cpu.tick();
 
     REQUIRE(hex(bus.cpu.getRegister(bus.cpu.AC), 2) == hex(0x00, 2));
   }
 }
+
+/**
+ * Every dispatch engine must execute the functional test program exactly like
+ * the reference engine (member function pointers via the opcode table).
+ * The reference runs until the program traps (jumps to itself), after which the
+ * engine under test runs the same number of instructions in one batch.
+ */
+TEST_CASE("Dispatch Engines Match Reference On Functional Test", "[KlausDormann][functional][dispatch]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  auto engine = GENERATE(
+    Executioner::SWITCH,
+    Executioner::THREADED,
+    Executioner::TAILCALL,
+    Executioner::JIT,
+    Executioner::SUPERINSTRUCTION
+  );
+
+  Bus reference;
+  reference.cpu.executioner.setDispatch(Executioner::TABLE);
+  reference.cpu.LoadImage(KdTestProgram, true);
+
+  uint32_t instructions = 0;
+  uint16_t programCounter;
+  do
+  {
+    programCounter = reference.cpu.getProgramCounter();
+    instructions += reference.cpu.runInstructions(1).instructions;
+  } while (reference.cpu.getProgramCounter() != programCounter && instructions < 100000000);
+
+  Bus bus;
+  bus.cpu.executioner.setDispatch(engine);
+  bus.cpu.LoadImage(KdTestProgram, true);
+
+  DYNAMIC_SECTION(fmt::format("Dispatch engine {} runs {} instructions", (int) engine, instructions))
+  {
+    REQUIRE(bus.cpu.runInstructions(instructions).instructions == instructions);
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(reference.cpu.getProgramCounter(), 4));
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.AC), 2) == hex(reference.cpu.getRegister(reference.cpu.AC), 2));
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.X), 2) == hex(reference.cpu.getRegister(reference.cpu.X), 2));
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.Y), 2) == hex(reference.cpu.getRegister(reference.cpu.Y), 2));
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.SP), 2) == hex(reference.cpu.getRegister(reference.cpu.SP), 2));
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.SR), 2) == hex(reference.cpu.getRegister(reference.cpu.SR), 2));
+    REQUIRE(bus.cpu.clock_count == reference.cpu.clock_count);
+    REQUIRE(bus.cpu.cycle_count == reference.cpu.cycle_count);
+    REQUIRE(bus.ram == reference.ram);
+  }
+}
+
+/**
+ * Measures the speed of each dispatch engine in million instructions per second,
+ * run with: tests "[benchmark]"
+ */
+TEST_CASE("Dispatch Engine Benchmark", "[.][benchmark][dispatch]")
+{
+  auto [engine, name] = GENERATE( table<Executioner::DISPATCH, std::string>({
+    {Executioner::TABLE,            "TABLE"},
+    {Executioner::SWITCH,           "SWITCH"},
+    {Executioner::THREADED,         "THREADED"},
+    {Executioner::TAILCALL,         "TAILCALL"},
+    {Executioner::JIT,              "JIT"},
+    {Executioner::SUPERINSTRUCTION, "SUPERINSTRUCTION"},
+  }));
+
+  const uint32_t instructions = 10000000;
+
+  Bus bus;
+  bus.cpu.executioner.setDispatch(engine);
+  bus.cpu.LoadImage(KdTestProgram, true);
+
+  auto start = std::chrono::steady_clock::now();
+  uint64_t executed = bus.cpu.runInstructions(instructions).instructions;
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << fmt::format("Dispatch engine {: <16} - {:.2f} MIPS", name, executed / elapsed.count() / 1000000) << std::endl;
+  REQUIRE(executed == instructions);
+}
 #endif
 
 #ifdef TEST_IRQ
 
-FunctionalProcessorTests::PROGRAMDATA InterruptProgram = FunctionalProcessorTests::loadFunctionFile("6502_interrupt_test.bin");
+Loader::IMAGE InterruptProgram = FunctionalProcessorTests::loadFunctionFile("6502_interrupt_test.bin", 0x400);
+
+// The feedback port of the test program, bit 0 drives the IRQ line and bit 1
+// the NMI line
+class InterruptPort : public CPU::Device
+{
+public:
+  uint8_t read(uint16_t /*addr*/) override { return value; }
+  uint8_t peek(uint16_t /*addr*/) override { return value; }
+  void write(uint16_t /*addr*/, uint8_t data) override
+  {
+    value = data;
+    setIrq((value & 1) != 0);
+    setNmi((value & 2) != 0);
+  }
+
+private:
+  uint8_t value = 0;
+};
 
 TEST_CASE("Klaus Dormann Interrupt Test", "[KlausDormann][interrupt]")
 {
@@ -124,36 +221,18 @@ TEST_CASE("Klaus Dormann Interrupt Test", "[KlausDormann][interrupt]")
   }));
 
   Bus bus;
+  InterruptPort port;
+  bus.attach(port, 0xbffc, 0xbffc);
 
   DYNAMIC_SECTION(
     fmt::format("Klaus Dormann's Interrupt Test Program - TestGroup: 0x{:04X}", programCounter)
   ) {
     bus.cpu.reset();
-    bus.cpu.LoadProgram(0x400, InterruptProgram.program, InterruptProgram.size, 0x400);
+    bus.cpu.LoadImage(InterruptProgram, true);
     uint32_t numberOfCycles = 0;
-    uint8_t  previousInterruptWatchValue = 0,
-             interruptWatch;
 
     while(true)
     {
-      interruptWatch = bus.read(0xbffc);
-
-      //This is used to simulate the edge triggering of an NMI. If we didn't do this we would get stuck in a loop forever
-      if (interruptWatch != previousInterruptWatchValue)
-      {
-        previousInterruptWatchValue = interruptWatch;
-
-        if ((interruptWatch & 2) != 0)
-        {
-          bus.cpu.TriggerNmi = true;
-        }
-      }
-
-      if (!bus.cpu.GetFlag(CPU::Processor::FLAGS6502::I) && (interruptWatch & 1) != 0)
-      {
-        bus.cpu.TriggerIRQ = true;
-      }
-
       bus.cpu.tick();
       numberOfCycles++;
 
@@ -172,7 +251,7 @@ TEST_CASE("Klaus Dormann Interrupt Test", "[KlausDormann][interrupt]")
 
 #ifdef TEST_TIME
 
-FunctionalProcessorTests::PROGRAMDATA CycleProgram = FunctionalProcessorTests::loadFunctionFile("6502_cycle_test.bin");
+Loader::IMAGE CycleProgram = FunctionalProcessorTests::loadFunctionFile("6502_cycle_test.bin", 0x0000);
 std::vector<FunctionalProcessorTests::TESTDATA> CycleTestDataResults = FunctionalProcessorTests::loadCycleTestResults("cycle_test_data.csv", ",");
 
 /**
@@ -185,33 +264,31 @@ TEST_CASE("Ed Spittles - Cycle Test", "[EdSpittles][timing][cycle]")
   Bus bus;
 
   bus.cpu.reset();
-  bus.cpu.LoadProgram(0x0000, CycleProgram.program, CycleProgram.size, 0x00);
-  uint16_t numberOfLoops = 1;
-  
+  bus.cpu.LoadImage(CycleProgram, true);
+  uint16_t numberOfInstructions = 0;
+
+  // The test data has a row per cycle, tick() runs an instruction. After it
+  // the row of the current cycle is the fetch of the next opcode
   while(true)
   {
-    if (numberOfLoops == 0xF9)
-    {
-      
-    }
-
     bus.cpu.tick();
 
-    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(CycleTestDataResults[numberOfLoops].PC, 4));
-    REQUIRE(hex(bus.cpu.cycle_count, 4) == hex(CycleTestDataResults[numberOfLoops].CC, 4));
+    const FunctionalProcessorTests::TESTDATA& expected = CycleTestDataResults.at(bus.cpu.total_cycles);
+    REQUIRE(expected.SYNC);
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(expected.PC, 4));
 
-    numberOfLoops++;
+    numberOfInstructions++;
 
     if(bus.cpu.getProgramCounter() == 0x1266)
     {
       break;
     }
 
-    if (numberOfLoops > 500) {
-      FAIL("Maximum Number of Cycles Exceeded.");
+    if (numberOfInstructions > 500) {
+      FAIL("Maximum Number of Instructions Exceeded.");
     }
   }
-  REQUIRE(hex(bus.cpu.cycle_count, 4) == hex(0x0474, 4));
+  REQUIRE(hex(bus.cpu.total_cycles, 4) == hex(0x0474, 4));
 }
 #endif
 
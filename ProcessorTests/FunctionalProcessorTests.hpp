@@ -2,6 +2,7 @@
 
 #include "MainTest.hpp"
 #include <Types.hpp>
+#include <Loader.hpp>
 
 #include <string>
 #include <sstream>
@@ -28,10 +29,8 @@ namespace CPUTest
   class FunctionalProcessorTests
   {
   private:
-    static std::fstream loadFile(std::string filename, std::ios::openmode openmode = std::ios::in)
+    static std::filesystem::path getFilePath(std::string filename)
     {
-      std::fstream fp;
-
 #ifdef TESTDIR
       //std::filesystem::path filepath = STRINGIZE(TESTDIR);
       std::filesystem::path filepath = std::string(STRINGIZE(TESTDIR));
@@ -45,6 +44,13 @@ namespace CPUTest
         std::cout << "File not found\n"
           << "Filepath: " << filepath << "\n";
       }
+      return filepath;
+    }
+
+    static std::fstream loadFile(std::string filename, std::ios::openmode openmode = std::ios::in)
+    {
+      std::fstream fp;
+      std::filesystem::path filepath = getFilePath(filename);
 
       try {
         fp.open(filepath, openmode);
@@ -71,15 +77,6 @@ namespace CPUTest
     }
 
   public:
-    struct PROGRAMDATA
-    {
-      // Program
-      uint8_t * program;
-      //std::vector<uint8_t> program;
-      // Program Size
-      size_t size = 0x00;
-    };
-
     struct TESTDATA
     {
       // 8-bit - Accumulator Register
@@ -96,66 +93,28 @@ namespace CPUTest
       uint8_t  SR = 0x00;
       // 32-bit - Cycles
       uint32_t CC = 0x00;
+      // True on the cycle an opcode is fetched
+      bool     SYNC = false;
     };
 
-    static PROGRAMDATA loadFunctionFile(std::string filename)
+    // The binaries are raw images, mapped by the Loader. The program starts
+    // where it is loaded
+    static Loader::IMAGE loadFunctionFile(std::string filename, uint16_t address)
     {
-      PROGRAMDATA data;
+      Loader::IMAGE image;
 
       try {
-        std::fstream fp = loadFile(filename, std::ios::in | std::ios::binary);
-        if (!fp)
-        {
-          std::cout << "Nope, cannot open file \"" << filename << "\" " << std::endl;
-          exit(1);
-        }
-
-        if(fp.is_open())
-        {
-          std::streampos fsize = 0;
-          fsize = fp.tellg();
-          fp.seekg( 0, std::ios::end );
-          fsize = fp.tellg() - fsize;
-          fp.seekg( 0, std::ios::beg );
-
-          std::cout << "Loaded file: \"" << filename << "\" - Size: " << fsize << " bytes.\n";
-
-          std::vector<uint8_t> program;
-          int i, j;
-          while(fp.good())
-          {
-            char c[16];
-            for(i = 0; i < 16 && fp.good(); i++)
-            {
-              fp.get(c[i]);
-            }
-            if (i < 16)
-            {
-              --i;
-            }
-            for(j = 0; j < i; j++)
-            {
-              program.push_back((uint8_t) c[(i - 1)]);
-            }
-          }
-          fp.close();
-
-          data = {
-            .program = program.data(),
-            .size    = program.size()
-          };
-
-          std::cout << "Finished file: \"" << filename << "\" - Read " << data.size << " bytes worth of data.\n";
-        }
+        image = Loader::load(getFilePath(filename).string(), Loader::RAW, address);
+        image.entry = address;
 
+        size_t size = image.segments.empty() ? 0 : image.segments[0].bytes.size();
+        std::cout << "Loaded file: \"" << filename << "\" - Size: " << size << " bytes.\n";
       } catch (const std::exception& e) {
-        std::cout << "Caught an exception.\n"
+        std::cout << "Nope, cannot open file \"" << filename << "\" " << std::endl
                   << "Error code: " << e.what() << '\n';
-#ifdef DEBUG
-        print_exception(e);
-#endif
+        exit(1);
       }
-      return data;
+      return image;
     }
 
     static std::vector<TESTDATA> loadCycleTestResults(std::string filename, std::string delim = ",")
@@ -178,25 +137,23 @@ namespace CPUTest
               values.push_back(word);
             }
 
+            // One row per half cycle, the state is taken once per cycle
             if ((uint16_t)std::stoul(values.at(0), nullptr, 10) % 2 != 0)
             {
               lineNumber++;
               continue;
             }
 
-            if (values.size() == 9)
-            {
-              continue;
-            }
-
+            // The rows of the opcode fetches name the instruction
             TESTDATA data = {
-              .PC = (uint16_t) std::stoul(values.at(1), nullptr, 16),
-              .AC = (uint8_t)  std::stoul(values.at(2), nullptr, 16),
-              .X  = (uint8_t)  std::stoul(values.at(3), nullptr, 16),
-              .Y  = (uint8_t)  std::stoul(values.at(4), nullptr, 16),
-              .SR = (uint8_t)  std::stoul(values.at(5), nullptr, 16),
-              .SP = (uint8_t)  std::stoul(values.at(6), nullptr, 16),
-              .CC = (uint32_t) std::stoul(values.at(7), nullptr, 10)
+              .AC   = (uint8_t)  std::stoul(values.at(2), nullptr, 16),
+              .X    = (uint8_t)  std::stoul(values.at(3), nullptr, 16),
+              .Y    = (uint8_t)  std::stoul(values.at(4), nullptr, 16),
+              .SP   = (uint8_t)  std::stoul(values.at(6), nullptr, 16),
+              .PC   = (uint16_t) std::stoul(values.at(1), nullptr, 16),
+              .SR   = (uint8_t)  std::stoul(values.at(5), nullptr, 16),
+              .CC   = (uint32_t) std::stoul(values.at(7), nullptr, 10),
+              .SYNC = values.size() > 8
             };
 
             results.push_back(data);
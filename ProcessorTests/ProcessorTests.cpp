@@ -1,8 +1,20 @@
 #include "ProcessorTests.hpp"
 #include <Types.hpp>
+#include <Recompiler.hpp>
+#include <RecompiledModule.hpp>
+#include <Alu.hpp>
+#include <MemoryMap.hpp>
+#include <Mapper.hpp>
+#include <Loader.hpp>
 
 #include <catch2/catch_all.hpp>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <fmt/format.h>
 /*
@@ -70,15 +82,37 @@ TEST_CASE("Initialization Tests", "[init]")
   }
 
 #ifndef ILLEGAL
-  SECTION("Throws Exception When OpCode Is Invalid")
+  SECTION("Faults When OpCode Is Invalid")
   {
-    uint8_t program[] = {0xFF};
+    uint8_t program[] = {0xFF, 0xEA};
     size_t n = sizeof(program) / sizeof(program[0]);
     bus.cpu.LoadProgram(0x0000, program, n, 0x00);
-    REQUIRE_THROWS(bus.cpu.tick());
+    REQUIRE(bus.cpu.tick() == Processor::FAULT6502::INVALID_OPCODE);
+    REQUIRE(bus.cpu.getFault() == Processor::FAULT6502::INVALID_OPCODE);
+    REQUIRE(bus.cpu.runInstructions(1).instructions == 0);
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x0001, 4));
+  }
+#else
+  SECTION("Faults When Processor Is Jammed")
+  {
+    uint8_t program[] = {0x02, 0xEA};
+    size_t n = sizeof(program) / sizeof(program[0]);
+    bus.cpu.LoadProgram(0x0000, program, n, 0x00);
+    REQUIRE(bus.cpu.tick() == Processor::FAULT6502::JAMMED);
+    REQUIRE(bus.cpu.runInstructions(1).instructions == 0);
+
+    bus.cpu.reset();
+    REQUIRE(bus.cpu.getFault() == Processor::FAULT6502::NONE);
   }
 #endif
 
+  SECTION("Faults When Bus Is Not Connected")
+  {
+    Processor cpu;
+    REQUIRE(cpu.tick() == Processor::FAULT6502::UNCONNECTED_BUS);
+    REQUIRE(cpu.runInstructions(1).instructions == 0);
+  }
+
   SECTION("Stack Pointer Initializes To Default Value After Reset")
   {
     bus.cpu.reset();
@@ -99,6 +133,1518 @@ TEST_CASE("Initialization Tests", "[init]")
     REQUIRE(bus.cpu.GetFlag(Processor::FLAGS6502::V) == 0);
     REQUIRE(bus.cpu.GetFlag(Processor::FLAGS6502::N) == 0);
   }
+
+  SECTION("Hot State Is The First Cache Line Of Every Instance")
+  {
+    // LDX #n, INX, STX $00
+    std::vector<std::unique_ptr<Bus>> buses;
+    for (uint8_t i = 0; i < 16; i++)
+    {
+      buses.push_back(std::make_unique<Bus>());
+      uint8_t program[] = { 0xA2, i, 0xE8, 0x86, 0x00 };
+      buses.back()->cpu.LoadProgram(0x8000, program, sizeof(program), 0x8000);
+    }
+
+    for (uint8_t i = 0; i < 16; i++)
+    {
+      Processor& cpu = buses[i]->cpu;
+      REQUIRE((reinterpret_cast<uintptr_t>(&cpu) % CACHE_LINE) == 0);
+      REQUIRE(static_cast<void*>(static_cast<ProcessorState*>(&cpu)) == static_cast<void*>(&cpu));
+
+      cpu.runInstructions(3);
+      REQUIRE(buses[i]->read(0x0000) == i + 1);
+      REQUIRE(cpu.total_cycles == 7);
+    }
+  }
+}
+
+TEST_CASE("Decoded Operation Tests", "[init]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  Bus bus;
+
+  auto [opcode, mnemonic, addressMode, length] = GENERATE( table<uint8_t, Executioner::Mnemonic, Executioner::AddressMode, uint8_t>({
+    {0x0A, Executioner::Mnemonic::ASL, Executioner::AddressMode::ACC, 0},
+    {0xEA, Executioner::Mnemonic::NOP, Executioner::AddressMode::IMP, 0},
+    {0xA9, Executioner::Mnemonic::LDA, Executioner::AddressMode::IMM, 1},
+    {0xD0, Executioner::Mnemonic::BNE, Executioner::AddressMode::REL, 1},
+    {0x85, Executioner::Mnemonic::STA, Executioner::AddressMode::ZP0, 1},
+    {0xB4, Executioner::Mnemonic::LDY, Executioner::AddressMode::ZPX, 1},
+    {0xB6, Executioner::Mnemonic::LDX, Executioner::AddressMode::ZPY, 1},
+    {0x4C, Executioner::Mnemonic::JMP, Executioner::AddressMode::ABS, 2},
+    {0x7D, Executioner::Mnemonic::ADC, Executioner::AddressMode::ABX, 2},
+    {0xF9, Executioner::Mnemonic::SBC, Executioner::AddressMode::ABY, 2},
+    {0x6C, Executioner::Mnemonic::JMP, Executioner::AddressMode::IND, 2},
+    {0x01, Executioner::Mnemonic::ORA, Executioner::AddressMode::IZX, 1},
+    {0x91, Executioner::Mnemonic::STA, Executioner::AddressMode::IZY, 1},
+  }));
+
+  DYNAMIC_SECTION(fmt::format("OpCode 0x{:02X} Is Decoded As {}:{}", opcode, bus.cpu.executioner.getInstructionName(opcode), bus.cpu.executioner.getAddressModeName(opcode)))
+  {
+    REQUIRE(bus.cpu.executioner.getMnemonic(opcode) == mnemonic);
+    REQUIRE(bus.cpu.executioner.getAddressMode(opcode) == addressMode);
+    REQUIRE(bus.cpu.executioner.getOperandLength(opcode) == length);
+  }
+}
+
+TEST_CASE("Cycle Policy Tests", "[init][cycle]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  Bus bus;
+
+  auto [opcode, policy] = GENERATE( table<uint8_t, uint8_t>({
+    {0xA9, Executioner::NONE},          // LDA IMM
+    {0xBD, Executioner::PAGE_CROSS},    // LDA ABX
+    {0xB9, Executioner::PAGE_CROSS},    // LDA ABY
+    {0xB1, Executioner::PAGE_CROSS},    // LDA IZY
+    {0x9D, Executioner::INDEXED_WRITE}, // STA ABX
+    {0x99, Executioner::INDEXED_WRITE}, // STA ABY
+    {0x91, Executioner::INDEXED_WRITE}, // STA IZY
+    {0x1E, Executioner::INDEXED_WRITE}, // ASL ABX
+    {0xFE, Executioner::INDEXED_WRITE}, // INC ABX
+    {0x0E, Executioner::NONE},          // ASL ABS
+    {0xD0, Executioner::BRANCH},        // BNE REL
+  }));
+
+  DYNAMIC_SECTION(fmt::format("OpCode 0x{:02X} Has Cycle Policy {:d}", opcode, policy))
+  {
+    REQUIRE(bus.cpu.executioner.getCyclePolicy(opcode) == policy);
+  }
+}
+
+// Multiplies 10 by 3, it writes 0x0000 to 0x0002 and leaves 30 in $0002.
+// The run, memory map, dirty tracking, snapshot & block cache tests share it
+/*
+  *=$8000
+  LDX #10
+  STX $0000
+  LDX #3
+  STX $0001
+  LDY $0000
+  LDA #0
+  CLC
+  loop
+  ADC $0001
+  DEY
+  BNE loop
+  STA $0002
+  NOP
+*/
+static uint8_t batchProgram[] = {
+  0xA2, 0x0A, 0x8E, 0x00, 0x00, 0xA2, 0x03, 0x8E, 0x01, 0x00, 0xAC, 0x00, 0x00, 0xA9,
+  0x00, 0x18, 0x6D, 0x01, 0x00, 0x88, 0xD0, 0xFA, 0x8D, 0x02, 0x00, 0xEA
+};
+static const size_t batchProgramSize = sizeof(batchProgram) / sizeof(batchProgram[0]);
+
+TEST_CASE("Batch Run Tests", "[run]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  Bus bus;
+  bus.cpu.LoadProgram(0x8000, batchProgram, batchProgramSize, 0x8000);
+
+  SECTION("Runs A Number Of Instructions")
+  {
+    Processor::RUNRESULT result = bus.cpu.runInstructions(7);
+
+    REQUIRE(result.reason == Processor::STOP6502::INSTRUCTIONS);
+    REQUIRE(result.instructions == 7);
+    REQUIRE(result.cycles == 20);
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x8010, 4));
+  }
+
+  SECTION("Runs Until The Cycle Budget Is Used")
+  {
+    Processor::RUNRESULT result = bus.cpu.run(19);
+
+    REQUIRE(result.reason == Processor::STOP6502::CYCLES);
+    REQUIRE(result.instructions == 7);
+    REQUIRE(result.cycles == 20);
+  }
+
+  SECTION("Runs Until The Address Is Reached")
+  {
+    Processor::RUNRESULT result = bus.cpu.runUntil(0x8019);
+
+    REQUIRE(result.reason == Processor::STOP6502::ADDRESS);
+    REQUIRE(result.instructions == 38);
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x8019, 4));
+    REQUIRE(hex(bus.read(0x0002), 2) == hex(30, 2));
+  }
+
+  SECTION("Runs Until The Predicate Is True")
+  {
+    Processor::RUNRESULT result = bus.cpu.runUntil([](Processor& cpu) {
+      return cpu.getRegister(Processor::REGISTER6502::Y) == 5;
+    });
+
+    REQUIRE(result.reason == Processor::STOP6502::PREDICATE);
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.Y), 2) == hex(0x05, 2));
+  }
+
+  SECTION("Cycle Budget Stops Before The Address Is Reached")
+  {
+    Processor::RUNRESULT result = bus.cpu.runUntil(0x8019, 20);
+
+    REQUIRE(result.reason == Processor::STOP6502::CYCLES);
+    REQUIRE(result.instructions == 7);
+  }
+}
+
+TEST_CASE("Memory Map Tests", "[run][memorymap]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  SECTION("RAM Only Map Runs Like The Bus")
+  {
+    Bus reference;
+    MappedBus<MemoryMap<RAM<0x0000, 0xFFFF>>> bus;
+    reference.cpu.LoadProgram(0x8000, batchProgram, batchProgramSize, 0x8000);
+    bus.cpu.LoadProgram(0x8000, batchProgram, batchProgramSize, 0x8000);
+
+    Processor::RUNRESULT expected = reference.cpu.runUntil(0x8019);
+    Processor::RUNRESULT result = bus.cpu.runUntil(0x8019);
+
+    REQUIRE(result.reason == Processor::STOP6502::ADDRESS);
+    REQUIRE(result.instructions == expected.instructions);
+    REQUIRE(result.cycles == expected.cycles);
+    REQUIRE(hex(bus.read(0x0002), 2) == hex(30, 2));
+    REQUIRE(bus.cpu.reg.SR == reference.cpu.reg.SR);
+  }
+
+  SECTION("ROM Ignores Writes & Unmapped Addresses Read As Zero")
+  {
+    MappedBus<MemoryMap<RAM<0x0000, 0x7FFF>, ROM<0xC000, 0xFFFF>>> bus;
+    bus.cpu.LoadProgram(0xC000, batchProgram, batchProgramSize, 0xC000);
+
+    bus.write(0x0010, 0x55);
+    bus.write(0xA000, 0x55);
+    bus.write(0xC000, 0x55);
+
+    REQUIRE(hex(bus.read(0x0010), 2) == hex(0x55, 2));
+    REQUIRE(hex(bus.read(0xA000), 2) == hex(0x00, 2));
+    REQUIRE(hex(bus.read(0xC000), 2) == hex(0xA2, 2));
+
+    bus.cpu.runUntil(0xC019);
+    REQUIRE(hex(bus.read(0x0002), 2) == hex(30, 2));
+  }
+}
+
+TEST_CASE("Page Table Tests", "[run][memorymap]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  // Counts the accesses of the pages mapped to it
+  class CountingHandler : public PageHandler
+  {
+  public:
+    uint8_t read(uint16_t addr, bool bReadOnly) override
+    {
+      if (!bReadOnly)
+      {
+        reads++;
+      }
+      return (uint8_t)(addr & 0xFF);
+    }
+    void write(uint16_t /*addr*/, uint8_t data) override
+    {
+      last = data;
+    }
+
+    uint32_t reads = 0;
+    uint8_t  last = 0x00;
+  };
+
+  Bus bus;
+
+  SECTION("ROM Ignores Writes")
+  {
+    bus.ram[0xC000] = 0xA9;
+    bus.mapRom(0xC000, 0xFFFF);
+
+    bus.write(0xC000, 0x55);
+    REQUIRE(hex(bus.read(0xC000), 2) == hex(0xA9, 2));
+  }
+
+  SECTION("Mirrors Share The Memory Of The Source")
+  {
+    bus.mapMirror(0x0800, 0x1FFF, 0x0000, 0x07FF);
+
+    bus.write(0x1803, 0x42);
+    REQUIRE(hex(bus.read(0x0003), 2) == hex(0x42, 2));
+    REQUIRE(hex(bus.read(0x0803), 2) == hex(0x42, 2));
+    REQUIRE(hex(bus.ram[0x1803], 2) == hex(0x00, 2));
+  }
+
+  SECTION("Writes Through A Mirror Invalidate Code Decoded From The Source")
+  {
+    // LDA #$01, at $0200 and seen from $0A00
+    bus.mapMirror(0x0800, 0x1FFF, 0x0000, 0x07FF);
+    uint8_t program[] = { 0xA9, 0x01 };
+    bus.cpu.LoadProgram(0x0200, program, sizeof(program), 0x0200);
+    bus.cpu.executioner.setBlockCache(true);
+
+    bus.cpu.runInstructions(1);
+    REQUIRE(bus.cpu.reg.AC == 0x01);
+
+    bus.write(0x0A01, 0x02);
+    bus.cpu.setProgramCounter(0x0200);
+    bus.cpu.runInstructions(1);
+    REQUIRE(bus.cpu.reg.AC == 0x02);
+  }
+
+  SECTION("Handler Pages Call The Handler")
+  {
+    CountingHandler handler;
+    bus.mapHandler(0xD000, 0xD0FF, &handler);
+
+    // LDA $D012, STA $D020
+    uint8_t program[] = { 0xAD, 0x12, 0xD0, 0x8D, 0x20, 0xD0 };
+    bus.cpu.LoadProgram(0x8000, program, sizeof(program), 0x8000);
+    bus.cpu.runInstructions(2);
+
+    REQUIRE(handler.reads == 1);
+    REQUIRE(hex(handler.last, 2) == hex(0x12, 2));
+    REQUIRE(bus.isVolatile(0xD000));
+    REQUIRE(!bus.isVolatile(0xD100));
+  }
+
+  SECTION("Unmapped Pages Read As Zero")
+  {
+    bus.ram[0xE000] = 0x55;
+    bus.unmap(0xE000, 0xEFFF);
+
+    bus.write(0xE001, 0x55);
+    REQUIRE(hex(bus.read(0xE000), 2) == hex(0x00, 2));
+    REQUIRE(hex(bus.ram[0xE001], 2) == hex(0x00, 2));
+  }
+}
+
+TEST_CASE("Device Tests", "[run][device]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  // A status register: a write raises the IRQ line until the value is read
+  class StatusDevice : public Device
+  {
+  public:
+    uint8_t read(uint16_t /*addr*/) override
+    {
+      uint8_t value = status;
+      status = 0x00;
+      setIrq(false);
+      return value;
+    }
+    uint8_t peek(uint16_t /*addr*/) override
+    {
+      return status;
+    }
+    void write(uint16_t /*addr*/, uint8_t data) override
+    {
+      status = data;
+      setIrq(data != 0x00);
+    }
+
+    uint8_t status = 0x00;
+  };
+
+  Bus bus;
+  StatusDevice device;
+  bus.attach(device, 0xD000, 0xD000);
+
+  SECTION("Only The Attached Addresses Go To The Device")
+  {
+    bus.write(0xD000, 0x42);
+    bus.write(0xD001, 0x55);
+
+    REQUIRE(hex(device.status, 2) == hex(0x42, 2));
+    REQUIRE(hex(bus.ram[0xD000], 2) == hex(0x00, 2));
+    REQUIRE(hex(bus.read(0xD001), 2) == hex(0x55, 2));
+    REQUIRE(bus.isVolatile(0xD001));
+  }
+
+  SECTION("Peeking Has No Side Effects")
+  {
+    bus.write(0xD000, 0x42);
+
+    REQUIRE(hex(bus.read(0xD000, true), 2) == hex(0x42, 2));
+    REQUIRE(bus.cpu.getIrqLine());
+    REQUIRE(hex(bus.read(0xD000), 2) == hex(0x42, 2));
+    REQUIRE(hex(bus.read(0xD000), 2) == hex(0x00, 2));
+    REQUIRE_FALSE(bus.cpu.getIrqLine());
+  }
+
+  SECTION("Detaching Restores The Mapping")
+  {
+    bus.write(0xD000, 0x42);
+    bus.detach(device);
+    bus.write(0xD000, 0x55);
+
+    REQUIRE_FALSE(bus.cpu.getIrqLine());
+    REQUIRE(hex(device.status, 2) == hex(0x42, 2));
+    REQUIRE(hex(bus.read(0xD000), 2) == hex(0x55, 2));
+    REQUIRE_FALSE(bus.isVolatile(0xD000));
+  }
+
+  SECTION("The Processor Services The IRQ Of A Device")
+  {
+    /*
+      *=$8000
+      CLI
+      LDA #1
+      STA $D000   ; Raises the IRQ line
+      LOOP:
+      JMP LOOP
+
+      *=$9000     ; IRQ handler
+      LDA $D000   ; Releases the IRQ line
+      INC $10
+      RTI
+    */
+    uint8_t program[] = { 0x58, 0xA9, 0x01, 0x8D, 0x00, 0xD0, 0x4C, 0x06, 0x80 };
+    uint8_t handler[] = { 0xAD, 0x00, 0xD0, 0xE6, 0x10, 0x40 };
+    size_t n = sizeof(program) / sizeof(program[0]);
+
+    bus.cpu.LoadProgram(0x8000, program, n, 0x8000);
+    std::copy(std::begin(handler), std::end(handler), bus.ram.begin() + 0x9000);
+    bus.ram[0xFFFE] = 0x00;
+    bus.ram[0xFFFF] = 0x90;
+
+    bus.cpu.runInstructions(20);
+
+    REQUIRE(hex(bus.read(0x0010), 2) == hex(0x01, 2));
+    REQUIRE_FALSE(bus.cpu.getIrqLine());
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x8006, 4));
+  }
+}
+
+TEST_CASE("Mapper Tests", "[run][mapper]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  /*
+    *=$D000
+    START:
+    LDX #0
+    LOOP:
+    STX $8000     ; Switches bank X in
+    LDA $8000     ; The first byte of a bank is its number
+    STA $0200,X
+    INX
+    CPX #8
+    BNE LOOP
+    JMP START
+  */
+  uint8_t program[] = {
+    0xA2, 0x00, 0x8E, 0x00, 0x80, 0xAD, 0x00, 0x80, 0x9D, 0x00, 0x02, 0xE8,
+    0xE0, 0x08, 0xD0, 0xF2, 0x4C, 0x00, 0xD0
+  };
+  // One pass of the outer loop
+  const uint32_t instructions = 1 + 8 * 6 + 1;
+
+  // Numbers every bank, and puts the program at 0xD000 of the banks
+  // holding it
+  auto build = [&](size_t bankSize, size_t bankCount, uint16_t window, bool everyBank) {
+    std::vector<uint8_t> image(bankSize * bankCount, 0x00);
+    for (size_t bank = 0; bank < bankCount; bank++)
+    {
+      uint8_t* memory = image.data() + bank * bankSize;
+      memory[0] = (uint8_t)bank;
+      if (everyBank || bank == bankCount - 1)
+      {
+        std::copy(std::begin(program), std::end(program), memory + (0xD000 - window));
+      }
+    }
+    return image;
+  };
+
+  Bus bus;
+
+  SECTION("16 KB Banks Are Switched In A Loop And Allocated When Used")
+  {
+    // 1 MB, of which the program uses 8 banks and the fixed last one
+    std::vector<uint8_t> image = build(16 * 1024, 64, 0xC000, false);
+    BankedMemory memory(16 * 1024, image.data(), image.size());
+    Switch16K mapper(bus, memory);
+
+    REQUIRE(hex(bus.read(0xC000), 2) == hex(63, 2));
+
+    bus.cpu.setProgramCounter(0xD000);
+    Processor::RUNRESULT result = bus.cpu.runInstructions(1000 * instructions);
+
+    REQUIRE(result.instructions == 1000 * instructions);
+    for (uint8_t bank = 0; bank < 8; bank++)
+    {
+      REQUIRE(hex(bus.read(0x0200 + bank), 2) == hex(bank, 2));
+    }
+    REQUIRE(memory.getAllocated() == 9);
+    REQUIRE(hex(bus.read(0x8000), 2) == hex(7, 2));
+  }
+
+  SECTION("32 KB Banks Are Switched Under The Running Program")
+  {
+    std::vector<uint8_t> image = build(32 * 1024, 8, 0x8000, true);
+    BankedMemory memory(32 * 1024, image.data(), image.size());
+    Switch32K mapper(bus, memory);
+
+    bus.cpu.executioner.setBlockCache(true);
+    bus.cpu.setProgramCounter(0xD000);
+    Processor::RUNRESULT result = bus.cpu.runInstructions(1000 * instructions);
+
+    REQUIRE(result.instructions == 1000 * instructions);
+    for (uint8_t bank = 0; bank < 8; bank++)
+    {
+      REQUIRE(hex(bus.read(0x0200 + bank), 2) == hex(bank, 2));
+    }
+    REQUIRE(memory.getAllocated() == 8);
+  }
+
+  SECTION("Banks Are Not Written Through The Window")
+  {
+    std::vector<uint8_t> image = build(16 * 1024, 4, 0xC000, false);
+    BankedMemory memory(16 * 1024, image.data(), image.size());
+    Switch16K mapper(bus, memory);
+
+    bus.write(0x8001, 0x02);
+
+    REQUIRE(hex(bus.read(0x8000), 2) == hex(2, 2));
+    REQUIRE(hex(bus.read(0x8001), 2) == hex(0x00, 2));
+    REQUIRE(hex(memory.bank(1)[0], 2) == hex(1, 2));
+    REQUIRE_FALSE(bus.isVolatile(0x8000));
+    REQUIRE_THROWS_AS(Switch32K(bus, memory), std::invalid_argument);
+  }
+
+  SECTION("Banks Are Read From The File When Used")
+  {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "6502_mapper_test.bin";
+    {
+      std::vector<uint8_t> image = build(16 * 1024, 2, 0xC000, false);
+      std::ofstream file(path, std::ios::binary);
+      file.write(reinterpret_cast<const char*>(image.data()), (std::streamsize)image.size());
+    }
+
+    BankedMemory memory(16 * 1024, path.string());
+    // The file is cut short after the memory was created
+    std::filesystem::resize_file(path, 16 * 1024);
+
+    REQUIRE(hex(memory.bank(0)[0], 2) == hex(0, 2));
+    REQUIRE_THROWS_AS(memory.bank(1), std::runtime_error);
+    REQUIRE(memory.getAllocated() == 1);
+    std::filesystem::remove(path);
+  }
+
+  SECTION("The Mapping Is Put Back When The Mapper Goes")
+  {
+    // The bus points to the mapper
+    STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<Switch16K>);
+    STATIC_REQUIRE_FALSE(std::is_move_constructible_v<Switch16K>);
+
+    std::vector<uint8_t> image = build(16 * 1024, 4, 0xC000, false);
+    BankedMemory memory(16 * 1024, image.data(), image.size());
+    bus.ram[0x8000] = 0x55;
+    bus.mapRom(0xC000, 0xFFFF);
+    {
+      Switch16K mapper(bus, memory);
+      bus.write(0x8000, 0x02);
+      bus.mapRam(0xC000, 0xC0FF);
+
+      REQUIRE(hex(bus.read(0x8000), 2) == hex(2, 2));
+    }
+
+    bus.write(0x8001, 0x66);
+    bus.write(0xC100, 0x77);
+
+    REQUIRE(hex(bus.read(0x8000), 2) == hex(0x55, 2));
+    REQUIRE(hex(bus.read(0x8001), 2) == hex(0x66, 2));
+    REQUIRE(hex(bus.read(0xC100), 2) == hex(0x00, 2));
+    REQUIRE(bus.getMapping(0xC0).write == &bus.ram[0xC000]);
+  }
+}
+
+TEST_CASE("Dirty Tracking Tests", "[run][dirty]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  Bus bus;
+
+  SECTION("Reset Marks Everything")
+  {
+    std::vector<Bus::RANGE> ranges = bus.getDirtyRanges();
+
+    REQUIRE(ranges.size() == 1);
+    REQUIRE(hex(ranges[0].first, 4) == hex(0x0000, 4));
+    REQUIRE(hex(ranges[0].last, 4) == hex(0xFFFF, 4));
+  }
+
+  SECTION("Only The Rows Written To Are Dirty")
+  {
+    bus.cpu.LoadProgram(0x8000, batchProgram, batchProgramSize, 0x8000);
+    bus.clearDirty();
+    bus.cpu.runUntil(0x8019);
+    bus.write(0x1234, 0x55);
+    bus.write(0x1240, 0x55);
+
+    std::vector<Bus::RANGE> ranges = bus.getDirtyRanges();
+
+    REQUIRE(ranges.size() == 2);
+    REQUIRE(hex(ranges[0].first, 4) == hex(0x0000, 4));
+    REQUIRE(hex(ranges[0].last, 4) == hex(0x000F, 4));
+    REQUIRE(hex(ranges[1].first, 4) == hex(0x1230, 4));
+    REQUIRE(hex(ranges[1].last, 4) == hex(0x124F, 4));
+    REQUIRE(hex(bus.getDirtyRows(0x12), 4) == hex(0x0018, 4));
+    REQUIRE_FALSE(bus.isPageDirty(0x80));
+
+    bus.clearDirty(0x1200, 0x12FF);
+
+    REQUIRE_FALSE(bus.isPageDirty(0x12));
+    REQUIRE(bus.isDirty(0x0002));
+  }
+}
+
+TEST_CASE("Memory View Tests", "[run][memoryview]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  Bus bus;
+
+  SECTION("Pages Are Viewed Without Copying")
+  {
+    bus.mapRom(0xC000, 0xFFFF);
+    bus.mapMirror(0x0800, 0x0FFF, 0x0000, 0x07FF);
+    bus.unmap(0x2000, 0x2FFF);
+
+    REQUIRE(bus.view(0x12).data() == &bus.ram[0x1200]);
+    REQUIRE(bus.view(0x12).size() == 256);
+    REQUIRE(bus.view(0xC0).data() == &bus.ram[0xC000]);
+    REQUIRE(bus.view(0x09).data() == &bus.ram[0x0100]);
+    REQUIRE(bus.view(0x20).empty());
+  }
+
+  SECTION("Peeking A Range Crosses Pages")
+  {
+    bus.write(0x10FE, 0x11);
+    bus.write(0x10FF, 0x22);
+    bus.write(0x1100, 0x33);
+    bus.unmap(0x1100, 0x11FF);
+
+    std::array<uint8_t, 4> bytes;
+    bus.peek(0x10FE, bytes);
+
+    REQUIRE(hex(bytes[0], 2) == hex(0x11, 2));
+    REQUIRE(hex(bytes[1], 2) == hex(0x22, 2));
+    REQUIRE(hex(bytes[2], 2) == hex(0x00, 2));
+    REQUIRE(hex(bus.peek(0x10FF), 2) == hex(0x22, 2));
+  }
+
+  SECTION("Disassembly Visits Every Instruction")
+  {
+    // LDA #$01, STA $0200, JMP $8000
+    uint8_t program[] = { 0xA9, 0x01, 0x8D, 0x00, 0x02, 0x4C, 0x00, 0x80 };
+    size_t n = sizeof(program) / sizeof(program[0]);
+    bus.cpu.LoadProgram(0x8000, program, n, 0x8000);
+
+    std::vector<uint16_t> addresses;
+    std::vector<uint8_t> opcodes;
+    bus.cpu.disassemble(0x8000, 0x8007, [&addresses, &opcodes](uint16_t addr, const Processor::DISASSEMBLY& line) {
+      addresses.push_back(addr);
+      opcodes.push_back(line.OpCode);
+    });
+
+    REQUIRE(addresses == std::vector<uint16_t>{ 0x8000, 0x8002, 0x8005 });
+    REQUIRE(opcodes == std::vector<uint8_t>{ 0xA9, 0x8D, 0x4C });
+    REQUIRE(bus.cpu.getDisassembly(0x8000, 0x8007).size() == 3);
+    REQUIRE(bus.cpu.getDisassembly(0x8000, 0x8007)[0x8002].OpCode == 0x8D);
+  }
+}
+
+TEST_CASE("Loader Tests", "[run][loader]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  // LDA #$01, STA $0200, JMP $8000 at 0x8000 and 0x11 0x22 at 0x0200
+  auto bytesOf = [](const std::string& text) {
+    return std::vector<uint8_t>(text.begin(), text.end());
+  };
+  auto requireProgram = [](Bus& bus) {
+    REQUIRE(hex(bus.read(0x8000), 2) == hex(0xA9, 2));
+    REQUIRE(hex(bus.read(0x8007), 2) == hex(0x80, 2));
+    REQUIRE(hex(bus.read(0x0201), 2) == hex(0x22, 2));
+  };
+
+  Bus bus;
+
+  SECTION("Intel HEX Records Are Joined Into Segments")
+  {
+    std::vector<uint8_t> text = bytesOf(
+      ":05800000A9018D000242\n"
+      ":038005004C0080AC\r\n"
+      ":020200001122C9\n"
+      ":040000050000800077\n"
+      ":00000001FF\n"
+    );
+    Loader::IMAGE image = Loader::decode(text, Loader::INTEL_HEX);
+
+    REQUIRE(image.segments.size() == 2);
+    REQUIRE(image.segments[0].bytes.size() == 8);
+    REQUIRE(image.entry == 0x8000);
+
+    bus.cpu.LoadImage(image);
+    requireProgram(bus);
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x8000, 4));
+  }
+
+  SECTION("S-Records Are Decoded")
+  {
+    std::vector<uint8_t> text = bytesOf(
+      "S00600004844521B\n"
+      "S1088000A9018D00023E\n"
+      "S10680054C0080A8\n"
+      "S10502001122C5\n"
+      "S90380007C\n"
+    );
+    Loader::IMAGE image = Loader::decode(text, Loader::SRECORD);
+
+    REQUIRE(image.segments.size() == 2);
+    REQUIRE(image.entry == 0x8000);
+
+    bus.cpu.LoadImage(image);
+    requireProgram(bus);
+  }
+
+  SECTION("Invalid Records Are Refused")
+  {
+    REQUIRE_THROWS_AS(Loader::decode(bytesOf(":05800000A9018D000243\n"), Loader::INTEL_HEX), std::runtime_error);
+    REQUIRE_THROWS_AS(Loader::decode(bytesOf("S1088000A9018D00023F\n"), Loader::SRECORD), std::runtime_error);
+    REQUIRE_THROWS_AS(Loader::decode(bytesOf(":02FFFF001122CD\n"), Loader::INTEL_HEX), std::runtime_error);
+  }
+
+  SECTION("Raw & PRG Files Are Mapped")
+  {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "6502_loader_test.prg";
+    {
+      std::ofstream file(path, std::ios::binary);
+      const char prg[] = { 0x00, (char)0xC0, (char)0xA9, 0x01 };
+      file.write(prg, sizeof(prg));
+    }
+
+    Loader::IMAGE prg = Loader::load(path.string());
+    Loader::IMAGE raw = Loader::load(path.string(), Loader::RAW, 0x1000);
+    std::filesystem::remove(path);
+
+    REQUIRE(prg.segments.size() == 1);
+    REQUIRE(hex(prg.segments[0].address, 4) == hex(0xC000, 4));
+    REQUIRE(prg.segments[0].bytes.size() == 2);
+    REQUIRE(raw.segments[0].bytes.size() == 4);
+
+    bus.cpu.LoadImage(prg);
+    bus.cpu.LoadImage(raw);
+
+    REQUIRE(hex(bus.read(0xC000), 2) == hex(0xA9, 2));
+    REQUIRE(hex(bus.read(0x1001), 2) == hex(0xC0, 2));
+  }
+
+  SECTION("Memory Is Only Cleared When Asked")
+  {
+    Loader::IMAGE image = Loader::decode(bytesOf("S10502001122C5\n"), Loader::SRECORD);
+    bus.write(0x3000, 0x55);
+
+    bus.cpu.LoadImage(image);
+    REQUIRE(hex(bus.read(0x3000), 2) == hex(0x55, 2));
+
+    bus.cpu.LoadImage(image, true);
+    REQUIRE(hex(bus.read(0x3000), 2) == hex(0x00, 2));
+    REQUIRE(hex(bus.read(0x0200), 2) == hex(0x11, 2));
+  }
+
+  SECTION("A Program Can Fill The Whole Memory")
+  {
+    std::vector<uint8_t> program(64 * 1024, 0xEA);
+    bus.cpu.LoadProgram(0x0000, program.data(), program.size());
+
+    REQUIRE(hex(bus.read(0x0000), 2) == hex(0xEA, 2));
+    REQUIRE(hex(bus.read(0xFFFF), 2) == hex(0xEA, 2));
+  }
+}
+
+TEST_CASE("Snapshot Tests", "[run][snapshot]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  Bus bus;
+  bus.cpu.LoadProgram(0x8000, batchProgram, batchProgramSize, 0x8000);
+  // Rows still dirty are copied back by resetTo() too
+  bus.clearDirty();
+  Bus::SNAPSHOT snapshot = bus.snapshot();
+
+  SECTION("Runs The Same After Every Reset")
+  {
+    Processor::RUNRESULT first = bus.cpu.runUntil(0x8019);
+    bus.write(0x1234, 0x55);
+
+    for (int i = 0; i < 3; i++)
+    {
+      bus.resetTo(snapshot);
+
+      REQUIRE(hex(bus.read(0x0002), 2) == hex(0x00, 2));
+      REQUIRE(hex(bus.read(0x1234), 2) == hex(0x00, 2));
+      REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x8000, 4));
+      REQUIRE(bus.cpu.total_cycles == snapshot.total_cycles);
+
+      Processor::RUNRESULT result = bus.cpu.runUntil(0x8019);
+      REQUIRE(result.instructions == first.instructions);
+      REQUIRE(result.cycles == first.cycles);
+      REQUIRE(hex(bus.read(0x0002), 2) == hex(30, 2));
+    }
+  }
+
+  SECTION("Dirty Rows Are Kept Apart From The Snapshot")
+  {
+    bus.write(0x1234, 0x55);
+    bus.clearDirty();
+    bus.resetTo(snapshot);
+
+    // Only the row written since the snapshot was copied back
+    std::vector<Bus::RANGE> ranges = bus.getDirtyRanges();
+
+    REQUIRE(hex(bus.read(0x1234), 2) == hex(0x00, 2));
+    REQUIRE(ranges.size() == 1);
+    REQUIRE(hex(ranges[0].first, 4) == hex(0x1230, 4));
+    REQUIRE(hex(ranges[0].last, 4) == hex(0x123F, 4));
+
+    bus.snapshot();
+
+    REQUIRE(bus.isDirty(0x1234));
+  }
+
+  SECTION("Writes Through A Mirror Are Restored")
+  {
+    bus.mapMirror(0x0800, 0x0FFF, 0x0000, 0x07FF);
+    bus.write(0x0905, 0x55);
+    bus.resetTo(snapshot);
+
+    REQUIRE(hex(bus.ram[0x0105], 2) == hex(0x00, 2));
+  }
+
+  SECTION("Buses Are Recycled By The Pool")
+  {
+    BusPool pool;
+    pool.reserve(2);
+    REQUIRE(pool.getAvailable() == 2);
+
+    Bus* recycled = nullptr;
+    {
+      BusPool::HANDLE handle = pool.acquire(snapshot);
+      recycled = handle.get();
+      REQUIRE(pool.getAvailable() == 1);
+
+      handle->cpu.runUntil(0x8019);
+      REQUIRE(hex(handle->read(0x0002), 2) == hex(30, 2));
+    }
+    REQUIRE(pool.getAvailable() == 2);
+
+    BusPool::HANDLE handle = pool.acquire(snapshot);
+    REQUIRE(handle.get() == recycled);
+    REQUIRE(hex(handle->read(0x0002), 2) == hex(0x00, 2));
+    REQUIRE(hex(handle->read(0x8000), 2) == hex(0xA2, 2));
+  }
+
+  SECTION("Recycled Buses Are Configured As New Ones")
+  {
+    // Holds the IRQ line once written to
+    class IrqDevice : public Device
+    {
+    public:
+      uint8_t read(uint16_t /*addr*/) override { return 0x00; }
+      uint8_t peek(uint16_t /*addr*/) override { return 0x00; }
+      void    write(uint16_t /*addr*/, uint8_t /*data*/) override { setIrq(true); }
+    };
+
+    BusPool pool;
+    IrqDevice device;
+    {
+      BusPool::HANDLE handle = pool.acquire(snapshot);
+      handle->attach(device, 0xD000, 0xD000);
+      handle->write(0xD000, 0x01);
+      handle->mapRom(0x8000, 0xFFFF);
+      handle->setVolatile(0x0200, 0x02FF);
+      handle->cpu.setTiming(Processor::FUNCTIONAL);
+      handle->cpu.setIdleDetection(true);
+      handle->cpu.executioner.setDispatch(Executioner::TABLE);
+      handle->cpu.executioner.setBlockCache(true);
+
+      REQUIRE(handle->cpu.getIrqLine());
+    }
+
+    BusPool::HANDLE handle = pool.acquire(snapshot);
+    handle->write(0x8000, 0x55);
+    handle->write(0xD000, 0x01);
+
+    REQUIRE(hex(handle->read(0x8000), 2) == hex(0x55, 2));
+    REQUIRE(hex(handle->ram[0xD000], 2) == hex(0x01, 2));
+    REQUIRE_FALSE(handle->isVolatile(0xD000));
+    REQUIRE_FALSE(handle->isVolatile(0x0200));
+    REQUIRE_FALSE(handle->cpu.getIrqLine());
+    REQUIRE(handle->cpu.getTiming() == Processor::CYCLE_ACCURATE);
+    REQUIRE_FALSE(handle->cpu.getIdleDetection());
+    REQUIRE(handle->cpu.executioner.getDispatch() == Executioner::DEFAULT_DISPATCH);
+    REQUIRE_FALSE(handle->cpu.executioner.cache.isEnabled());
+  }
+
+  SECTION("Recycled Buses Only Copy Back The Rows Written")
+  {
+    BusPool pool;
+    {
+      BusPool::HANDLE handle = pool.acquire(snapshot);
+      handle->clearDirty();
+      handle->cpu.runUntil(0x8019);
+      handle->write(0x1234, 0x55);
+    }
+
+    BusPool::HANDLE handle = pool.acquire(snapshot);
+
+    REQUIRE(hex(handle->read(0x0002), 2) == hex(0x00, 2));
+    REQUIRE(hex(handle->read(0x1234), 2) == hex(0x00, 2));
+    REQUIRE(handle->isDirty(0x1234));
+    REQUIRE_FALSE(handle->isPageDirty(0x40));
+    REQUIRE_FALSE(handle->isPageDirty(0x80));
+  }
+}
+
+TEST_CASE("Block Cache Tests", "[run]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  Bus bus;
+
+  SECTION("Runs The Same With And Without The Cache")
+  {
+    bus.cpu.LoadProgram(0x8000, batchProgram, batchProgramSize, 0x8000);
+    Processor::RUNRESULT uncached = bus.cpu.runUntil(0x8019);
+
+    bus.cpu.executioner.setBlockCache(true);
+    bus.cpu.LoadProgram(0x8000, batchProgram, batchProgramSize, 0x8000);
+    Processor::RUNRESULT cached = bus.cpu.runUntil(0x8019);
+
+    REQUIRE(cached.instructions == uncached.instructions);
+    REQUIRE(cached.cycles == uncached.cycles);
+    REQUIRE(hex(bus.read(0x0002), 2) == hex(30, 2));
+  }
+
+  SECTION("Self Modifying Code Is Decoded Again")
+  {
+    /*
+      *=$8000
+      LDA #1
+      STA $8006
+      LDX #0    ; Operand is overwritten with 1
+      NOP
+    */
+    uint8_t program[] = { 0xA9, 0x01, 0x8D, 0x06, 0x80, 0xA2, 0x00, 0xEA };
+    size_t n = sizeof(program) / sizeof(program[0]);
+
+    bus.cpu.executioner.setBlockCache(true);
+    bus.cpu.LoadProgram(0x8000, program, n, 0x8000);
+    bus.cpu.runInstructions(3);
+
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.X), 2) == hex(0x01, 2));
+  }
+}
+
+TEST_CASE("JIT Dispatch Tests", "[run]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  Bus bus;
+
+  /*
+    *=$8000
+    LDX #0
+    loop
+    INX
+    CPX #200  ; Operand is overwritten with 100
+    BNE loop
+    LDA #100
+    STA $8004
+    NOP
+  */
+  uint8_t program[] = {
+    0xA2, 0x00, 0xE8, 0xE0, 0xC8, 0xD0, 0xFB, 0xA9, 0x64, 0x8D, 0x04, 0x80, 0xEA
+  };
+  size_t n = sizeof(program) / sizeof(program[0]);
+  bus.cpu.executioner.setDispatch(Executioner::JIT);
+  bus.cpu.LoadProgram(0x8000, program, n, 0x8000);
+
+  SECTION("Runs The Same As The Interpreter")
+  {
+    Processor::RUNRESULT result = bus.cpu.runUntil(0x8007);
+
+    REQUIRE(result.instructions == 601);
+    REQUIRE(result.cycles == 1401);
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.X), 2) == hex(200, 2));
+  }
+
+  SECTION("Translated Code Is Dropped When Overwritten")
+  {
+    bus.cpu.runUntil(0x800C);
+    bus.cpu.setProgramCounter(0x8000);
+    bus.cpu.runUntil(0x8007);
+
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.X), 2) == hex(100, 2));
+  }
+
+  // runUntil() stops inside the loop, which keeps it from running as a
+  // block, a batch lets the translated code run
+  SECTION("Translated Blocks Run The Same As The Interpreter")
+  {
+    Processor::RUNRESULT result = bus.cpu.runInstructions(601);
+
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x8007, 4));
+    REQUIRE(result.cycles == 1401);
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.X), 2) == hex(200, 2));
+  }
+
+  SECTION("Translated Blocks Are Dropped When They Overwrite Themselves")
+  {
+    bus.clearDirty();
+    bus.cpu.runInstructions(604);
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x800D, 4));
+    REQUIRE(hex(bus.read(0x8004), 2) == hex(100, 2));
+    REQUIRE(bus.isDirty(0x8004));
+
+    bus.cpu.setProgramCounter(0x8000);
+    bus.cpu.runInstructions(301);
+
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x8007, 4));
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.X), 2) == hex(100, 2));
+  }
+}
+
+TEST_CASE("Superinstruction Tests", "[run]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  /*
+    *=$8000
+    LDY #10
+    outer
+    LDX #0
+    inner
+    INX
+    CPX #20
+    BNE inner
+    DEY
+    BNE outer
+    CLC
+    ADC #1
+    NOP
+  */
+  uint8_t program[] = {
+    0xA0, 0x0A, 0xA2, 0x00, 0xE8, 0xE0, 0x14, 0xD0, 0xFB, 0x88, 0xD0, 0xF6, 0x18, 0x69, 0x01, 0xEA
+  };
+  size_t n = sizeof(program) / sizeof(program[0]);
+
+  Bus reference;
+  reference.cpu.executioner.setDispatch(Executioner::TABLE);
+  reference.cpu.LoadProgram(0x8000, program, n, 0x8000);
+
+  Bus bus;
+  bus.cpu.executioner.setDispatch(Executioner::SUPERINSTRUCTION);
+  bus.cpu.LoadProgram(0x8000, program, n, 0x8000);
+
+  SECTION("Fused Opcodes Take The Same Cycles")
+  {
+    Processor::RUNRESULT expected = reference.cpu.runUntil(0x800F);
+    Processor::RUNRESULT result = bus.cpu.runUntil(0x800F);
+
+    REQUIRE(result.instructions == expected.instructions);
+    REQUIRE(result.cycles == expected.cycles);
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.AC), 2) == hex(reference.cpu.getRegister(reference.cpu.AC), 2));
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.SR), 2) == hex(reference.cpu.getRegister(reference.cpu.SR), 2));
+  }
+
+  SECTION("Batches Can End Inside A Superinstruction")
+  {
+    for (int i = 0; i < 100; i++)
+    {
+      REQUIRE(bus.cpu.runInstructions(1).instructions == 1);
+      reference.cpu.runInstructions(1);
+      REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(reference.cpu.getProgramCounter(), 4));
+      REQUIRE(bus.cpu.total_cycles == reference.cpu.total_cycles);
+    }
+  }
+
+  SECTION("Profile Counts Opcode Sequences")
+  {
+    bus.cpu.executioner.profile.setEnabled(true);
+    bus.cpu.runUntil(0x800F);
+
+    OpcodeProfile& profile = bus.cpu.executioner.profile;
+    REQUIRE(profile.getCount(0xE8, 0xE0) == 200);
+    REQUIRE(profile.getCount(0x88, 0xD0) == 10);
+    REQUIRE(profile.getCount(0xE8, 0xE0, 0xD0) == 200);
+
+    std::vector<OpcodeProfile::NGRAM> frequent = profile.getMostFrequent(1);
+    REQUIRE(frequent.size() == 1);
+    REQUIRE(frequent[0].count == 200);
+  }
+}
+
+TEST_CASE("Idle Loop Tests", "[run]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  /*
+    *=$8000
+    wait
+    LDA $10
+    BEQ wait
+    LDX #0
+    count
+    INX
+    BNE count
+    JMP *
+  */
+  uint8_t program[] = {
+    0xA5, 0x10, 0xF0, 0xFC, 0xA2, 0x00, 0xE8, 0xD0, 0xFD, 0x4C, 0x09, 0x80
+  };
+  size_t n = sizeof(program) / sizeof(program[0]);
+
+  Bus reference;
+  reference.cpu.LoadProgram(0x8000, program, n, 0x8000);
+
+  Bus bus;
+  bus.cpu.setIdleDetection(true);
+  bus.cpu.LoadProgram(0x8000, program, n, 0x8000);
+
+  SECTION("Polling Loop Is Skipped")
+  {
+    Processor::RUNRESULT expected = reference.cpu.run(1000000);
+    Processor::RUNRESULT result = bus.cpu.run(1000000);
+
+    REQUIRE(result.instructions == expected.instructions);
+    REQUIRE(result.cycles == expected.cycles);
+    REQUIRE(bus.cpu.clock_count == reference.cpu.clock_count);
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(reference.cpu.getProgramCounter(), 4));
+    REQUIRE(bus.cpu.getIdleCycles() > 990000);
+  }
+
+  SECTION("Skipped Loop Ends On Interrupt")
+  {
+    bus.write(0xFFFE, 0x00);
+    bus.write(0xFFFF, 0x90);
+    bus.cpu.run(1000);
+    bus.cpu.TriggerIRQ = true;
+    bus.cpu.runInstructions(1);
+
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x9000, 4));
+  }
+
+  SECTION("Instruction Budget Is Kept")
+  {
+    Processor::RUNRESULT expected = reference.cpu.runInstructions(100001);
+    Processor::RUNRESULT result = bus.cpu.runInstructions(100001);
+
+    REQUIRE(result.instructions == 100001);
+    REQUIRE(result.cycles == expected.cycles);
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x8002, 4));
+    REQUIRE(bus.cpu.getIdleCycles() > 0);
+  }
+
+  SECTION("Volatile Memory Is Polled")
+  {
+    bus.setVolatile(0x0000, 0x00FF);
+    bus.cpu.run(10000);
+
+    REQUIRE(bus.cpu.getIdleCycles() == 0);
+  }
+
+  SECTION("Loops Changing Registers Are Run")
+  {
+    bus.write(0x0010, 0x01);
+    reference.write(0x0010, 0x01);
+    Processor::RUNRESULT expected = reference.cpu.run(100000);
+    Processor::RUNRESULT result = bus.cpu.run(100000);
+
+    REQUIRE(result.instructions == expected.instructions);
+    REQUIRE(result.cycles == expected.cycles);
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(0x8009, 4));
+    // Only JMP * is skipped, the counting loop ran
+    REQUIRE(bus.cpu.getIdleCycles() > 0);
+    REQUIRE(bus.cpu.getIdleCycles() < 100000 - 256 * 5);
+  }
+}
+
+TEST_CASE("Functional Timing Tests", "[run]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  Bus bus;
+  Bus reference;
+
+  /*
+    *=$8000
+    LDX #10
+    loop
+    LDA $80F8,X ; Crosses a page for X >= 8
+    STA $0200,X
+    DEX
+    BNE loop
+    NOP
+  */
+  uint8_t program[] = {
+    0xA2, 0x0A, 0xBD, 0xF8, 0x80, 0x9D, 0x00, 0x02, 0xCA, 0xD0, 0xF7, 0xEA
+  };
+  size_t n = sizeof(program) / sizeof(program[0]);
+  bus.cpu.LoadProgram(0x8000, program, n, 0x8000);
+  reference.cpu.LoadProgram(0x8000, program, n, 0x8000);
+
+  Processor::RUNRESULT expected = reference.cpu.runUntil(0x800B);
+
+  SECTION("Functional Mode Takes As Many Cycles")
+  {
+    bus.cpu.setTiming(Processor::FUNCTIONAL);
+    Processor::RUNRESULT result = bus.cpu.runUntil(0x800B);
+
+    REQUIRE(result.instructions == expected.instructions);
+    REQUIRE(result.cycles == expected.cycles);
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.X), 2) == hex(0x00, 2));
+  }
+
+  SECTION("Switches To Cycle Accurate Mode While Running")
+  {
+    bus.cpu.setTiming(Processor::FUNCTIONAL);
+    Processor::RUNRESULT result = bus.cpu.runUntil([](Processor& cpu) {
+      if (cpu.getRegister(Processor::REGISTER6502::X) == 5)
+      {
+        cpu.setTiming(Processor::CYCLE_ACCURATE);
+      }
+      return cpu.getProgramCounter() == 0x800B;
+    });
+
+    REQUIRE(bus.cpu.getTiming() == Processor::CYCLE_ACCURATE);
+    REQUIRE(result.instructions == expected.instructions);
+    REQUIRE(result.cycles == expected.cycles);
+  }
+}
+
+TEST_CASE("CPU Variant Tests", "[run][variant]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  SECTION("65C02 Runs Its New Opcodes")
+  {
+    /*
+      *=$8000
+      LDX #$34
+      PHX
+      PLY
+      STZ $0200
+      LDA #$F0
+      TSB $10
+      BRA skip
+      LDA #$00
+      skip
+      INC A
+      NOP
+    */
+    uint8_t program[] = {
+      0xA2, 0x34, 0xDA, 0x7A, 0x9C, 0x00, 0x02, 0xA9, 0xF0, 0x04, 0x10, 0x80, 0x02, 0xA9, 0x00, 0x1A,
+      0xEA
+    };
+    size_t n = sizeof(program) / sizeof(program[0]);
+
+    Executioner::DISPATCH engine = GENERATE(
+      Executioner::TABLE, Executioner::SWITCH, Executioner::THREADED,
+      Executioner::TAILCALL, Executioner::JIT, Executioner::SUPERINSTRUCTION
+    );
+    Processor::TIMING6502 timing = GENERATE(Processor::CYCLE_ACCURATE, Processor::FUNCTIONAL);
+
+    Bus bus(Executioner::WDC65C02);
+    bus.cpu.executioner.setDispatch(engine);
+    bus.cpu.setTiming(timing);
+    bus.cpu.LoadProgram(0x8000, program, n, 0x8000);
+    bus.write(0x0200, 0xAA);
+    bus.write(0x0010, 0x0F);
+
+    Processor::RUNRESULT result = bus.cpu.runUntil(0x8010);
+
+    REQUIRE(result.instructions == 8);
+    REQUIRE(result.cycles == 25);
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.Y), 2) == hex(0x34, 2));
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.AC), 2) == hex(0xF1, 2));
+    REQUIRE(hex(bus.read(0x0200), 2) == hex(0x00, 2));
+    REQUIRE(hex(bus.read(0x0010), 2) == hex(0xFF, 2));
+  }
+
+  SECTION("6502 Decodes The Same Opcodes As Illegal Ones")
+  {
+    Bus nmos(Executioner::MOS6502);
+    Bus cmos(Executioner::WDC65C02);
+
+    REQUIRE(nmos.cpu.executioner.getMnemonic(0xDA) != Executioner::Mnemonic::PHX);
+    REQUIRE(cmos.cpu.executioner.getMnemonic(0xDA) == Executioner::Mnemonic::PHX);
+    REQUIRE(cmos.cpu.executioner.getMnemonic(0x80) == Executioner::Mnemonic::BRA);
+    REQUIRE(cmos.cpu.executioner.getAddressMode(0xB2) == Executioner::AddressMode::IZP);
+    REQUIRE(cmos.cpu.executioner.getAddressMode(0x7C) == Executioner::AddressMode::IAX);
+    REQUIRE(cmos.cpu.executioner.getOperandLength(0x7C) == 2);
+    REQUIRE(cmos.cpu.executioner.getCyclePolicy(0x9E) == Executioner::INDEXED_WRITE);
+  }
+
+  SECTION("65C02 Disassembles Its New Addressing Modes")
+  {
+    // LDA ($10), JMP ($9000, X), NOP
+    uint8_t program[] = { 0xB2, 0x10, 0x7C, 0x00, 0x90, 0xEA };
+    Bus bus(Executioner::WDC65C02);
+    bus.cpu.LoadProgram(0x8000, program, 6, 0x8000);
+
+    std::map<uint16_t, Processor::DISASSEMBLY> lines = bus.cpu.getDisassembly(0x8000, 0x8005);
+
+    REQUIRE(lines.size() == 3);
+    REQUIRE(lines[0x8000].OpCodeString == "LDA");
+    REQUIRE(lines[0x8000].DisassemblyOutput.find("($10)") != std::string::npos);
+    REQUIRE(lines[0x8002].OpCodeString == "JMP");
+    REQUIRE(lines[0x8002].DisassemblyOutput.find("($9000, X)") != std::string::npos);
+    REQUIRE(lines[0x8005].OpCodeString == "NOP");
+  }
+
+  SECTION("Only The 6502 Wraps Indirect Jumps Within The Page")
+  {
+    auto [variant, target, cycles] = GENERATE( table<Executioner::VARIANT, uint16_t, uint64_t>({
+      {Executioner::MOS6502, 0xA000, 5},
+      {Executioner::RICOH2A03, 0xA000, 5},
+      {Executioner::WDC65C02, 0x9000, 6},
+    }));
+
+    // JMP ($10FF)
+    uint8_t program[] = { 0x6C, 0xFF, 0x10 };
+    Bus bus(variant);
+    bus.cpu.LoadProgram(0x8000, program, 3, 0x8000);
+    bus.write(0x10FF, 0x00);
+    bus.write(0x1000, 0xA0);
+    bus.write(0x1100, 0x90);
+
+    Processor::RUNRESULT result = bus.cpu.runInstructions(1);
+
+    REQUIRE(hex(bus.cpu.getProgramCounter(), 4) == hex(target, 4));
+    REQUIRE(result.cycles == cycles);
+  }
+
+#ifdef DECIMAL_MODE
+  SECTION("2A03 Ignores The Decimal Flag")
+  {
+    auto [variant, value] = GENERATE( table<Executioner::VARIANT, uint8_t>({
+      {Executioner::MOS6502, 0x10},
+      {Executioner::RICOH2A03, 0x0A},
+    }));
+
+    /*
+      SED
+      CLC
+      LDA #$09
+      ADC #$01
+    */
+    uint8_t program[] = { 0xF8, 0x18, 0xA9, 0x09, 0x69, 0x01 };
+    Bus bus(variant);
+    bus.cpu.LoadProgram(0x8000, program, 6, 0x8000);
+    bus.cpu.runInstructions(4);
+
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.AC), 2) == hex(value, 2));
+  }
+#endif
+}
+
+TEST_CASE("Recompiler Tests", "[recompiler]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  Bus bus;
+
+  /*
+    *=$8000
+    LDX #0    ; Operand is overwritten with 5
+    loop
+    INX
+    CPX #200
+    BNE loop
+    NOP
+  */
+  uint8_t program[] = {
+    0xA2, 0x00, 0xE8, 0xE0, 0xC8, 0xD0, 0xFB, 0xEA
+  };
+  size_t n = sizeof(program) / sizeof(program[0]);
+
+  SECTION("Code Is Split Into Basic Blocks")
+  {
+    Recompiler recompiler(program, n, 0x8000);
+    recompiler.addEntryPoint(0x8000);
+    recompiler.analyze();
+
+    auto& blocks = recompiler.getBlocks();
+    REQUIRE(blocks.size() == 3);
+    REQUIRE(blocks.at(0x8000).size == 2);
+    REQUIRE(blocks.at(0x8002).instructions.size() == 3);
+    REQUIRE(blocks.at(0x8007).size == 1);
+
+    std::stringstream out;
+    recompiler.emit(out);
+    REQUIRE(out.str().find("void block_8002(CONTEXT& c)") != std::string::npos);
+    REQUIRE(out.str().find(Recompiled::SYMBOL) != std::string::npos);
+  }
+
+  SECTION("Interpreter Runs Overwritten Blocks")
+  {
+    static const uint8_t bytes[] = { 0xA2, 0x00 };
+    static const Recompiled::ENTRY entries[] = {
+      { 0x8000, 2, bytes, [](Recompiled::CONTEXT& c)
+        {
+          c.X = Recompiled::setNZ(c, 0x00);
+          c.cycles += 2;
+          c.PC = 0x8002;
+          c.instructions += 1;
+        }
+      }
+    };
+    static const Recompiled::MODULE module = {
+      Recompiled::VERSION, Recompiled::BUILD_OPTIONS, Recompiled::MOS6502, 1, entries
+    };
+
+    bus.cpu.LoadProgram(0x8000, program, n, 0x8000);
+    RecompiledModule recompiled;
+    REQUIRE(recompiled.attach(&module));
+
+    Processor::RUNRESULT result = recompiled.run(bus, 1401);
+    REQUIRE(result.instructions == 601);
+    REQUIRE(result.cycles == 1401);
+    REQUIRE(recompiled.getTranslatedInstructions() == 1);
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.X), 2) == hex(200, 2));
+
+    bus.write(0x8001, 5);
+    bus.cpu.setProgramCounter(0x8000);
+    recompiled.run(bus, 2);
+    REQUIRE(recompiled.getTranslatedInstructions() == 1);
+    REQUIRE(hex(bus.cpu.getRegister(bus.cpu.X), 2) == hex(5, 2));
+  }
+
+  SECTION("Code Is Translated For The Variant")
+  {
+    // INC A, an illegal NOP of the NMOS 6502
+    uint8_t inc[] = { 0x1A, 0xEA };
+
+    Recompiler nmos(inc, 2, 0x8000, Executioner::MOS6502);
+    nmos.addEntryPoint(0x8000);
+    nmos.analyze();
+    Recompiler cmos(inc, 2, 0x8000, Executioner::WDC65C02);
+    cmos.addEntryPoint(0x8000);
+    cmos.analyze();
+
+    std::stringstream nmosOut;
+    nmos.emit(nmosOut);
+    std::stringstream cmosOut;
+    cmos.emit(cmosOut);
+    REQUIRE(nmosOut.str().find("c.AC = inc(c, c.AC);") == std::string::npos);
+    REQUIRE(cmosOut.str().find("c.AC = inc(c, c.AC);") != std::string::npos);
+    REQUIRE(cmosOut.str().find("WDC65C02") != std::string::npos);
+  }
+
+  SECTION("Blocks Only Run On Their Variant")
+  {
+    static const uint8_t bytes[] = { 0xA2, 0x00 };
+    static const Recompiled::ENTRY entries[] = {
+      { 0x8000, 2, bytes, [](Recompiled::CONTEXT& c)
+        {
+          c.X = Recompiled::setNZ(c, 0x00);
+          c.cycles += 2;
+          c.PC = 0x8002;
+          c.instructions += 1;
+        }
+      }
+    };
+    static const Recompiled::MODULE module = {
+      Recompiled::VERSION, Recompiled::BUILD_OPTIONS, Recompiled::WDC65C02, 1, entries
+    };
+
+    RecompiledModule recompiled;
+    REQUIRE(recompiled.attach(&module));
+
+    Bus nmos(Executioner::MOS6502);
+    nmos.cpu.LoadProgram(0x8000, program, n, 0x8000);
+    recompiled.run(nmos, 2);
+    REQUIRE(recompiled.getTranslatedInstructions() == 0);
+
+    Bus cmos(Executioner::WDC65C02);
+    cmos.cpu.LoadProgram(0x8000, program, n, 0x8000);
+    recompiled.run(cmos, 2);
+    REQUIRE(recompiled.getTranslatedInstructions() == 1);
+  }
+}
+
+TEST_CASE("ALU Table Tests", "[init][alu]")
+{
+  MainTest::logTestCaseName(Catch::getResultCapture().getCurrentTestName());
+
+  // The formulas the tables replaced, applied to every combination of
+  // accumulator, operand & carry
+  auto flags = [](uint16_t value)
+  {
+    return (uint8_t)((value & 0x0080) | ((value & 0x00FF) == 0 ? Processor::Z : 0));
+  };
+
+  SECTION("NZ Table Matches")
+  {
+    int mismatches = 0;
+    for (int v = 0; v < 256; v++)
+    {
+      mismatches += Processor::nzFlags[v] != flags(v);
+    }
+    REQUIRE(mismatches == 0);
+  }
+
+  SECTION("Binary ADC & SBC Tables Match")
+  {
+    int mismatches = 0;
+    for (uint32_t i = 0; i < 0x20000; i++)
+    {
+      uint8_t a = (uint8_t)(i >> 8), m = (uint8_t)i, c = (uint8_t)(i >> 16);
+
+      uint16_t temp = (uint16_t)a + (uint16_t)m + (uint16_t)c;
+      uint8_t  expected = flags(temp) | ((temp > 255) ? Processor::C : 0) |
+        (((~((uint16_t)m ^ (uint16_t)a) & ((uint16_t)temp ^ (uint16_t)a)) & 0x80) ? Processor::V : 0);
+      mismatches += Alu::adc[Alu::index(a, m, c)] != ((temp & 0x00FF) | (expected << 8));
+
+      uint16_t bottom = ((uint16_t)m) ^ 0x00FF;
+      uint16_t value = (uint16_t)a + bottom + (uint16_t)c;
+      expected = flags(value) | ((value & 0xFF00) ? Processor::C : 0) |
+        (((value ^ (uint16_t)a) & (value ^ bottom) & 0x0080) ? Processor::V : 0);
+      mismatches += Alu::adc[Alu::index(a, m ^ 0xFF, c)] != ((value & 0x00FF) | (expected << 8));
+    }
+    REQUIRE(mismatches == 0);
+  }
+
+#ifdef DECIMAL_MODE
+  SECTION("Decimal ADC & SBC Tables Match")
+  {
+    int mismatches = 0;
+    for (uint32_t i = 0; i < 0x20000; i++)
+    {
+      uint8_t a = (uint8_t)(i >> 8), m = (uint8_t)i, c = (uint8_t)(i >> 16);
+
+      uint8_t  d0 = (m & 0x0F) + (a & 0x0F) + c;
+      uint8_t  d1 = (m >> 4) + (a >> 4) + (d0 > 9 ? 1 : 0);
+      uint16_t temp = d0 % 10 | (d1 % 10 << 4);
+      uint8_t  expected = flags(temp) | ((d1 > 9) ? Processor::C : 0);
+      mismatches += Alu::adcDecimal[Alu::index(a, m, c)] != ((temp & 0x00FF) | (expected << 8));
+
+      int8_t   s0 = (a & 0x0F) - (m & 0x0F) - (c ? 0 : 1);
+      int8_t   s1 = (a >> 4) - (m >> 4) - (s0 < 0 ? 1 : 0);
+      uint16_t value = (s0 < 0 ? 10 + s0 : s0) | ((s1 < 0 ? 10 + s1 : s1) << 4);
+      expected = flags(value) | ((s1 < 0) ? Processor::C : 0);
+      mismatches += Alu::sbcDecimal[Alu::index(a, m, c)] != ((value & 0x00FF) | (expected << 8));
+    }
+    REQUIRE(mismatches == 0);
+  }
+#endif
 }
 
 #pragma region OPCode
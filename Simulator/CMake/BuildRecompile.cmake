@@ -0,0 +1,19 @@
+SET(APP_NAME Recompile)
+
+ADD_EXECUTABLE(${APP_NAME})
+
+TARGET_SOURCES(${APP_NAME}
+  PRIVATE
+          ${PROJECT_SOURCE_DIR}/Recompile.cpp
+)
+
+SET_TARGET_PROPERTIES(${APP_NAME} PROPERTIES
+                                 OUTPUT_NAME  "${APP_NAME}"
+                                     VERSION  "${${PROJECT_NAME}_VERSION}"
+                                CXX_STANDARD  "${PROJECT_CXX_STANDARD}"
+                       CXX_STANDARD_REQUIRED  "${PROJECT_CXX_STANDARD_REQUIRED}"
+                              CXX_EXTENSIONS  "${PROJECT_CXX_EXTENSIONS}"
+)
+
+TARGET_LINK_LIBRARIES(${APP_NAME} PUBLIC Processor)
+TARGET_INCLUDE_DIRECTORIES(${APP_NAME} PUBLIC Processor)
@@ -36,10 +36,7 @@ int main()
   size_t n = sizeof(program) / sizeof(program[0]);
   bus.cpu.LoadProgram(0x8000, program, n, 0x8000);
 
-  for (uint8_t i = 0; i <= 30; i++)
-  {
-    bus.cpu.tick();
-  }
+  bus.cpu.runInstructions(31);
 
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "Recompiler.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Translates a 6502 binary into a C++ module, build the output as a shared
+// library and load it with CPU::RecompiledModule:
+//
+//   Recompile [--65C02 | --2A03] rom.bin 8000 rom.cpp [entry ...]
+//   c++ -std=c++20 -O2 -shared -fPIC -I<path to Processor> rom.cpp -o rom.so
+//
+// The origin and entry points are hexadecimal. The NMI, RESET & IRQ vectors
+// are used as entry points when the binary holds them. The module is for the
+// NMOS 6502 unless another variant is given.
+int main(int argc, char* argv[])
+{
+  CPU::Executioner::VARIANT variant = CPU::Executioner::MOS6502;
+  if (argc > 1 && std::string(argv[1]) == "--65C02")
+  {
+    variant = CPU::Executioner::WDC65C02;
+  }
+  else if (argc > 1 && std::string(argv[1]) == "--2A03")
+  {
+    variant = CPU::Executioner::RICOH2A03;
+  }
+  if (variant != CPU::Executioner::MOS6502)
+  {
+    argv[1] = argv[0];
+    argc--;
+    argv++;
+  }
+
+  if (argc < 4)
+  {
+    std::cerr << "Usage: " << argv[0] << " [--65C02 | --2A03] <binary> <origin> <output.cpp> [entry ...]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::ifstream input(argv[1], std::ios::binary);
+  if (!input)
+  {
+    std::cerr << "Unable to open " << argv[1] << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::vector<uint8_t> image((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+  uint16_t origin = (uint16_t)std::stoul(argv[2], nullptr, 16);
+  CPU::Recompiler recompiler(image.data(), image.size(), origin, variant);
+  recompiler.addVectors();
+  for (int i = 4; i < argc; i++)
+  {
+    recompiler.addEntryPoint((uint16_t)std::stoul(argv[i], nullptr, 16));
+  }
+  if (argc == 4)
+  {
+    recompiler.addEntryPoint(origin);
+  }
+  recompiler.analyze();
+
+  std::ofstream output(argv[3]);
+  if (!output)
+  {
+    std::cerr << "Unable to write " << argv[3] << std::endl;
+    return EXIT_FAILURE;
+  }
+  recompiler.emit(output, argv[1]);
+
+  std::cout << "Translated " << recompiler.getBlocks().size() << " blocks" << std::endl;
+  return EXIT_SUCCESS;
+}